@@ -0,0 +1,31 @@
+#include <stddef.h>
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t n, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+size_t bench_alloc_count = 0;
+size_t bench_alloc_bytes = 0;
+
+void *malloc(size_t size) {
+    __atomic_fetch_add(&bench_alloc_count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&bench_alloc_bytes, size, __ATOMIC_RELAXED);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size) {
+    __atomic_fetch_add(&bench_alloc_count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&bench_alloc_bytes, n * size, __ATOMIC_RELAXED);
+    return __libc_calloc(n, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    __atomic_fetch_add(&bench_alloc_count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&bench_alloc_bytes, size, __ATOMIC_RELAXED);
+    return __libc_realloc(ptr, size);
+}
+
+void free(void *ptr) {
+    __libc_free(ptr);
+}
@@ -0,0 +1,41 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+#include "dom.h"
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} bench_buf;
+
+typedef struct {
+    const char *name;
+    char *html;
+    size_t len;
+} bench_input;
+
+typedef void (*bench_fn)(void *arg);
+
+extern size_t bench_alloc_count;
+extern size_t bench_alloc_bytes;
+
+double bench_now_ns(void);
+int bench_count_nodes(dom_node *node);
+double bench_report(const char *stage, const char *input, bench_fn fn, bench_fn after, void *arg, size_t bytes, int nodes, int warmup, int iters);
+
+void buf_append(bench_buf *b, const char *s);
+void buf_appendf(bench_buf *b, const char *fmt, ...);
+
+char* gen_deep_nesting(int depth, size_t *out_len);
+char* gen_wide_siblings(int count, size_t *out_len);
+char* gen_attr_heavy(int tags, int attrs_per_tag, size_t *out_len);
+char* gen_huge_text(size_t bytes, size_t *out_len);
+char* gen_entity_dense(int paragraphs, size_t *out_len);
+char* load_file(const char *path, size_t *out_len);
+
+int bench_make_inputs(bench_input *inputs, int max, int argc, char **argv);
+void bench_free_inputs(bench_input *inputs, int count);
+
+#endif
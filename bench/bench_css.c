@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench.h"
+#include "dom.h"
+#include "css.h"
+#include "styledecl.h"
+#include "treepool.h"
+#include "stylecache.h"
+
+#define MAX_INPUTS 32
+
+typedef struct {
+    const char *html;
+    dom_node *tree;
+    const char **colors;
+    int color_count;
+    long share_hits;
+    long share_misses;
+} css_job;
+
+static void build_tree(void *arg) {
+    css_job *job = arg;
+    job->tree = parse_html(job->html);
+}
+
+static void run_cascade(void *arg) {
+    css_job *job = arg;
+    process_css(job->tree, "http://localhost", 0);
+}
+
+static void free_cascade(void *arg) {
+    css_job *job = arg;
+    free_tree(job->tree);
+    job->tree = NULL;
+    build_tree(job);
+}
+
+typedef struct {
+    const char *tag;
+    const char *cls;
+    const char *prop;
+    const char *value;
+} cascade_rule;
+
+static const cascade_rule cascade_rules[] = {
+    {"body", NULL, "font-size", "16px"},
+    {"body", NULL, "color", "#202122"},
+    {"div", NULL, "display", "block"},
+    {"p", NULL, "margin-bottom", "12px"},
+    {"a", NULL, "color", "#3366cc"},
+    {"h1", NULL, "font-size", "32px"},
+    {"h2", NULL, "font-size", "28px"},
+    {"li", NULL, "margin-left", "20px"},
+    {"span", NULL, "display", "inline"},
+    {NULL, "d0", "padding-left", "4px"},
+    {NULL, "d3", "border", "1px solid #ccc"},
+    {NULL, "d5", "background-color", "#f8f9fa"},
+    {"div", "d7", "margin-top", "8px"},
+    {NULL, "note", "font-weight", "bold"},
+    {NULL, NULL, NULL, NULL}
+};
+
+static const char *inherited[] = {"color", "font-size", "font-weight", NULL};
+static const char *no_attributes[] = {NULL};
+
+static void cascade_node(dom_node *node, void *user) {
+    (void)user;
+    if (node->type != NODE_ELEMENT || !node->tag) return;
+    const char *cls = get_attribute(node, "class");
+    for (const cascade_rule *r = cascade_rules; r->prop; r++) {
+        if (r->tag && strcasecmp(r->tag, node->tag) != 0) continue;
+        if (r->cls && (!cls || !strstr(cls, r->cls))) continue;
+        set_style(node, r->prop, r->value);
+    }
+    const style_decls *decls = style_decls_of(node, NULL);
+    style_decls_apply(node, decls, 0);
+    style_decls_apply(node, decls, 1);
+    for (int i = 0; node->parent && inherited[i]; i++) {
+        const char *value = get_style(node->parent, inherited[i]);
+        if (value && !get_style(node, inherited[i])) set_style(node, inherited[i], value);
+    }
+}
+
+static void cascade_shared_node(dom_node *node, void *user) {
+    style_share_cache *cache = user;
+    if (style_share_lookup(cache, node)) return;
+    cascade_node(node, NULL);
+    style_share_insert(cache, node);
+}
+
+static void clear_node(dom_node *node, void *user) {
+    (void)user;
+    clear_styles(node);
+}
+
+static void run_parallel(void *arg) {
+    css_job *job = arg;
+    tree_parallel_for_each(job->tree, cascade_node, NULL);
+}
+
+static void reset_parallel(void *arg) {
+    css_job *job = arg;
+    tree_parallel_for_each(job->tree, clear_node, NULL);
+}
+
+static void run_shared(void *arg) {
+    css_job *job = arg;
+    style_share_cache *cache = style_share_new(0, no_attributes);
+    tree_parallel_for_each(job->tree, cascade_shared_node, cache);
+    style_share_stats(cache, &job->share_hits, &job->share_misses);
+    style_share_free(cache);
+}
+
+static void report_sharing(css_job *job, const char *name, size_t bytes, int nodes) {
+    tree_pool_set_threads(1);
+    bench_report("cascade_shared", name, run_shared, reset_parallel, job, bytes, nodes, 1, 5);
+    long lookups = job->share_hits + job->share_misses;
+    printf("%-22s %-16s %8ld hits %8ld misses  hit rate %5.1f%%\n", "style_share", name, job->share_hits, job->share_misses,
+           lookups ? 100.0 * job->share_hits / lookups : 0.0);
+}
+
+static void report_scaling(css_job *job, const char *name, size_t bytes, int nodes) {
+    int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (cores < 1) cores = 1;
+    if (cores > TREE_POOL_MAX_THREADS) cores = TREE_POOL_MAX_THREADS;
+
+    double base = 0;
+    for (int threads = 1; threads <= cores; threads = threads * 2 > cores && threads < cores ? cores : threads * 2) {
+        char stage[32];
+        snprintf(stage, sizeof(stage), "cascade_%dt", threads);
+        tree_pool_set_threads(threads);
+        double best = bench_report(stage, name, run_parallel, reset_parallel, job, bytes, nodes, 1, 5);
+        if (threads == 1) base = best;
+        printf("%-22s %-16s %2d threads  speedup %5.2fx\n", "cascade_speedup", name, threads, best > 0 ? base / best : 0.0);
+    }
+}
+
+static void run_colors(void *arg) {
+    css_job *job = arg;
+    SDL_Color acc = {0, 0, 0, 0};
+    for (int i = 0; i < job->color_count; i++) {
+        SDL_Color c = parse_css_color(job->colors[i], acc);
+        acc.r ^= c.r; acc.g ^= c.g; acc.b ^= c.b; acc.a ^= c.a;
+    }
+    if (acc.a == 1) printf(" ");
+}
+
+int main(int argc, char **argv) {
+    bench_input inputs[MAX_INPUTS];
+    int count = bench_make_inputs(inputs, MAX_INPUTS, argc, argv);
+
+    for (int i = 0; i < count; i++) {
+        css_job job = {0};
+        job.html = inputs[i].html;
+        build_tree(&job);
+        int nodes = bench_count_nodes(job.tree);
+        bench_report("process_css", inputs[i].name, run_cascade, free_cascade, &job, inputs[i].len, nodes, 1, 5);
+        reset_parallel(&job);
+        report_scaling(&job, inputs[i].name, inputs[i].len, nodes);
+        report_sharing(&job, inputs[i].name, inputs[i].len, nodes);
+        free_tree(job.tree);
+    }
+
+    static const char *samples[] = {"#fff", "#202122", "rgb(12, 34, 56)", "rgba(0, 0, 0, 0.5)", "red", "transparent", "white", "#3366cc", "inherit", "hsl(0, 0%, 50%)"};
+    css_job job = {0};
+    job.color_count = 100000;
+    job.colors = malloc(sizeof(char*) * job.color_count);
+    for (int i = 0; i < job.color_count; i++) job.colors[i] = samples[i % 10];
+    bench_report("parse_css_color", "mixed", run_colors, NULL, &job, 0, job.color_count, 2, 20);
+    free(job.colors);
+
+    bench_free_inputs(inputs, count);
+    tree_pool_shutdown();
+    return 0;
+}
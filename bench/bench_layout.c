@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <SDL2/SDL.h>
+#include "bench.h"
+#include "dom.h"
+#include "css.h"
+#include "renderer.h"
+
+#define MAX_INPUTS 32
+
+typedef struct {
+    dom_node *tree;
+    dom_node *target;
+    int height;
+    int flip;
+} layout_job;
+
+static void discard_memos(dom_node *node) {
+    free(node->layout_memo);
+    node->layout_memo = NULL;
+    for (int i = 0; i < node->child_count; i++) discard_memos(node->children[i]);
+}
+
+static void run_layout(void *arg) {
+    layout_job *job = arg;
+    job->height = layout_tree(job->tree);
+}
+
+static void reset_layout(void *arg) {
+    layout_job *job = arg;
+    discard_memos(job->tree);
+    mark_dirty(job->tree, DIRTY_LAYOUT);
+}
+
+static void run_keystroke(void *arg) {
+    layout_job *job = arg;
+    edit_attribute(job->target, "value", 0, job->flip ? "a" : "ab");
+    job->flip = !job->flip;
+    job->height = layout_tree(job->tree);
+}
+
+static void collect_elements(dom_node *node, dom_node **out, int *count, int cap) {
+    if (node->type == NODE_ELEMENT && *count < cap) out[(*count)++] = node;
+    for (int i = 0; i < node->child_count; i++) collect_elements(node->children[i], out, count, cap);
+}
+
+static dom_node* middle_element(dom_node *root, int nodes) {
+    dom_node **elements = malloc(sizeof(dom_node*) * (nodes > 0 ? nodes : 1));
+    int count = 0;
+    collect_elements(root, elements, &count, nodes);
+    dom_node *middle = count > 0 ? elements[count / 2] : root;
+    free(elements);
+    return middle;
+}
+
+int main(int argc, char **argv) {
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+    if (init_renderer() != 0) {
+        printf("could not initialise renderer for layout benchmark\n");
+        return 1;
+    }
+
+    bench_input inputs[MAX_INPUTS];
+    int count = bench_make_inputs(inputs, MAX_INPUTS, argc, argv);
+
+    for (int i = 0; i < count; i++) {
+        layout_job job = {0};
+        job.tree = parse_html(inputs[i].html);
+        process_css(job.tree, "http://localhost", 0);
+        int nodes = bench_count_nodes(job.tree);
+        bench_report("layout_tree", inputs[i].name, run_layout, reset_layout, &job, inputs[i].len, nodes, 1, 5);
+        job.target = middle_element(job.tree, nodes);
+        layout_tree(job.tree);
+        bench_report("relayout_keystroke", inputs[i].name, run_keystroke, NULL, &job, inputs[i].len, nodes, 1, 20);
+        free_tree(job.tree);
+    }
+
+    bench_free_inputs(inputs, count);
+    cleanup_renderer();
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "dom.h"
+
+#define MAX_INPUTS 32
+
+typedef struct {
+    const char *html;
+    dom_node *tree;
+    char *scratch;
+    const char *text;
+    size_t text_len;
+} parse_job;
+
+static void run_parse(void *arg) {
+    parse_job *job = arg;
+    job->tree = parse_html(job->html);
+}
+
+static void free_parse(void *arg) {
+    parse_job *job = arg;
+    free_tree(job->tree);
+    job->tree = NULL;
+}
+
+static void run_decode(void *arg) {
+    parse_job *job = arg;
+    memcpy(job->scratch, job->text, job->text_len + 1);
+    decode_html_entities(job->scratch);
+}
+
+static char* gen_entity_text(size_t bytes, size_t *out_len) {
+    static const char *chunks[] = {"&amp;", "plain ", "&lt;tag&gt; ", "&mdash;", "&nbsp;", "&#8212; ", "&#x1F600;", "&raquo; "};
+    bench_buf b = {0};
+    int i = 0;
+    while (b.len < bytes) buf_append(&b, chunks[i++ % 8]);
+    *out_len = b.len;
+    return b.data;
+}
+
+int main(int argc, char **argv) {
+    bench_input inputs[MAX_INPUTS];
+    int count = bench_make_inputs(inputs, MAX_INPUTS, argc, argv);
+
+    for (int i = 0; i < count; i++) {
+        parse_job job = {0};
+        job.html = inputs[i].html;
+
+        dom_node *probe = parse_html(job.html);
+        int nodes = bench_count_nodes(probe);
+        free_tree(probe);
+
+        int iters = inputs[i].len > (4 << 20) ? 5 : 20;
+        bench_report("parse_html", inputs[i].name, run_parse, free_parse, &job, inputs[i].len, nodes, 2, iters);
+    }
+
+    size_t text_len = 0;
+    char *text = gen_entity_text(1 << 20, &text_len);
+    parse_job job = {0};
+    job.text = text;
+    job.text_len = text_len;
+    job.scratch = malloc(text_len + 1);
+    bench_report("decode_html_entities", "entity_dense", run_decode, NULL, &job, text_len, 0, 3, 50);
+
+    size_t plain_len = 0;
+    char *plain = gen_huge_text(1 << 20, &plain_len);
+    job.text = plain;
+    job.text_len = plain_len;
+    job.scratch = realloc(job.scratch, plain_len + 1);
+    bench_report("decode_html_entities", "plain_text", run_decode, NULL, &job, plain_len, 0, 3, 50);
+
+    free(job.scratch);
+    free(plain);
+    free(text);
+    bench_free_inputs(inputs, count);
+    return 0;
+}
@@ -0,0 +1,196 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include "bench.h"
+#include "archive.h"
+
+double bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+int bench_count_nodes(dom_node *node) {
+    if (!node) return 0;
+    int count = 1;
+    for (int i = 0; i < node->child_count; i++) {
+        count += bench_count_nodes(node->children[i]);
+    }
+    return count;
+}
+
+double bench_report(const char *stage, const char *input, bench_fn fn, bench_fn after, void *arg, size_t bytes, int nodes, int warmup, int iters) {
+    for (int i = 0; i < warmup; i++) {
+        fn(arg);
+        if (after) after(arg);
+    }
+
+    size_t allocs = 0;
+    double best = 0, total = 0;
+    for (int i = 0; i < iters; i++) {
+        size_t allocs_before = bench_alloc_count;
+        double start = bench_now_ns();
+        fn(arg);
+        double elapsed = bench_now_ns() - start;
+        allocs += bench_alloc_count - allocs_before;
+        if (after) after(arg);
+        total += elapsed;
+        if (i == 0 || elapsed < best) best = elapsed;
+    }
+    double allocs_per_iter = (double)allocs / iters;
+
+    printf("%-22s %-16s %10zu bytes %8d nodes  best %11.0f ns  mean %11.0f ns  %7.2f ns/byte  %8.1f ns/node  %6.2f allocs/node  %8.1f MB/s\n",
+           stage, input, bytes, nodes, best, total / iters,
+           bytes ? best / bytes : 0.0,
+           nodes ? best / nodes : 0.0,
+           nodes ? allocs_per_iter / nodes : 0.0,
+           best > 0 ? (bytes / (best / 1e9)) / (1024.0 * 1024.0) : 0.0);
+    return best;
+}
+
+void buf_append(bench_buf *b, const char *s) {
+    size_t n = strlen(s);
+    if (b->len + n + 1 > b->cap) {
+        while (b->len + n + 1 > b->cap) b->cap = b->cap ? b->cap * 2 : 4096;
+        b->data = realloc(b->data, b->cap);
+    }
+    memcpy(b->data + b->len, s, n + 1);
+    b->len += n;
+}
+
+void buf_appendf(bench_buf *b, const char *fmt, ...) {
+    char tmp[1024];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(tmp, sizeof(tmp), fmt, ap);
+    va_end(ap);
+    buf_append(b, tmp);
+}
+
+char* gen_deep_nesting(int depth, size_t *out_len) {
+    bench_buf b = {0};
+    buf_append(&b, "<html><body>");
+    for (int i = 0; i < depth; i++) buf_appendf(&b, "<div class=\"d%d\">level %d ", i % 8, i);
+    for (int i = 0; i < depth; i++) buf_append(&b, "</div>");
+    buf_append(&b, "</body></html>");
+    *out_len = b.len;
+    return b.data;
+}
+
+char* gen_wide_siblings(int count, size_t *out_len) {
+    bench_buf b = {0};
+    buf_append(&b, "<html><body><ul>");
+    for (int i = 0; i < count; i++) {
+        buf_appendf(&b, "<li><a href=\"/wiki/item_%d\">item %d</a> some text &amp; more</li>\n", i, i);
+    }
+    buf_append(&b, "</ul></body></html>");
+    *out_len = b.len;
+    return b.data;
+}
+
+char* gen_attr_heavy(int tags, int attrs_per_tag, size_t *out_len) {
+    bench_buf b = {0};
+    buf_append(&b, "<html><body>");
+    for (int i = 0; i < tags; i++) {
+        buf_append(&b, "<span");
+        for (int a = 0; a < attrs_per_tag; a++) {
+            buf_appendf(&b, " data-attr%d=\"value-%d-%d &quot;q&quot;\"", a, i, a);
+        }
+        buf_appendf(&b, " class=\"c%d\" style=\"color: #333; margin-left: %dpx\">x</span>\n", i % 16, i % 20);
+    }
+    buf_append(&b, "</body></html>");
+    *out_len = b.len;
+    return b.data;
+}
+
+char* gen_huge_text(size_t bytes, size_t *out_len) {
+    static const char *words[] = {"lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "sed", "do"};
+    bench_buf b = {0};
+    buf_append(&b, "<html><body><p>");
+    int w = 0;
+    while (b.len < bytes) {
+        buf_append(&b, words[w % 10]);
+        buf_append(&b, (w % 13 == 12) ? "\n    " : " ");
+        w++;
+    }
+    buf_append(&b, "</p></body></html>");
+    *out_len = b.len;
+    return b.data;
+}
+
+char* gen_entity_dense(int paragraphs, size_t *out_len) {
+    static const char *refs[] = {"&mdash;", "&amp;", "&nbsp;", "&#8212;", "&#x201C;", "&hellip;", "&eacute;", "&lt;", "&rarr;", "&copy;", "&frac12;", "&NotSquareSupersetEqual;"};
+    bench_buf b = {0};
+    buf_append(&b, "<html><body>");
+    for (int i = 0; i < paragraphs; i++) {
+        buf_append(&b, "<p title=\"caf&eacute; &amp; cr&egrave;me\">");
+        for (int j = 0; j < 24; j++) {
+            buf_append(&b, refs[(i + j) % 12]);
+            buf_append(&b, (j % 3 == 0) ? " word " : "x");
+        }
+        buf_append(&b, "</p>\n");
+    }
+    buf_append(&b, "</body></html>");
+    *out_len = b.len;
+    return b.data;
+}
+
+char* load_file(const char *path, size_t *out_len) {
+    char local[URL_MAX];
+    parsed_url url;
+    if (strncmp(path, "file://", 7) == 0) {
+        if (url_parse(path, &url) != 0 || file_url_path(&url, local, sizeof(local)) != 0) return NULL;
+        path = local;
+    }
+
+    mapped_file file;
+    if (map_file(path, &file) != 0) return NULL;
+    const char *src = file.data;
+    size_t len = file.len;
+    page_archive *archive = archive_from_map(&file);
+    if (archive) archive_document(archive, &src, &len);
+
+    char *data = malloc(len + 1);
+    memcpy(data, src, len);
+    data[len] = '\0';
+    *out_len = len;
+
+    if (archive) archive_close(archive);
+    else unmap_file(&file);
+    return data;
+}
+
+int bench_make_inputs(bench_input *inputs, int max, int argc, char **argv) {
+    int n = 0;
+    inputs[n].name = "deep_nesting";
+    inputs[n].html = gen_deep_nesting(2000, &inputs[n].len); n++;
+    inputs[n].name = "wide_siblings";
+    inputs[n].html = gen_wide_siblings(20000, &inputs[n].len); n++;
+    inputs[n].name = "attr_heavy";
+    inputs[n].html = gen_attr_heavy(5000, 12, &inputs[n].len); n++;
+    inputs[n].name = "huge_text";
+    inputs[n].html = gen_huge_text(8 * 1024 * 1024, &inputs[n].len); n++;
+    inputs[n].name = "entity_dense";
+    inputs[n].html = gen_entity_dense(20000, &inputs[n].len); n++;
+
+    for (int i = 1; i < argc && n < max; i++) {
+        size_t len = 0;
+        char *data = load_file(argv[i], &len);
+        if (!data) {
+            printf("could not read %s\n", argv[i]);
+            continue;
+        }
+        const char *base = strrchr(argv[i], '/');
+        inputs[n].name = base ? base + 1 : argv[i];
+        inputs[n].html = data;
+        inputs[n].len = len;
+        n++;
+    }
+    return n;
+}
+
+void bench_free_inputs(bench_input *inputs, int count) {
+    for (int i = 0; i < count; i++) free(inputs[i].html);
+}
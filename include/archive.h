@@ -0,0 +1,75 @@
+#ifndef ARCHIVE_H
+#define ARCHIVE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "url.h"
+
+#define ARCHIVE_MAGIC "BPAR"
+#define ARCHIVE_VERSION 1
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t entry_count;
+    uint32_t document;
+    uint32_t document_url;
+    uint64_t entry_offset;
+    uint64_t pool_offset;
+    uint64_t pool_size;
+} archive_header;
+
+typedef struct {
+    uint32_t url;
+    uint32_t type;
+    uint64_t offset;
+    uint64_t length;
+} archive_entry;
+
+typedef struct {
+    const char *data;
+    size_t len;
+    void *map;
+    size_t map_len;
+} mapped_file;
+
+typedef struct page_archive page_archive;
+
+typedef struct {
+    const char *data;
+    size_t len;
+    const char *type;
+    parsed_url url;
+    mapped_file file;
+    page_archive *archive;
+    int mounted;
+} offline_resource;
+
+int map_file(const char *path, mapped_file *out);
+void unmap_file(mapped_file *file);
+int file_url_path(const parsed_url *url, char *out, size_t size);
+
+page_archive* archive_open(const char *path);
+page_archive* archive_from_map(mapped_file *file);
+void archive_close(page_archive *archive);
+const char* archive_document_url(const page_archive *archive);
+int archive_document(const page_archive *archive, const char **data, size_t *len);
+int archive_find(const page_archive *archive, const char *url, const char **data, size_t *len, const char **type);
+
+void archive_mount(page_archive *archive);
+void archive_unmount(page_archive *archive);
+void archive_unmount_all();
+
+int offline_open(const parsed_url *target, offline_resource *out);
+page_archive* offline_keep_mount(offline_resource *res);
+void archive_release_mount(page_archive *archive);
+void offline_release(offline_resource *res);
+
+const char* archive_record_path();
+void archive_record_begin();
+int archive_recording();
+void archive_record(const char *url, const char *type, const char *data, size_t len);
+int archive_record_end(const char *document_url, const char *path);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef DNS_H
+#define DNS_H
+
+#include <sys/socket.h>
+
+#define DNS_MAX_ADDRS 8
+
+typedef struct {
+    int count;
+    struct sockaddr_storage addrs[DNS_MAX_ADDRS];
+    socklen_t lens[DNS_MAX_ADDRS];
+} dns_result;
+
+int dns_resolve(const char *host, dns_result *out);
+void dns_prefetch(const char *host);
+void dns_prefetch_url(const char *url);
+void dns_shutdown();
+
+#endif
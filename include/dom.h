@@ -1,6 +1,13 @@
 #ifndef DOM_H
 #define DOM_H
 
+#include <stddef.h>
+
+#define DIRTY_STYLE 1
+#define DIRTY_LAYOUT 2
+#define DIRTY_PAINT 4
+#define DIRTY_CHILD 8
+
 typedef enum {
     NODE_ELEMENT,
     NODE_TEXT
@@ -20,6 +27,8 @@ typedef struct {
     char *value;
 } css_prop;
 
+struct style_decls;
+
 typedef struct dom_node {
     node_type type;
     char *tag;
@@ -28,7 +37,10 @@ typedef struct dom_node {
     char *src;
     void *texture;
     int img_w, img_h;
+    int tex_w, tex_h;
     rect layout;
+    unsigned dirty;
+    void *layout_memo;
 
     dom_attr *attributes;
     int attr_count;
@@ -37,6 +49,7 @@ typedef struct dom_node {
     css_prop *styles;
     int style_count;
     int style_capacity;
+    struct style_decls *inline_style;
 
     struct dom_node **children;
     int child_count;
@@ -45,13 +58,21 @@ typedef struct dom_node {
 } dom_node;
 
 dom_node* create_element(const char *tag, dom_node *parent);
+dom_node* create_element_n(const char *tag, size_t len, dom_node *parent);
 dom_node* create_text_node(const char *text, dom_node *parent);
 void add_child(dom_node *parent, dom_node *child);
 const char* get_attribute(dom_node *node, const char *name);
 void set_attribute(dom_node *node, const char *name, const char *value);
+void edit_attribute(dom_node *node, const char *name, size_t keep, const char *append);
 void set_style(dom_node *node, const char *name, const char *value);
 const char* get_style(dom_node *node, const char *name);
+void clear_styles(dom_node *node);
+void copy_styles(dom_node *node, const dom_node *from);
+void mark_dirty(dom_node *node, unsigned flags);
+void decode_html_entities(char *str);
+void set_url_attribute_hook(void (*hook)(const char *url));
 dom_node* parse_html(const char *html);
+dom_node* parse_html_len(const char *html, size_t len);
 void print_tree(dom_node *root, int depth);
 void free_tree(dom_node *root);
 
@@ -0,0 +1,12 @@
+#ifndef DUMP_H
+#define DUMP_H
+
+#include <stddef.h>
+
+#define DUMP_MAX_ITEMS 64
+#define DUMP_MAX_BYTES (64 * 1024 * 1024)
+
+void dump_submit(const char *url, const char *kind, const char *data, size_t len);
+void dump_shutdown();
+
+#endif
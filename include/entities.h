@@ -0,0 +1,11 @@
+#ifndef ENTITIES_H
+#define ENTITIES_H
+
+#include <stddef.h>
+
+#define ENTITY_MAX_NAME 32
+#define ENTITY_MAX_LEGACY 6
+
+const char* entity_lookup(const char *name, size_t len, size_t *value_len);
+
+#endif
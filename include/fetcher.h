@@ -2,7 +2,13 @@
 #define FETCHER_H
 
 #include <stddef.h>
+#include "http.h"
+#include "url.h"
 
+int http_fetch(const char *scheme, const char *hostname, const char *port, const char *path, http_response *resp, const http_sink *sink);
+int http_fetch_url(const parsed_url *target, http_response *resp, const http_sink *sink, parsed_url *final_url);
+void http_close_idle();
 char* fetch_html(const char *hostname, const char *port, const char *path, size_t *out_size);
+char* fetch_html_scheme(const char *scheme, const char *hostname, const char *port, const char *path, size_t *out_size);
 
 #endif
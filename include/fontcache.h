@@ -0,0 +1,15 @@
+#ifndef FONTCACHE_H
+#define FONTCACHE_H
+
+#include <SDL2/SDL_ttf.h>
+
+#define FONT_CACHE_MAX 24
+#define FONT_DEFAULT_PX 16
+#define FONT_MIN_PX 6
+#define FONT_MAX_PX 128
+
+TTF_Font* font_get(int px, int style);
+int font_px_from_css(const char *value);
+void font_cache_shutdown();
+
+#endif
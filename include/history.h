@@ -0,0 +1,21 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include "dom.h"
+#include "url.h"
+
+typedef struct {
+    char url[URL_MAX];
+    int scroll_y;
+    dom_node *tree;
+    int textures_dropped;
+} history_entry;
+
+void history_store(dom_node *tree, int scroll_y);
+void history_commit(const char *url, int replace);
+int history_can_go(int delta);
+history_entry* history_go(int delta);
+size_t history_cached_bytes();
+void history_clear();
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef HTTP_H
+#define HTTP_H
+
+#include <stddef.h>
+
+#define HTTP_MAX_HEADERS 64
+#define HTTP_MAX_HEAD (64 * 1024)
+#define HTTP_MAX_PREALLOC (4 * 1024 * 1024)
+
+typedef enum {
+    HTTP_ENCODING_IDENTITY,
+    HTTP_ENCODING_GZIP,
+    HTTP_ENCODING_DEFLATE
+} http_encoding;
+
+typedef struct {
+    char *name;
+    char *value;
+} http_header;
+
+typedef struct {
+    int status;
+    int minor_version;
+    char *head;
+    size_t head_len;
+    http_header headers[HTTP_MAX_HEADERS];
+    int header_count;
+    long content_length;
+    int chunked;
+    int has_body;
+    int keep_alive;
+    http_encoding encoding;
+} http_response;
+
+typedef struct {
+    int (*on_headers)(const http_response *resp, void *user);
+    int (*on_data)(const char *data, size_t len, void *user);
+    void *user;
+} http_sink;
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} http_body;
+
+typedef struct http_decoder http_decoder;
+
+long http_find_head_end(const char *data, size_t len);
+int http_parse_head(const char *data, size_t len, http_response *resp);
+const char* http_get_header(const http_response *resp, const char *name);
+long http_freshness_lifetime(const http_response *resp);
+void http_response_free(http_response *resp);
+
+http_decoder* http_decoder_new(const http_response *resp, const http_sink *sink);
+int http_decoder_feed(http_decoder *dec, const char *data, size_t len);
+int http_decoder_finish(http_decoder *dec);
+int http_decoder_done(const http_decoder *dec);
+void http_decoder_free(http_decoder *dec);
+
+int http_body_headers(const http_response *resp, void *user);
+int http_body_append(const char *data, size_t len, void *user);
+void http_body_free(http_body *body);
+
+#endif
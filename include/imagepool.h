@@ -0,0 +1,34 @@
+#ifndef IMAGEPOOL_H
+#define IMAGEPOOL_H
+
+#include "dom.h"
+#include "url.h"
+
+#define IMAGE_MAX_WORKERS 8
+
+typedef struct {
+    int attr_w, attr_h;
+    int max_w;
+    int exact_w, exact_h;
+} image_fit;
+
+typedef struct {
+    dom_node *root;
+    dom_node *node;
+    void *surface;
+    char *url;
+    int img_w, img_h;
+    int box_w, box_h;
+    int nat_w, nat_h;
+    int partial;
+} image_result;
+
+void image_pool_request(dom_node *root, dom_node *node, const parsed_url *target, const image_fit *fit, int download_assets);
+int image_pool_take(image_result *out);
+void image_pool_release(image_result *result);
+int image_pool_pending(dom_node *root);
+int image_pool_cancel(dom_node *root);
+double image_upload_budget_ms();
+void image_pool_shutdown();
+
+#endif
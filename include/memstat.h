@@ -0,0 +1,36 @@
+#ifndef MEMSTAT_H
+#define MEMSTAT_H
+
+#include <stddef.h>
+#include "dom.h"
+
+typedef enum {
+    MEM_DOM_NODES,
+    MEM_ATTRIBUTES,
+    MEM_STYLES,
+    MEM_TEXT,
+    MEM_RESPONSE,
+    MEM_TEXTURES,
+    MEM_CATEGORY_COUNT
+} mem_category;
+
+typedef struct {
+    size_t bytes[MEM_CATEGORY_COUNT];
+} mem_stats;
+
+typedef struct {
+    size_t document_bytes;
+    size_t texture_bytes;
+    size_t image_bytes;
+    size_t bfcache_bytes;
+} mem_budget;
+
+void memstat_add(mem_category cat, size_t bytes);
+void memstat_sub(mem_category cat, size_t bytes);
+void memstat_measure_tree(dom_node *root, mem_stats *out);
+size_t memstat_total(const mem_stats *stats);
+size_t memstat_rss();
+const char* memstat_category_name(mem_category cat);
+const mem_budget* memstat_budget();
+
+#endif
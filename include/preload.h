@@ -0,0 +1,20 @@
+#ifndef PRELOAD_H
+#define PRELOAD_H
+
+#include <stddef.h>
+#include "http.h"
+#include "url.h"
+
+typedef struct preload_scanner preload_scanner;
+
+preload_scanner* preload_scanner_new(const parsed_url *base);
+void preload_scanner_feed(preload_scanner *s, const char *data, size_t len);
+int preload_scanner_found(const preload_scanner *s);
+void preload_scanner_free(preload_scanner *s);
+
+void preload_fetch(const parsed_url *target);
+int preload_take(const parsed_url *target, http_response *resp, http_body *body);
+void preload_clear();
+void preload_shutdown();
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef PRERENDER_H
+#define PRERENDER_H
+
+#include "dom.h"
+#include "url.h"
+
+typedef enum {
+    PRERENDER_OFF,
+    PRERENDER_FETCH,
+    PRERENDER_FULL
+} prerender_mode;
+
+prerender_mode prerender_get_mode();
+int prerender_dwell_ms();
+void prerender_request(const parsed_url *target);
+void prerender_poll(int download_assets);
+int prerender_take(const parsed_url *target, dom_node **tree, parsed_url *final_url, int download_assets);
+void prerender_shutdown();
+
+#endif
@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include "dom.h"
 
+dom_node* process_document(const char *body, size_t length, const char *url, int make_temp);
 dom_node* process_response(const char *raw_data, size_t length, int make_temp);
 
 #endif
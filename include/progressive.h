@@ -0,0 +1,25 @@
+#ifndef PROGRESSIVE_H
+#define PROGRESSIVE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+    PROGRESSIVE_UNKNOWN,
+    PROGRESSIVE_PNG,
+    PROGRESSIVE_JPEG,
+    PROGRESSIVE_OTHER
+} progressive_format;
+
+typedef struct progressive_decoder progressive_decoder;
+
+progressive_decoder* progressive_new(size_t max_bytes);
+int progressive_feed(progressive_decoder *dec, const char *data, size_t len);
+progressive_format progressive_kind(const progressive_decoder *dec);
+int progressive_size(const progressive_decoder *dec, int *width, int *height);
+int progressive_updated(progressive_decoder *dec);
+int progressive_complete(const progressive_decoder *dec);
+const uint32_t* progressive_pixels(const progressive_decoder *dec, int *pitch);
+void progressive_free(progressive_decoder *dec);
+
+#endif
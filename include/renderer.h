@@ -4,8 +4,15 @@
 #include "dom.h"
 
 int init_renderer();
+void set_viewport(int width, int height);
 void load_images(dom_node *node, const char *base_url, int download_assets);
-void render_tree(dom_node *root, const char *url_text, int scroll_y, dom_node *focused_node);
+int upload_images(dom_node *root, double budget_ms);
+int layout_tree(dom_node *root);
+int layout_target_y(dom_node *root, dom_node *target);
+void render_tree(dom_node *root, const char *url_text, int *scroll_y, dom_node *focused_node);
+void set_hud_visible(int visible);
+int is_hud_visible();
+void enforce_memory_budget(dom_node *root, int scroll_y);
 void free_textures(dom_node *node);
 void cleanup_renderer();
 
@@ -0,0 +1,8 @@
+#ifndef RESAMPLE_H
+#define RESAMPLE_H
+
+#include <stdint.h>
+
+int resample_box(const uint32_t *src, int sw, int sh, int src_pitch, uint32_t *dst, int dw, int dh, int dst_pitch);
+
+#endif
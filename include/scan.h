@@ -0,0 +1,13 @@
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <stddef.h>
+
+const char* scan_text_special(const char *p, const char *end);
+const char* scan_end_tag(const char *p, const char *end, const char *tag);
+
+static inline int scan_is_space(unsigned char c) {
+    return c == ' ' || (c >= 9 && c <= 13);
+}
+
+#endif
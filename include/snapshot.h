@@ -0,0 +1,72 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dom.h"
+#include "url.h"
+
+#define SNAPSHOT_MAGIC "BDOM"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_NONE 0xFFFFFFFFu
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t node_count;
+    uint32_t attr_count;
+    uint32_t style_count;
+    uint32_t asset_count;
+    uint32_t pool_size;
+    uint32_t node_offset;
+    uint32_t attr_offset;
+    uint32_t style_offset;
+    uint32_t asset_offset;
+    uint32_t pool_offset;
+    uint32_t url;
+    int32_t scroll_y;
+    int32_t reserved;
+    int64_t saved_at;
+    int64_t expires;
+} snapshot_header;
+
+typedef struct {
+    uint32_t type;
+    uint32_t parent;
+    uint32_t tag;
+    uint32_t text;
+    uint32_t href;
+    uint32_t src;
+    uint32_t first_attr;
+    uint32_t attr_count;
+    uint32_t first_style;
+    uint32_t style_count;
+    uint32_t child_count;
+    int32_t img_w, img_h;
+    int32_t x, y, w, h;
+} snapshot_node;
+
+typedef struct {
+    uint32_t name;
+    uint32_t value;
+} snapshot_pair;
+
+typedef struct {
+    dom_node *tree;
+    char url[URL_MAX];
+    int scroll_y;
+    int64_t saved_at;
+    int64_t expires;
+    char **assets;
+    int asset_count;
+} snapshot_doc;
+
+void snapshot_path(const char *url, char *out, size_t size);
+void snapshot_session_path(char *out, size_t size);
+int snapshot_read_header(const char *path, snapshot_header *out);
+int snapshot_save(const char *path, dom_node *root, const char *url, int scroll_y, int64_t expires);
+int snapshot_load(const char *path, snapshot_doc *out);
+void snapshot_doc_free(snapshot_doc *doc);
+
+#endif
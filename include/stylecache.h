@@ -0,0 +1,16 @@
+#ifndef STYLECACHE_H
+#define STYLECACHE_H
+
+#include "dom.h"
+
+#define STYLE_SHARE_SLOTS 32
+
+typedef struct style_share_cache style_share_cache;
+
+style_share_cache* style_share_new(int structural, const char **attributes);
+int style_share_lookup(style_share_cache *cache, dom_node *node);
+void style_share_insert(style_share_cache *cache, dom_node *node);
+void style_share_stats(const style_share_cache *cache, long *hits, long *misses);
+void style_share_free(style_share_cache *cache);
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef STYLEDECL_H
+#define STYLEDECL_H
+
+#include <stdint.h>
+#include "dom.h"
+
+typedef struct style_decls {
+    css_prop *props;
+    unsigned char *important;
+    int count;
+    int refs;
+    uint32_t hash;
+    char *source;
+} style_decls;
+
+typedef struct style_decl_table style_decl_table;
+
+style_decl_table* style_decl_table_new();
+style_decls* style_decls_intern(style_decl_table *table, const char *text);
+style_decls* style_decls_retain(style_decls *decls);
+void style_decls_release(style_decls *decls);
+style_decls* style_decls_of(dom_node *node, style_decl_table *table);
+const char* style_decls_get(const style_decls *decls, const char *name);
+void style_decls_apply(dom_node *node, const style_decls *decls, int important);
+size_t style_decls_bytes(const style_decls *decls);
+void style_decl_table_free(style_decl_table *table);
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#ifdef ENABLE_TRACE
+
+void trace_begin(const char *name);
+void trace_end(const char *name);
+void trace_counter(const char *name, long value);
+void trace_scope_end(const char **name);
+
+#define TRACE_BEGIN(name) trace_begin(name)
+#define TRACE_END(name) trace_end(name)
+#define TRACE_COUNTER(name, value) trace_counter(name, value)
+#define TRACE_SCOPE(name) \
+    const char *TRACE_CONCAT(trace_scope_, __LINE__) __attribute__((cleanup(trace_scope_end))) = (trace_begin(name), (name))
+
+#else
+
+#define TRACE_BEGIN(name) do { } while (0)
+#define TRACE_END(name) do { } while (0)
+#define TRACE_COUNTER(name, value) do { } while (0)
+#define TRACE_SCOPE(name) do { } while (0)
+
+#endif
+
+uint64_t trace_now_ns(void);
+int trace_export(const char *path);
+
+void frame_stats_add(double frame_ms);
+int frame_stats_percentiles(double *p50, double *p95, double *p99);
+
+#endif
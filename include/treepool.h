@@ -0,0 +1,16 @@
+#ifndef TREEPOOL_H
+#define TREEPOOL_H
+
+#include "dom.h"
+
+#define TREE_POOL_MAX_THREADS 16
+#define TREE_POOL_SPINS 64
+
+typedef void (*tree_visit_fn)(dom_node *node, void *user);
+
+void tree_parallel_for_each(dom_node *root, tree_visit_fn visit, void *user);
+int tree_pool_threads();
+void tree_pool_set_threads(int threads);
+void tree_pool_shutdown();
+
+#endif
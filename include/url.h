@@ -0,0 +1,23 @@
+#ifndef URL_H
+#define URL_H
+
+#include <stddef.h>
+
+#define URL_MAX 8192
+#define URL_HOST_MAX 256
+
+typedef struct {
+    char scheme[8];
+    char host[URL_HOST_MAX];
+    char port[8];
+    char path[URL_MAX];
+} parsed_url;
+
+int url_parse(const char *text, parsed_url *out);
+int url_resolve(const parsed_url *base, const char *ref, parsed_url *out);
+void url_format(const parsed_url *u, char *buf, size_t size);
+void url_origin(const parsed_url *u, char *buf, size_t size);
+int url_is_default_port(const parsed_url *u);
+int url_is_file(const parsed_url *u);
+
+#endif
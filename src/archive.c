@@ -0,0 +1,440 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "archive.h"
+#include "trace.h"
+
+#define RECORD_MAX 512
+
+struct page_archive {
+    mapped_file file;
+    const archive_header *header;
+    const archive_entry *entries;
+    const char *pool;
+    char *path;
+    int refs;
+    int mounts;
+    struct page_archive *next;
+};
+
+typedef struct {
+    char *url;
+    char *type;
+    char *data;
+    size_t len;
+} record_entry;
+
+static page_archive *mounted = NULL;
+static pthread_mutex_t mount_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static record_entry records[RECORD_MAX];
+static int record_count = 0;
+static int record_active = 0;
+static pthread_mutex_t record_lock = PTHREAD_MUTEX_INITIALIZER;
+
+int map_file(const char *path, mapped_file *out) {
+    memset(out, 0, sizeof(*out));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return -1;
+    }
+    if (st.st_size > 0) {
+        void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            close(fd);
+            return -1;
+        }
+        out->map = map;
+        out->map_len = st.st_size;
+    }
+    close(fd);
+
+    out->data = out->map ? out->map : "";
+    out->len = out->map_len;
+    return 0;
+}
+
+void unmap_file(mapped_file *file) {
+    if (file->map) munmap(file->map, file->map_len);
+    memset(file, 0, sizeof(*file));
+}
+
+static int hex_value(char c) {
+    return isdigit((unsigned char)c) ? c - '0' : tolower((unsigned char)c) - 'a' + 10;
+}
+
+int file_url_path(const parsed_url *url, char *out, size_t size) {
+    if (!url_is_file(url)) return -1;
+    size_t n = 0;
+    for (const char *p = url->path; *p && *p != '?'; p++) {
+        char c = *p;
+        if (c == '%' && isxdigit((unsigned char)p[1]) && isxdigit((unsigned char)p[2])) {
+            c = (char)(hex_value(p[1]) * 16 + hex_value(p[2]));
+            if (c == '\0') return -1;
+            p += 2;
+        }
+        if (n + 1 >= size) return -1;
+        out[n++] = c;
+    }
+    out[n] = '\0';
+    return 0;
+}
+
+static const char* guess_type(const char *path) {
+    static const char *types[][2] = {
+        {".html", "text/html"}, {".htm", "text/html"}, {".css", "text/css"}, {".js", "application/javascript"},
+        {".png", "image/png"}, {".jpg", "image/jpeg"}, {".jpeg", "image/jpeg"}, {".gif", "image/gif"},
+        {".svg", "image/svg+xml"}, {".webp", "image/webp"}, {".txt", "text/plain"}, {NULL, NULL}
+    };
+    const char *dot = strrchr(path, '.');
+    if (dot && !strchr(dot, '/')) {
+        for (int i = 0; types[i][0]; i++) {
+            if (strcasecmp(dot, types[i][0]) == 0) return types[i][1];
+        }
+    }
+    return "application/octet-stream";
+}
+
+page_archive* archive_from_map(mapped_file *file) {
+    const char *base = file->data;
+    size_t size = file->len;
+    if (size < sizeof(archive_header)) return NULL;
+
+    const archive_header *h = (const archive_header*)base;
+    int valid = memcmp(h->magic, ARCHIVE_MAGIC, 4) == 0 && h->version == ARCHIVE_VERSION && h->header_size == sizeof(archive_header);
+    valid = valid && h->entry_count > 0 && h->document < h->entry_count;
+    valid = valid && h->entry_offset % 8 == 0 && h->entry_offset <= size && h->entry_count <= (size - h->entry_offset) / sizeof(archive_entry);
+    valid = valid && h->pool_size > 0 && h->pool_offset <= size && h->pool_size <= size - h->pool_offset;
+    valid = valid && base[h->pool_offset + h->pool_size - 1] == '\0' && h->document_url < h->pool_size;
+
+    const archive_entry *entries = (const archive_entry*)(base + h->entry_offset);
+    const char *pool = base + h->pool_offset;
+    for (uint32_t i = 0; valid && i < h->entry_count; i++) {
+        const archive_entry *e = &entries[i];
+        valid = e->url < h->pool_size && e->type < h->pool_size && e->offset <= size && e->length <= size - e->offset;
+        if (valid && i > 0) valid = strcmp(pool + entries[i - 1].url, pool + e->url) < 0;
+    }
+    if (!valid) return NULL;
+
+    page_archive *archive = calloc(1, sizeof(page_archive));
+    archive->file = *file;
+    archive->header = h;
+    archive->entries = entries;
+    archive->pool = pool;
+    archive->refs = 1;
+    memset(file, 0, sizeof(*file));
+    return archive;
+}
+
+page_archive* archive_open(const char *path) {
+    mapped_file file;
+    if (map_file(path, &file) != 0) return NULL;
+    page_archive *archive = archive_from_map(&file);
+    if (!archive) unmap_file(&file);
+    return archive;
+}
+
+void archive_close(page_archive *archive) {
+    if (!archive || __atomic_sub_fetch(&archive->refs, 1, __ATOMIC_ACQ_REL) > 0) return;
+    unmap_file(&archive->file);
+    free(archive->path);
+    free(archive);
+}
+
+const char* archive_document_url(const page_archive *archive) {
+    return archive->pool + archive->header->document_url;
+}
+
+static void entry_view(const page_archive *archive, const archive_entry *e, const char **data, size_t *len, const char **type) {
+    *data = archive->file.data + e->offset;
+    *len = e->length;
+    if (type) *type = archive->pool + e->type;
+}
+
+int archive_document(const page_archive *archive, const char **data, size_t *len) {
+    entry_view(archive, &archive->entries[archive->header->document], data, len, NULL);
+    return 0;
+}
+
+int archive_find(const page_archive *archive, const char *url, const char **data, size_t *len, const char **type) {
+    uint32_t lo = 0, hi = archive->header->entry_count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        int cmp = strcmp(archive->pool + archive->entries[mid].url, url);
+        if (cmp == 0) {
+            entry_view(archive, &archive->entries[mid], data, len, type);
+            return 0;
+        }
+        if (cmp < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return -1;
+}
+
+static void retain(page_archive *archive) {
+    __atomic_fetch_add(&archive->refs, 1, __ATOMIC_RELAXED);
+}
+
+static void unlink_mount(page_archive *archive) {
+    for (page_archive **link = &mounted; *link; link = &(*link)->next) {
+        if (*link == archive) {
+            *link = archive->next;
+            archive->next = NULL;
+            return;
+        }
+    }
+}
+
+void archive_mount(page_archive *archive) {
+    pthread_mutex_lock(&mount_lock);
+    if (archive->mounts++ == 0) {
+        retain(archive);
+        archive->next = mounted;
+        mounted = archive;
+    }
+    pthread_mutex_unlock(&mount_lock);
+}
+
+void archive_unmount(page_archive *archive) {
+    if (!archive) return;
+    pthread_mutex_lock(&mount_lock);
+    int last = archive->mounts > 0 && --archive->mounts == 0;
+    if (last) unlink_mount(archive);
+    pthread_mutex_unlock(&mount_lock);
+    if (last) archive_close(archive);
+}
+
+void archive_unmount_all() {
+    pthread_mutex_lock(&mount_lock);
+    page_archive *list = mounted;
+    mounted = NULL;
+    for (page_archive *a = list; a; a = a->next) a->mounts = 0;
+    pthread_mutex_unlock(&mount_lock);
+    while (list) {
+        page_archive *next = list->next;
+        list->next = NULL;
+        archive_close(list);
+        list = next;
+    }
+}
+
+static page_archive* find_mounted_path(const char *path) {
+    for (page_archive *a = mounted; a; a = a->next) {
+        if (a->path && strcmp(a->path, path) == 0) return a;
+    }
+    return NULL;
+}
+
+int offline_open(const parsed_url *target, offline_resource *out) {
+    memset(out, 0, sizeof(*out));
+
+    if (url_is_file(target)) {
+        char path[URL_MAX];
+        if (file_url_path(target, path, sizeof(path)) != 0) return -1;
+
+        pthread_mutex_lock(&mount_lock);
+        page_archive *archive = find_mounted_path(path);
+        if (archive) {
+            archive->mounts++;
+            retain(archive);
+        }
+        pthread_mutex_unlock(&mount_lock);
+
+        if (!archive) {
+            if (map_file(path, &out->file) != 0) return -1;
+            archive = archive_from_map(&out->file);
+            if (!archive) {
+                out->data = out->file.data;
+                out->len = out->file.len;
+                out->type = guess_type(path);
+                out->url = *target;
+                return 0;
+            }
+            printf("mounted page archive %s\n", path);
+            archive->path = strdup(path);
+            archive_mount(archive);
+        }
+
+        out->archive = archive;
+        out->mounted = 1;
+        if (url_parse(archive_document_url(archive), &out->url) != 0) {
+            offline_release(out);
+            return -1;
+        }
+        entry_view(archive, &archive->entries[archive->header->document], &out->data, &out->len, &out->type);
+        return 0;
+    }
+
+    char key[URL_MAX];
+    url_format(target, key, sizeof(key));
+    int found = -1;
+    pthread_mutex_lock(&mount_lock);
+    for (page_archive *a = mounted; a && found != 0; a = a->next) {
+        found = archive_find(a, key, &out->data, &out->len, &out->type);
+        if (found == 0) {
+            retain(a);
+            out->archive = a;
+        }
+    }
+    pthread_mutex_unlock(&mount_lock);
+    if (found == 0) out->url = *target;
+    return found;
+}
+
+page_archive* offline_keep_mount(offline_resource *res) {
+    if (!res->mounted) return NULL;
+    page_archive *archive = res->archive;
+    res->mounted = 0;
+    res->archive = NULL;
+    return archive;
+}
+
+void archive_release_mount(page_archive *archive) {
+    if (!archive) return;
+    archive_unmount(archive);
+    archive_close(archive);
+}
+
+void offline_release(offline_resource *res) {
+    if (res->mounted) archive_unmount(res->archive);
+    archive_close(res->archive);
+    res->archive = NULL;
+    res->mounted = 0;
+    unmap_file(&res->file);
+    res->data = NULL;
+    res->len = 0;
+}
+
+const char* archive_record_path() {
+    const char *path = getenv("BROWSER_SAVE_ARCHIVE");
+    return path && *path ? path : NULL;
+}
+
+static void clear_records() {
+    for (int i = 0; i < record_count; i++) {
+        free(records[i].url);
+        free(records[i].type);
+        free(records[i].data);
+    }
+    record_count = 0;
+}
+
+void archive_record_begin() {
+    pthread_mutex_lock(&record_lock);
+    clear_records();
+    record_active = 1;
+    pthread_mutex_unlock(&record_lock);
+}
+
+int archive_recording() {
+    pthread_mutex_lock(&record_lock);
+    int active = record_active;
+    pthread_mutex_unlock(&record_lock);
+    return active;
+}
+
+void archive_record(const char *url, const char *type, const char *data, size_t len) {
+    pthread_mutex_lock(&record_lock);
+    int known = 0;
+    for (int i = 0; i < record_count && !known; i++) known = strcmp(records[i].url, url) == 0;
+    if (record_active && !known && record_count < RECORD_MAX) {
+        record_entry *r = &records[record_count++];
+        r->url = strdup(url);
+        r->type = strdup(type ? type : "application/octet-stream");
+        r->data = malloc(len ? len : 1);
+        memcpy(r->data, data, len);
+        r->len = len;
+    }
+    pthread_mutex_unlock(&record_lock);
+}
+
+static int compare_records(const void *a, const void *b) {
+    return strcmp(((const record_entry*)a)->url, ((const record_entry*)b)->url);
+}
+
+static uint32_t pool_add(char **pool, size_t *size, size_t *cap, const char *s) {
+    size_t len = strlen(s) + 1;
+    if (*size + len > *cap) {
+        while (*size + len > *cap) *cap = *cap ? *cap * 2 : 4096;
+        *pool = realloc(*pool, *cap);
+    }
+    uint32_t offset = (uint32_t)*size;
+    memcpy(*pool + *size, s, len);
+    *size += len;
+    return offset;
+}
+
+int archive_record_end(const char *document_url, const char *path) {
+    TRACE_SCOPE("archive.write");
+    pthread_mutex_lock(&record_lock);
+    record_active = 0;
+    qsort(records, record_count, sizeof(record_entry), compare_records);
+
+    int document = -1;
+    for (int i = 0; i < record_count && document < 0; i++) {
+        if (strcmp(records[i].url, document_url) == 0) document = i;
+    }
+    if (document < 0) {
+        clear_records();
+        pthread_mutex_unlock(&record_lock);
+        return -1;
+    }
+
+    archive_entry *entries = calloc(record_count, sizeof(archive_entry));
+    char *pool = NULL;
+    size_t pool_size = 0, pool_cap = 0;
+
+    archive_header h = {0};
+    memcpy(h.magic, ARCHIVE_MAGIC, 4);
+    h.version = ARCHIVE_VERSION;
+    h.header_size = sizeof(archive_header);
+    h.entry_count = record_count;
+    h.document = document;
+    h.document_url = pool_add(&pool, &pool_size, &pool_cap, document_url);
+    for (int i = 0; i < record_count; i++) {
+        entries[i].url = pool_add(&pool, &pool_size, &pool_cap, records[i].url);
+        entries[i].type = pool_add(&pool, &pool_size, &pool_cap, records[i].type);
+    }
+    h.entry_offset = sizeof(archive_header);
+    h.pool_offset = h.entry_offset + (uint64_t)record_count * sizeof(archive_entry);
+    h.pool_size = pool_size;
+
+    uint64_t offset = h.pool_offset + pool_size;
+    for (int i = 0; i < record_count; i++) {
+        entries[i].offset = offset;
+        entries[i].length = records[i].len;
+        offset += records[i].len;
+    }
+
+    char tmp_path[1024];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    FILE *f = fopen(tmp_path, "wb");
+    int ok = f != NULL;
+    ok = ok && fwrite(&h, sizeof(h), 1, f) == 1;
+    ok = ok && fwrite(entries, sizeof(archive_entry), record_count, f) == (size_t)record_count;
+    ok = ok && fwrite(pool, 1, pool_size, f) == pool_size;
+    for (int i = 0; ok && i < record_count; i++) ok = fwrite(records[i].data, 1, records[i].len, f) == records[i].len;
+    if (f) ok = (fclose(f) == 0) && ok;
+    if (!ok || rename(tmp_path, path) != 0) {
+        unlink(tmp_path);
+        ok = 0;
+    }
+
+    if (ok) printf("saved page archive with %d entries to %s\n", record_count, path);
+    clear_records();
+    pthread_mutex_unlock(&record_lock);
+    free(entries);
+    free(pool);
+    return ok ? 0 : -1;
+}
@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <pthread.h>
+#include <netdb.h>
+#include "dns.h"
+#include "url.h"
+#include "trace.h"
+
+#define DNS_CACHE_SIZE 64
+#define DNS_QUEUE_SIZE 32
+#define DNS_WORKERS 2
+
+typedef enum {
+    DNS_EMPTY,
+    DNS_PENDING,
+    DNS_RESOLVED,
+    DNS_FAILED
+} dns_state;
+
+typedef struct {
+    char host[URL_HOST_MAX];
+    dns_state state;
+    int started;
+    double expires;
+    double last_used;
+    dns_result result;
+} dns_entry;
+
+static dns_entry cache[DNS_CACHE_SIZE];
+static char queue[DNS_QUEUE_SIZE][URL_HOST_MAX];
+static int queue_head = 0;
+static int queue_count = 0;
+static int stopping = 0;
+
+static pthread_mutex_t dns_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t dns_resolved = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t dns_queued = PTHREAD_COND_INITIALIZER;
+static pthread_once_t workers_once = PTHREAD_ONCE_INIT;
+static pthread_t workers[DNS_WORKERS];
+static int worker_count = 0;
+
+static double positive_ttl = 60;
+static double negative_ttl = 5;
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double env_seconds(const char *name, double def) {
+    const char *val = getenv(name);
+    if (!val || atof(val) < 0) return def;
+    return atof(val);
+}
+
+static dns_entry* find_entry(const char *host) {
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        if (cache[i].state != DNS_EMPTY && strcasecmp(cache[i].host, host) == 0) return &cache[i];
+    }
+    return NULL;
+}
+
+static dns_entry* claim_entry(const char *host) {
+    dns_entry *victim = NULL;
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        if (cache[i].state == DNS_EMPTY) { victim = &cache[i]; break; }
+        if (cache[i].state == DNS_PENDING) continue;
+        if (!victim || cache[i].last_used < victim->last_used) victim = &cache[i];
+    }
+    if (!victim) return NULL;
+
+    memset(victim, 0, sizeof(*victim));
+    strncpy(victim->host, host, URL_HOST_MAX - 1);
+    victim->state = DNS_PENDING;
+    victim->last_used = now_seconds();
+    return victim;
+}
+
+static int entry_fresh(const dns_entry *e, double now) {
+    return (e->state == DNS_RESOLVED || e->state == DNS_FAILED) && e->expires > now;
+}
+
+static int lookup(const char *host, dns_result *out) {
+    struct addrinfo hints, *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_ADDRCONFIG;
+
+    TRACE_SCOPE("dns.lookup");
+    memset(out, 0, sizeof(*out));
+    if (getaddrinfo(host, NULL, &hints, &res) != 0) return -1;
+
+    struct addrinfo *v6[DNS_MAX_ADDRS], *v4[DNS_MAX_ADDRS];
+    int n6 = 0, n4 = 0;
+    int prefer6 = res->ai_family == AF_INET6;
+    for (struct addrinfo *ai = res; ai; ai = ai->ai_next) {
+        if (ai->ai_family == AF_INET6 && n6 < DNS_MAX_ADDRS) v6[n6++] = ai;
+        else if (ai->ai_family == AF_INET && n4 < DNS_MAX_ADDRS) v4[n4++] = ai;
+    }
+
+    int i6 = 0, i4 = 0;
+    while (out->count < DNS_MAX_ADDRS && (i6 < n6 || i4 < n4)) {
+        int take6 = (i6 < n6) && (i4 >= n4 || (out->count % 2 == 0) == prefer6);
+        struct addrinfo *ai = take6 ? v6[i6++] : v4[i4++];
+        memcpy(&out->addrs[out->count], ai->ai_addr, ai->ai_addrlen);
+        out->lens[out->count] = ai->ai_addrlen;
+        out->count++;
+    }
+    freeaddrinfo(res);
+    return out->count > 0 ? 0 : -1;
+}
+
+static void store_result(const char *host, const dns_result *result, int ok) {
+    pthread_mutex_lock(&dns_lock);
+    dns_entry *e = find_entry(host);
+    if (e) {
+        e->state = ok ? DNS_RESOLVED : DNS_FAILED;
+        e->expires = now_seconds() + (ok ? positive_ttl : negative_ttl);
+        e->result = *result;
+    }
+    pthread_cond_broadcast(&dns_resolved);
+    pthread_mutex_unlock(&dns_lock);
+}
+
+static void* worker_main(void *arg) {
+    (void)arg;
+    char host[URL_HOST_MAX];
+    dns_result result;
+
+    pthread_mutex_lock(&dns_lock);
+    while (!stopping) {
+        if (queue_count == 0) {
+            pthread_cond_wait(&dns_queued, &dns_lock);
+            continue;
+        }
+        memcpy(host, queue[queue_head], URL_HOST_MAX);
+        queue_head = (queue_head + 1) % DNS_QUEUE_SIZE;
+        queue_count--;
+
+        dns_entry *e = find_entry(host);
+        if (!e || e->state != DNS_PENDING || e->started) continue;
+        e->started = 1;
+        pthread_mutex_unlock(&dns_lock);
+
+        int ok = lookup(host, &result) == 0;
+        store_result(host, &result, ok);
+
+        pthread_mutex_lock(&dns_lock);
+    }
+    pthread_mutex_unlock(&dns_lock);
+    return NULL;
+}
+
+static void start_workers() {
+    positive_ttl = env_seconds("BROWSER_DNS_TTL", positive_ttl);
+    negative_ttl = env_seconds("BROWSER_DNS_NEGATIVE_TTL", negative_ttl);
+    for (int i = 0; i < DNS_WORKERS; i++) {
+        if (pthread_create(&workers[worker_count], NULL, worker_main, NULL) == 0) worker_count++;
+    }
+}
+
+int dns_resolve(const char *host, dns_result *out) {
+    pthread_once(&workers_once, start_workers);
+
+    pthread_mutex_lock(&dns_lock);
+    dns_entry *e = find_entry(host);
+    while (e && e->state == DNS_PENDING && e->started) {
+        pthread_cond_wait(&dns_resolved, &dns_lock);
+        e = find_entry(host);
+    }
+
+    double now = now_seconds();
+    if (e && entry_fresh(e, now)) {
+        e->last_used = now;
+        int ok = e->state == DNS_RESOLVED;
+        if (ok) *out = e->result;
+        pthread_mutex_unlock(&dns_lock);
+        return ok ? 0 : -1;
+    }
+
+    if (!e) e = claim_entry(host);
+    else e->state = DNS_PENDING;
+    if (e) e->started = 1;
+    pthread_mutex_unlock(&dns_lock);
+
+    int ok = lookup(host, out) == 0;
+    if (e) store_result(host, out, ok);
+    return ok ? 0 : -1;
+}
+
+void dns_prefetch(const char *host) {
+    if (!host || !*host || strlen(host) >= URL_HOST_MAX) return;
+    pthread_once(&workers_once, start_workers);
+
+    pthread_mutex_lock(&dns_lock);
+    dns_entry *e = find_entry(host);
+    if (e && (e->state == DNS_PENDING || entry_fresh(e, now_seconds()))) {
+        pthread_mutex_unlock(&dns_lock);
+        return;
+    }
+    if (queue_count < DNS_QUEUE_SIZE) {
+        if (!e) e = claim_entry(host);
+        else e->state = DNS_PENDING;
+        if (e) {
+            e->started = 0;
+            strcpy(queue[(queue_head + queue_count) % DNS_QUEUE_SIZE], host);
+            queue_count++;
+            pthread_cond_signal(&dns_queued);
+        }
+    }
+    pthread_mutex_unlock(&dns_lock);
+}
+
+void dns_prefetch_url(const char *url) {
+    if (!url) return;
+    if (strncasecmp(url, "http://", 7) != 0 && strncasecmp(url, "https://", 8) != 0 && strncmp(url, "//", 2) != 0) return;
+
+    parsed_url parsed;
+    if (url_parse(url, &parsed) == 0) dns_prefetch(parsed.host);
+}
+
+void dns_shutdown() {
+    pthread_mutex_lock(&dns_lock);
+    stopping = 1;
+    pthread_cond_broadcast(&dns_queued);
+    pthread_mutex_unlock(&dns_lock);
+    for (int i = 0; i < worker_count; i++) pthread_join(workers[i], NULL);
+    worker_count = 0;
+}
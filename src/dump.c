@@ -0,0 +1,175 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "dump.h"
+#include "trace.h"
+
+typedef struct dump_item {
+    char *url;
+    char *kind;
+    char *data;
+    size_t len;
+    struct dump_item *next;
+} dump_item;
+
+static dump_item *queue_head = NULL;
+static dump_item *queue_tail = NULL;
+static int queued_items = 0;
+static size_t queued_bytes = 0;
+static int stopping = 0;
+static int dropped = 0;
+
+static pthread_mutex_t dump_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t dump_queued = PTHREAD_COND_INITIALIZER;
+static pthread_once_t writer_once = PTHREAD_ONCE_INIT;
+static pthread_t writer;
+static int writer_running = 0;
+
+static const char* dump_dir() {
+    const char *dir = getenv("BROWSER_DUMP_DIR");
+    return dir && *dir ? dir : "temp_assets";
+}
+
+static uint64_t fnv1a(const char *s, size_t len) {
+    uint64_t h = 1469598103934665603ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)s[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static void url_extension(const char *url, const char *kind, char *out, size_t size) {
+    const char *end = url + strcspn(url, "?#");
+    const char *dot = end;
+    while (dot > url && dot[-1] != '.' && dot[-1] != '/') dot--;
+    size_t len = end - dot;
+    if (dot > url && dot[-1] == '.' && len > 0 && len < size && len <= 5) {
+        memcpy(out, dot, len);
+        out[len] = '\0';
+        for (char *c = out; *c; c++) {
+            if (*c >= 'A' && *c <= 'Z') *c += 'a' - 'A';
+            else if (!((*c >= 'a' && *c <= 'z') || (*c >= '0' && *c <= '9'))) *c = '_';
+        }
+    } else {
+        snprintf(out, size, "%s", strcmp(kind, "document") == 0 ? "html" : "bin");
+    }
+}
+
+static void write_batch(dump_item *batch) {
+    TRACE_SCOPE("dump.write");
+    const char *dir = dump_dir();
+    mkdir(dir, 0700);
+
+    char index_path[1024];
+    snprintf(index_path, sizeof(index_path), "%s/index.tsv", dir);
+    FILE *index = fopen(index_path, "a");
+
+    for (dump_item *item = batch; item; item = item->next) {
+        char ext[8];
+        char path[1024];
+        char name[64];
+        url_extension(item->url, item->kind, ext, sizeof(ext));
+        snprintf(name, sizeof(name), "%016llx.%s", (unsigned long long)fnv1a(item->data, item->len), ext);
+        snprintf(path, sizeof(path), "%s/%s", dir, name);
+
+        struct stat st;
+        if (stat(path, &st) != 0 || (size_t)st.st_size != item->len) {
+            char tmp_path[1100];
+            snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+            FILE *f = fopen(tmp_path, "wb");
+            int ok = f && fwrite(item->data, 1, item->len, f) == item->len;
+            if (f) ok = (fclose(f) == 0) && ok;
+            if (!ok || rename(tmp_path, path) != 0) {
+                unlink(tmp_path);
+                printf("could not write %s\n", path);
+                continue;
+            }
+        }
+        if (index) fprintf(index, "%s\t%zu\t%s\t%ld\t%s\n", name, item->len, item->kind, (long)time(NULL), item->url);
+    }
+    if (index) fclose(index);
+}
+
+static void free_batch(dump_item *batch) {
+    while (batch) {
+        dump_item *next = batch->next;
+        free(batch->url);
+        free(batch->kind);
+        free(batch->data);
+        free(batch);
+        batch = next;
+    }
+}
+
+static void* writer_main(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&dump_lock);
+    while (1) {
+        while (!queue_head && !stopping) pthread_cond_wait(&dump_queued, &dump_lock);
+        if (!queue_head && stopping) break;
+
+        dump_item *batch = queue_head;
+        queue_head = queue_tail = NULL;
+        queued_items = 0;
+        queued_bytes = 0;
+        pthread_mutex_unlock(&dump_lock);
+
+        write_batch(batch);
+        free_batch(batch);
+
+        pthread_mutex_lock(&dump_lock);
+    }
+    pthread_mutex_unlock(&dump_lock);
+    return NULL;
+}
+
+static void start_writer() {
+    writer_running = pthread_create(&writer, NULL, writer_main, NULL) == 0;
+}
+
+void dump_submit(const char *url, const char *kind, const char *data, size_t len) {
+    pthread_once(&writer_once, start_writer);
+
+    dump_item *item = calloc(1, sizeof(dump_item));
+    item->url = strdup(url ? url : "");
+    item->kind = strdup(kind);
+    item->data = malloc(len ? len : 1);
+    memcpy(item->data, data, len);
+    item->len = len;
+
+    pthread_mutex_lock(&dump_lock);
+    int accepted = writer_running && !stopping && queued_items < DUMP_MAX_ITEMS && queued_bytes + len <= DUMP_MAX_BYTES;
+    if (accepted) {
+        if (queue_tail) queue_tail->next = item;
+        else queue_head = item;
+        queue_tail = item;
+        queued_items++;
+        queued_bytes += len;
+        pthread_cond_signal(&dump_queued);
+    } else {
+        dropped++;
+    }
+    pthread_mutex_unlock(&dump_lock);
+
+    if (!accepted) {
+        printf("dump queue full, not saving %s\n", item->url);
+        free_batch(item);
+    }
+}
+
+void dump_shutdown() {
+    pthread_mutex_lock(&dump_lock);
+    stopping = 1;
+    pthread_cond_signal(&dump_queued);
+    pthread_mutex_unlock(&dump_lock);
+    if (writer_running) pthread_join(writer, NULL);
+    writer_running = 0;
+    if (dropped) printf("dump writer dropped %d items\n", dropped);
+}
@@ -0,0 +1,4667 @@
+/* generated by tools/gen_entities.py from the HTML5 named character reference table; do not edit */
+#include <stdint.h>
+#include <string.h>
+#include "entities.h"
+
+#define ENTITY_SLOTS 4096
+#define ENTITY_BUCKETS 1024
+
+typedef struct {
+    uint16_t name_off;
+    uint8_t name_len;
+    uint16_t value_off;
+    uint8_t value_len;
+} entity_entry;
+
+static const char entity_names[] =
+    "Uacuteoopf;NotSquareSupersetEqual;sime;frac12vert;rharu;tfr;opar"
+    ";Kcedil;mfr;NotGreaterSlantEqual;PrecedesTilde;iprod;ngsim;lambd"
+    "a;leftleftarrows;rightleftharpoons;sube;NotPrecedesSlantEqual;rs"
+    "quo;minusdu;xfr;ltimes;Fcy;sup1twoheadleftarrow;thetav;circeq;ps"
+    "cr;kcy;Ffr;upharpoonright;Ncedil;lescc;frac18;bemptyv;lscr;raquo"
+    "dcaron;leftharpoonup;bsemi;gscr;DownLeftVector;vBarv;trianglerig"
+    "ht;div;eqslantgtr;sscr;nVDash;nLeftarrow;Nu;Nscr;Omega;nlt;nvge;"
+    "ddotseq;Verbar;vartriangleright;llarr;thkap;ReverseEquilibrium;x"
+    "hArr;plussim;macrvcy;mapstodown;zwj;gap;vsupne;euro;otildedsol;l"
+    "aquo;jcirc;ethensp;vrtri;otimesas;SOFTcy;apacir;odiv;ltrie;gsime"
+    ";iexcljfr;expectation;tcy;icircCHcy;rmoust;NJcy;prE;nsubseteqq;L"
+    "eftTeeArrow;notnivb;lnE;iecy;iota;Pi;lozenge;LeftRightArrow;kapp"
+    "av;rtimes;eg;Oumlrarrsim;NotGreaterFullEqual;awconint;esim;uogon"
+    ";QUOTneArr;rationals;bumpe;Square;boxvR;lrm;mldr;ljcy;cap;khcy;L"
+    "eftUpDownVector;boxV;Ufr;vopf;rfloor;Gamma;Fscr;Rarrtl;LeftUpVec"
+    "torBar;lBarr;els;Downarrow;DDotrahd;olcross;angmsdaa;RightTeeVec"
+    "tor;hkswarow;acute;hercon;FilledSmallSquare;iquestemsp13;Contour"
+    "Integral;copf;numero;DoubleRightArrow;mopf;swnwar;supsim;sigmav;"
+    "NotHumpDownHump;GreaterFullEqual;cfr;ogon;xuplus;CircleMinus;eop"
+    "f;vartheta;GreaterEqual;LeftAngleBracket;otimes;isinsv;Sopf;beca"
+    "us;boxur;lesseqqgtr;sup1;zfr;NotGreater;block;intlarhk;gjcy;vzig"
+    "zag;ccaron;Assign;lbrace;poundmidcir;UpperRightArrow;intprod;Qfr"
+    ";Ocircupdownarrow;LeftVectorBar;dtri;male;rarrtl;looparrowleft;N"
+    "otSupersetEqual;Because;curlyeqprec;uHar;Kfr;DiacriticalDot;isin"
+    "v;boxDR;Ascr;esdot;NotRightTriangleEqual;frac16;ntriangleright;t"
+    "scy;nvsim;hearts;subnE;ccedil;bprime;odot;csube;pluscir;num;ucy;"
+    "egrave;fpartint;napid;leftthreetimes;nrightarrow;heartsuit;curve"
+    "arrowleft;ncong;timesd;UnderBrace;pluse;SquareSuperset;curarrm;R"
+    "ightTriangleEqual;nedot;mcy;TSHcy;aogon;angmsdae;quotUpTee;Right"
+    "arrow;gsim;emsp14;capbrcup;LeftDoubleBracket;lfloor;ShortLeftArr"
+    "ow;dblac;cirmid;hstrok;times;geqslant;Vee;erarr;conint;Ccirc;tri"
+    "e;lmoust;gnE;semi;boxuL;RightArrowLeftArrow;varsubsetneqq;lurdsh"
+    "ar;roarr;ogt;frac12;leftharpoondown;rangle;Hat;RightDownVector;t"
+    "opbot;rarrap;nu;gvnE;Scirc;NegativeMediumSpace;eqcolon;ncongdot;"
+    "shortmid;copy;varkappa;equest;Lfr;Implies;Afr;boxtimes;race;Part"
+    "ialD;succsim;Uuml;LeftArrowBar;Fouriertrf;ord;nabla;ampExponenti"
+    "alE;nsupseteq;cuvee;Wedge;ntgl;NotTilde;reals;succ;lsim;LeftTee;"
+    "Igrave;lozf;mumap;nearr;Zcaron;triangledown;dwangle;ltri;dzigrar"
+    "r;natural;rbrkslu;nis;nsce;Dcy;phiv;frac56;forkv;circledcirc;isc"
+    "r;boxv;diams;rarrc;OgraveNotSucceedsTilde;nsimeq;Gopf;Tcy;supe;v"
+    "nsup;bsolb;map;succnsim;OpenCurlyDoubleQuote;easter;nharr;RuleDe"
+    "layed;fcy;ge;DoubleRightTee;boxvH;gtreqless;Element;infin;bopf;O"
+    "micron;mcomma;lsh;lesges;Colon;pitchfork;andand;NotVerticalBar;F"
+    "illedVerySmallSquare;aacuteGreaterLess;ecir;zcaron;rightthreetim"
+    "es;ruluhar;dscr;notinvc;rarrw;nges;aeligtritime;Xfr;lsqb;ldquo;B"
+    "arv;gtrless;harr;gtrsim;divonx;ecirc;lsquo;nsim;rAtail;boxvr;nsm"
+    "id;bump;diamond;blank;spar;gtrarr;LessSlantEqual;iiota;Uring;big"
+    "vee;ltcir;lacute;uml;Breve;Vcy;yacy;ShortDownArrow;preccurlyeq;l"
+    "at;Scy;curlyvee;sqcup;nsupE;UnderParenthesis;gesl;bcong;Rcedil;c"
+    "irc;nexists;nearhk;centerdot;lAtail;acirc;lbrke;subseteq;nsube;U"
+    "pArrowBar;lnsim;UpArrowDownArrow;tridot;equivDD;cudarrl;mu;rrarr"
+    ";robrk;Hfr;biguplus;DoubleDownArrow;clubsuit;Sqrt;bowtie;excl;Ug"
+    "ravefflig;dtdot;rHar;YIcy;MediumSpace;nwarhk;RightFloor;Chi;Zopf"
+    ";nesear;Qopf;larrtl;ntlg;Equilibrium;backsim;uacute;Iscr;prnE;al"
+    "efsym;Ucy;Vbar;ccedilolarr;LeftArrow;spadesuit;DotEqual;nleq;box"
+    "dR;prsim;lobrk;varsupsetneq;gt;diamondsuit;IumlJsercy;nrtrie;low"
+    "bar;oslash;nfr;cent;GreaterEqualLess;iacuteltquest;Ucircsopf;brv"
+    "barllcorner;icirc;odsold;DownTee;intcal;tprime;lfisht;plusdu;Esi"
+    "m;Vopf;uArr;blk34;currenPlusMinus;plusdo;ring;NotTildeEqual;agra"
+    "ve;Imacr;sigma;gesdot;langd;middot;tshcy;uscr;NotSubset;npart;rb"
+    "rke;smte;csup;NotHumpEqual;angmsd;Ecaron;late;isinE;because;le;s"
+    "quarf;Ecircggg;rthree;oacutesqsupset;EqualTilde;squf;subE;gtcc;l"
+    "cy;geq;triangleleft;target;gne;gbreve;nisd;reg;vsubnE;backepsilo"
+    "n;Cup;Lsh;ufr;rho;micro;complement;RightUpVector;Sfr;ordfdd;Zfr;"
+    "nvlt;gdot;NotNestedLessLess;rsh;NotLeftTriangleBar;sqcap;uumlrbr"
+    "ksld;yacutexsqcup;nltri;uparrow;auml;omacr;imacr;LeftTriangleBar"
+    ";CapitalDifferentialD;simrarr;racute;eDot;angsph;GreaterGreater;"
+    "bull;roang;precnsim;frac38;oror;lneq;abreve;nscr;LongRightArrow;"
+    "plankv;notindot;shcy;eogon;boxbox;sccue;kopf;blacktriangledown;i"
+    "umlwedgeq;TildeFullEqual;dollar;homtht;capcup;Ycirc;iquest;ltrPa"
+    "r;LeftDownVectorBar;pr;qopf;nbsp;simeq;lnapprox;Egraveocirc;npar"
+    ";Lcy;tcaron;bkarow;iinfin;swarrow;NotReverseElement;Mopf;Tab;pho"
+    "ne;LeftDownTeeVector;imof;triangle;Yuml;euml;sup2ascr;xharr;isin"
+    "dot;NotRightTriangleBar;tint;zeta;nGt;ncy;NotLessTilde;Proportio"
+    "nal;ell;rbarr;VDash;Jfr;Ycy;nvDash;NotLessGreater;nbump;aacute;l"
+    "aemptyv;Aacute;RoundImplies;nrarr;phi;sc;eqvparsl;supsup;rtriltr"
+    "i;Kcy;iacute;NotTildeFullEqual;zacute;angmsdah;numsp;simg;lessgt"
+    "r;SHCHcy;ldca;Lmidot;Sacute;curlyeqsucc;lbarr;DownLeftVectorBar;"
+    "LeftFloor;lE;jcy;rpargt;xotime;hookrightarrow;Itilde;Sum;supset;"
+    "wfr;uhblk;theta;Union;nsubE;frac25;lrcorner;Succeeds;sdotb;sqsup"
+    "e;cupor;LeftVector;lharu;lfr;dividezigrarr;ordmuacuteYacute;Vdas"
+    "h;deg;varsubsetneq;middotominus;rx;ngtr;demptyv;THORNSquareSuper"
+    "setEqual;gnapprox;nvgt;Pfr;glE;nleqq;nearrow;IgraveSmallCircle;r"
+    "aquo;RightCeiling;grave;Tfr;kgreen;simplus;Dashv;utdot;rtrif;Uti"
+    "lde;approx;scE;lg;nGtv;eparsl;topfork;Eogon;ETH;lbrack;NotSquare"
+    "Subset;vfr;boxhd;lesg;ange;geqq;it;gesdoto;xrarr;vartriangleleft"
+    ";hcirc;yenOgrave;lthree;kscr;nhArr;rightrightarrows;NotPrecedes;"
+    "TildeTilde;scirc;sfr;wp;icy;rarrpl;Uarrocir;or;gtcir;nvrArr;Lamb"
+    "da;Atilde;pointint;Iogon;bnequiv;nsupset;Eopf;AMPUpsilon;rceil;l"
+    "ceil;odblac;prnap;yucy;angmsdab;xutri;varepsilon;capdot;CircleDo"
+    "t;les;Xopf;wreath;Colone;UnionPlus;blacktriangleright;Acy;Omacr;"
+    "cedilNestedLessLess;ccupssm;Iukcy;udhar;supsetneqq;leg;eqcirc;nl"
+    "eftrightarrow;ubreve;ZHcy;rscr;gcy;rarrhk;hairsp;coloneq;DD;Less"
+    "FullEqual;supdot;primes;dharl;nexist;dlcorn;ocir;sdot;GTrnmid;No"
+    "tLessSlantEqual;xcap;searhk;gtrdot;ForAll;Vert;NotDoubleVertical"
+    "Bar;Alpha;blk12;coprod;harrcir;Subset;supE;OverBrace;mlcp;ntrian"
+    "glelefteq;nrArr;ges;DiacriticalAcute;Sub;ratail;shy;subrarr;nsc;"
+    "ImaginaryI;sup3NotElement;Iota;DoubleVerticalBar;rlm;Zacute;Lced"
+    "il;Dscr;rarr;nbumpe;yscr;divide;nvlArr;xodot;rangd;egsdot;shytho"
+    "rn;NotSuperset;Zcy;commat;NotGreaterLess;iiint;Ubrcy;rcaron;acd;"
+    "Ocirc;cwconint;xopf;IEcy;elsdot;lap;ShortUpArrow;vscr;rlarr;lang"
+    ";Gscr;marker;loplus;urcorner;Phi;bfr;Kopf;thornangrt;varsupsetne"
+    "qq;models;yumlCounterClockwiseContourIntegral;SquareUnion;blacks"
+    "quare;gesles;NotRightTriangle;aelig;eplus;longmapsto;Euml;mDDot;"
+    "frac34wcirc;xvee;triangleq;wedge;NotSucceedsSlantEqual;urcorn;mh"
+    "o;searr;jukcy;amp;inodot;boxH;Integral;hslash;sqsube;LessTilde;c"
+    "irclearrowright;NotSubsetEqual;mapsto;cacute;origof;lopar;prime;"
+    "SquareSubset;nequiv;circledast;looparrowright;boxHD;jsercy;lsimg"
+    ";cylcty;varpi;Ifr;Aacutegammad;NewLine;lesdot;barwed;Udblac;Lscr"
+    ";multimap;DJcy;ddagger;LeftTriangleEqual;rdquo;egravefrac34;AMP;"
+    "jscr;UpDownArrow;brvbar;alpha;oS;PrecedesSlantEqual;Eacute;NotNe"
+    "stedGreaterGreater;ltdot;dash;ne;olcir;triminus;siml;rarrbfs;Rop"
+    "f;iiiint;lvertneqq;bbrktbrk;asymp;CcedilVerticalTilde;Psi;realpa"
+    "rt;profline;Agrave;Copf;hybull;pertenk;hksearow;nlsim;xmap;setmn"
+    ";zdot;xdtri;Efr;Cscr;ouml;minusb;gtldrdhar;DownTeeArrow;Laplacet"
+    "rf;NegativeVeryThinSpace;copychi;InvisibleTimes;fscr;Ntildestrns"
+    ";delta;dotminus;notinvb;UpEquilibrium;Acircutri;Edot;Aring;Map;D"
+    "Scy;notrightleftarrows;period;Lang;lesdotor;ffllig;hopf;amalg;sq"
+    "cups;Rcy;Scaron;LowerLeftArrow;el;RightVectorBar;NegativeThickSp"
+    "ace;frac58;nLt;Sscr;sqsup;NotEqualTilde;Rcaron;tstrok;vprop;smte"
+    "s;between;Gbreve;dscy;thksim;nshortparallel;Ouml;boxminus;DZcy;L"
+    "eftrightarrow;ac;gla;egs;epar;eDDot;upuparrows;ntrianglerighteq;"
+    "bepsi;chcy;cupbrcap;kcedil;timesb;lessapprox;larrpl;Emacr;filig;"
+    "gnsim;dfr;ltcc;Ocy;rightharpoonup;udblac;propto;shortparallel;ul"
+    "tri;sqsubseteq;bigodot;para;Re;DoubleContourIntegral;Tcedil;acir"
+    "cbsim;sim;Dopf;lowast;csupe;OverParenthesis;fltns;qfr;lcub;subne"
+    ";yfr;frac13;drbkarow;lrarr;npre;LJcy;varr;Tstrok;kjcy;imped;back"
+    "simeq;RightArrowBar;drcorn;fallingdotseq;boxDL;oplus;subedot;dop"
+    "f;Odblac;bigstar;nLl;dharr;utilde;lesseqgtr;Bumpeq;zopf;Aumlropf"
+    ";sung;rcy;Or;copysr;EumlHumpEqual;Fopf;bdquo;empty;nge;nmid;nle;"
+    "hellip;caps;frac35;vellip;nGg;NonBreakingSpace;sqsub;gimel;cdot;"
+    "DoubleLeftArrow;submult;Larr;wr;lates;elinters;napprox;oline;Sup"
+    ";LeftRightVector;boxVl;oslashdotplus;glj;yen;Cfr;nltrie;plus;cup"
+    "cap;EmptyVerySmallSquare;psi;preceq;gesdotol;npr;real;YAcy;zscr;"
+    "eacutepre;ofcir;VerticalBar;lne;tau;divideontimes;Backslash;atil"
+    "deerDot;apE;lagran;square;parsl;leftrightarrows;NotSucceedsEqual"
+    ";supmult;ntriangleleft;NotSucceeds;Yopf;raemptyv;ycy;sce;circled"
+    "S;nsucceq;OverBar;Uacute;rArr;scaron;ecy;ugrave;ulcorn;Coproduct"
+    ";oacute;lesssim;sacute;wscr;Star;boxVr;ThinSpace;ograve;OpenCurl"
+    "yQuote;Lt;bigoplus;Iuml;TScy;rsqb;nRightarrow;NegativeThinSpace;"
+    "IcircUopf;mnplus;fjlig;Aopf;leqslant;timesfrac14succeq;rdldhar;l"
+    "drushar;GreaterTilde;paraSuchThat;doteq;notnivc;isins;nparallel;"
+    "check;nrarrc;tosa;Therefore;subsim;EmptySmallSquare;RightUpVecto"
+    "rBar;uharr;rharul;apos;cularrp;rbbrk;Oslashtcedil;VerticalSepara"
+    "tor;ovbar;leftrightarrow;Lcaron;Rsh;REG;afr;nsccue;longleftarrow"
+    ";niv;squ;RightDownTeeVector;boxvh;ntildeigrave;KJcy;SupersetEqua"
+    "l;upharpoonleft;cirfnint;trisb;TripleDot;Congruent;rhov;ordm;Nac"
+    "ute;downdownarrows;npreceq;YacuteProportion;prop;Jcy;Ucirc;leqq;"
+    "bigotimes;Ccedil;VerticalLine;sup;xcup;circlearrowleft;subsup;td"
+    "ot;nvap;topcir;lcedil;exist;supplus;InvisibleComma;quaternions;n"
+    "larr;ulcorner;thicksim;napE;xcirc;Gammad;CirclePlus;NotEqual;Zet"
+    "a;measuredangle;horbar;rcub;curlywedge;notinE;suphsub;scnsim;gfr"
+    ";rarrlp;NotPrecedesEqual;larrbfs;precneqq;int;LT;gtreqqless;duar"
+    "r;congdot;triplus;Popf;NotGreaterTilde;Intersection;prod;NotCupC"
+    "ap;nvdash;compfn;ecircRarr;upsi;rightarrow;natur;frown;Auml;equi"
+    "v;lhard;lbrkslu;boxHu;crarr;Ecirc;Qscr;longrightarrow;SHcy;black"
+    "lozenge;xoplus;Kscr;boxUr;nsime;larrsim;Bcy;xlarr;Not;GreaterSla"
+    "ntEqual;gcirc;clubs;lpar;IJlig;ShortRightArrow;mapstoup;boxdL;xn"
+    "is;boxDr;naturals;cirscir;downharpoonright;order;ngeqq;TildeEqua"
+    "l;quatint;supseteqq;Upsi;nsub;xlArr;in;beta;frac78;lessdot;And;b"
+    "ottom;Escr;Zscr;Lleftarrow;lharul;sum;telrec;apid;nrarrw;bigtria"
+    "ngledown;DoubleDot;dotsquare;nVdash;ngE;vltri;nlE;oint;SucceedsT"
+    "ilde;Cedilla;Yfr;parsim;bbrk;gtlPar;sigmaf;Int;subset;iukcy;Diac"
+    "riticalTilde;angle;Hopf;qint;diam;NotLeftTriangleEqual;emsp;sdot"
+    "e;SquareSubsetEqual;lArr;Aringlmidot;Hcirc;cwint;ClockwiseContou"
+    "rIntegral;Vvdash;szligangrtvbd;lt;boxVh;radic;kfr;Xi;Gt;boxhu;jo"
+    "pf;jmath;Tau;bullet;lstrok;Gg;luruhar;Uarr;aopf;lEg;sfrown;Jscr;"
+    "Gcedil;VeryThinSpace;bot;DownArrow;Topf;sstarf;sub;scnE;supne;Io"
+    "pf;emacr;Nopf;Lopf;boxhU;DoubleLeftTee;bcy;Wfr;eumltrianglelefte"
+    "q;umacr;boxVR;srarr;subseteqq;latail;sqsupseteq;uharl;top;Oacute"
+    "Bscr;NotLessLess;Otildescy;eqslantless;RightTriangleBar;itilde;f"
+    "nof;varpropto;OElig;mstpos;Tcaron;dot;Pr;lrtri;Hscr;iff;seArr;La"
+    "cute;supsub;sbquo;nwnear;UnderBracket;veeeq;RightTriangle;rbrace"
+    ";nsubseteq;and;ccups;subsetneqq;Iacute;Cdot;prcue;Updownarrow;ee"
+    ";Otimes;COPYharrw;nleftarrow;Oacute;vee;ccaps;RightDoubleBracket"
+    ";imagline;prnsim;ecolon;ll;umlcscr;bumpE;lotimes;ifr;barvee;poun"
+    "d;boxdr;Supset;downharpoonleft;GJcy;Theta;nwarrow;boxVL;star;ang"
+    "zarr;Otilde;Bfr;cedil;odash;gsiml;nbspCOPY;UnderBar;oumlgl;drcro"
+    "p;boxHU;YUcy;emptyset;rightarrowtail;not;edot;lvnE;parallel;nspa"
+    "r;utrif;hfr;complexes;slarr;Rho;dcy;NotLessEqual;cupdot;prurel;N"
+    "estedGreaterGreater;capand;NotGreaterGreater;zeetrf;profalar;App"
+    "lyFunction;gacute;af;njcy;backprime;supdsub;Xscr;Uscr;ubrcy;nsup"
+    "e;CenterDot;ZeroWidthSpace;nsucc;llhard;fork;notin;rcedil;boxhD;"
+    "REGLeftarrow;ucirciogon;questeq;ofr;iopf;QUOT;simlE;boxUl;laquoc"
+    "uwed;ReverseUpEquilibrium;gescc;Jcirc;langle;infintie;ncaron;ltr"
+    "if;vsubne;fopf;nvle;capcap;epsiv;ni;Abreve;Tscr;lcaron;starf;suc"
+    "cnapprox;Beta;hyphen;RightDownVectorBar;perp;nleqslant;smt;cup;d"
+    "igamma;bigwedge;frac14;lparlt;leftrightsquigarrow;gopf;suphsol;b"
+    "igcup;veebar;vDash;smashp;equals;nap;forall;uring;rightsquigarro"
+    "w;ape;rhard;asympeq;Longleftrightarrow;dtrif;boxh;Longleftarrow;"
+    "cups;olt;cemptyv;UpArrow;lbrksld;mid;Amacr;mdash;permil;angmsdad"
+    ";NotSquareSubsetEqual;varrho;quot;notniva;gE;plusacir;scedil;ii;"
+    "larrhk;twixt;ocircLessLess;exponentiale;backcong;nvrtrie;percnt;"
+    "sect;uuarr;ecaron;LongLeftRightArrow;gel;shchcy;boxUL;dHar;Dcaro"
+    "n;scsim;daleth;Wscr;notinva;Rang;rdca;Exists;ntilde;bnot;tilde;f"
+    "llig;boxdl;simdot;UpTeeArrow;Wopf;ncap;isin;CloseCurlyDoubleQuot"
+    "e;Wcirc;ufisht;ffr;boxVH;smeparsl;scnap;NotSquareSuperset;yopf;q"
+    "prime;IOcy;subplus;epsi;HorizontalLine;nvHarr;rightharpoondown;O"
+    "scr;nLeftrightarrow;realine;iexcl;boxuR;cuepr;Ofr;vsupnE;Del;duh"
+    "ar;varnothing;cire;iocy;vBar;NotTildeTilde;precsim;rtri;therefor"
+    "e;Ubreve;gamma;nles;Vdashl;Dagger;part;disin;supsetneq;Mcy;djcy;"
+    "TRADE;rang;nesim;Rrightarrow;acE;succneqq;searrow;Dstrok;Eacuteu"
+    "arr;IacuteIcy;leftarrow;minusd;Gcirc;kappa;ldsh;ccirc;aringlarrl"
+    "p;uplus;CupCap;rdsh;loarr;Diamond;doteqdot;frac15;dArr;omicron;b"
+    "Not;LessEqualGreater;simne;eng;Jopf;orv;NotExists;DownRightVecto"
+    "r;phmmat;Gdot;LeftTriangle;ssmile;lsime;caron;cirE;straightepsil"
+    "on;lAarr;Aogon;GT;Nfr;Ecy;aleph;nsubset;quest;osol;agravevnsub;o"
+    "hm;Epsilon;Dot;yacute;hardcy;comp;dzcy;ddarr;LongLeftArrow;gEl;g"
+    "nap;female;lbbrk;hbar;nacute;twoheadrightarrow;ETHRBarr;Pscr;eta"
+    ";frac23;KHcy;smid;bigcap;RightArrow;nprec;nrtri;sectuuml;uopf;sw"
+    "arhk;beth;rtrie;NoBreak;planck;ltlarr;aumlweierp;lltri;SucceedsE"
+    "qual;piv;angmsdaf;aring;degandslope;LeftDownVector;Tilde;awint;n"
+    "apos;boxDl;Racute;NotCongruent;Lstrok;nldr;epsilon;darr;angmsdag"
+    ";curren;ENG;ffilig;rbrack;angmsdac;succcurlyeq;circledR;rdquor;s"
+    "setmn;swArr;minus;gvertneqq;Ncaron;OverBracket;nsqsube;Mellintrf"
+    ";longleftrightarrow;supnE;dfisht;DownLeftTeeVector;Gfr;gneqq;Dou"
+    "bleLongLeftRightArrow;plusb;midast;HumpDownHump;ngt;dlcrop;gtque"
+    "st;frasl;thinsp;SquareIntersection;qscr;trade;par;Acirc;hscr;nsq"
+    "supe;acy;oast;sup3;boxvL;vdash;prec;boxHd;wopf;udarr;ast;loz;Rig"
+    "htUpDownVector;yicy;DoubleLongRightArrow;RightVector;rotimes;Pro"
+    "duct;Egrave;DownArrowBar;half;Pcy;ijlig;Scedil;cupcup;Bopf;solba"
+    "r;DownBreve;pcy;Jukcy;orarr;nLtv;imath;setminus;frac45;boxul;top"
+    "f;Prime;DiacriticalDoubleAcute;Sc;bsime;escr;toea;Agraveeacute;s"
+    "uccapprox;downarrow;upsilon;boxplus;DoubleUpDownArrow;lneqq;scap"
+    ";lrhard;orderof;planckh;Poincareplane;range;colon;rfisht;urcrop;"
+    "Yscr;supedot;RightUpTeeVector;Idot;circleddash;wedbar;bernou;ulc"
+    "rop;maltese;RightAngleBracket;smallsetminus;Hacek;tbrk;ograveVfr"
+    ";DownRightTeeVector;xscr;Oopf;andd;mscr;ndash;simgE;efDot;cuesc;"
+    "seswar;boxUR;Hstrok;ycirc;rect;ngeqslant;atilde;Umacr;curarr;gne"
+    "q;lgE;rppolint;Kappa;lrhar;Zdot;Cacute;bigsqcup;yuml;boxvl;supse"
+    "teq;Delta;varsigma;ncup;DifferentialD;Superset;gg;RightTee;npars"
+    "l;operp;subdot;comma;omid;Atildexwedge;rarrb;dstrok;sharp;Mscr;n"
+    "ang;popf;prap;checkmark;ap;nsupseteqq;verbar;Dfr;iuml;sup2;tscr;"
+    "lesdoto;subsub;spades;mp;there4;zwnj;bne;uwangle;DownLeftRightVe"
+    "ctor;emptyv;LeftCeiling;oscr;ncedil;colone;Ugrave;dashv;NotGreat"
+    "erEqual;vangrt;microleftarrowtail;Uparrow;hamilt;Cconint;MinusPl"
+    "us;subsetneq;RightTeeArrow;leftrightharpoons;cularr;CloseCurlyQu"
+    "ote;HARDcy;caret;eqsim;Mfr;LTbsol;incare;smile;UumlAElig;lnap;Rf"
+    "r;image;Oslash;roplus;blk14;Im;Longrightarrow;nsup;nwArr;Succeed"
+    "sSlantEqual;breve;thickapprox;rmoustache;mapstoleft;cong;Cayleys"
+    ";blacktriangleleft;hArr;plusmn;LessGreater;scpolint;efr;cir;nopf"
+    ";SubsetEqual;timesbar;ldquor;swarr;nhpar;softcy;LeftUpTeeVector;"
+    "flat;LeftUpVector;nlArr;igravesqcaps;suplarr;NotLess;ThickSpace;"
+    "Conint;amacr;trpezium;npolint;ang;DownRightVectorBar;precapprox;"
+    "ohbar;zhcy;Vscr;bumpeq;angst;larrfs;intercal;sqsubset;rsquor;vAr"
+    "r;thetasym;varphi;loang;orslope;xi;straightphi;imagpart;rBarr;ug"
+    "ravebsolhsub;puncsp;NotLeftTriangle;rlhar;sext;Bernoullis;pm;and"
+    "v;ratio;notni;nvltrie;hookleftarrow;Ntilde;bigtriangleup;Mu;bigc"
+    "irc;approxeq;pi;larr;lopf;Equal;barwedge;LeftTeeVector;Icirc;oel"
+    "ig;larrb;rpar;zcy;rAarr;xrArr;rfr;hoarr;Cross;regCircleTimes;lHa"
+    "r;HilbertSpace;LowerRightArrow;ctdot;Uogon;pfr;rarrfs;DoubleLeft"
+    "RightArrow;centnwarr;dbkarow;ocy;Gcy;lmoustache;trianglerighteq;"
+    "DotDot;csub;solb;lhblk;nvinfin;Eta;Ncy;Ll;profsurf;leq;Sigma;cud"
+    "arrr;ngeq;acuteRscr;LeftArrowRightArrow;ReverseElement;DoubleLon"
+    "gLeftArrow;szlig;UpperLeftArrow;nshortmid;urtri;nless;ic;THORN;d"
+    "agger;gtrapprox;lsaquo;rsaquo;malt;die;ucirc;doublebarwedge;angr"
+    "tvb;DownArrowUpArrow;cross;Barwed;sol;ropar;upsih;AEligotilde;or"
+    "df;curvearrowright;integers;blacktriangle;lsquor;Darr;Precedes;e"
+    "th;ltbscr;plustwo;omega;plusmnprecnapprox;DoubleUpArrow;gtdot;Cc"
+    "aron;PrecedesEqual;risingdotseq;nprcue;macr;DiacriticalGrave;Cap"
+    ";"
+    ;
+
+static const char entity_values[] =
+    "\303\232\360\235\225\240\342\213\243\342\211\203\302\275\174\342\207\200\360\235\224\261\342\246\267\304\266\360\235\224\252\342"
+    "\251\276\314\270\342\211\276\342\250\274\342\211\265\316\273\342\207\207\342\207\214\342\212\206\342\213\240\342\200\231\342\250"
+    "\252\360\235\224\265\342\213\211\320\244\302\271\342\206\236\317\221\342\211\227\360\235\223\205\320\272\360\235\224\211\342\206"
+    "\276\305\205\342\252\250\342\205\233\342\246\260\360\235\223\201\302\273\304\217\342\206\274\342\201\217\342\204\212\342\206\275"
+    "\342\253\251\342\226\271\303\267\342\252\226\360\235\223\210\342\212\257\342\207\215\316\235\360\235\222\251\316\251\342\211\256"
+    "\342\211\245\342\203\222\342\251\267\342\200\226\342\212\263\342\207\207\342\211\210\342\207\213\342\237\272\342\250\246\302\257"
+    "\320\262\342\206\247\342\200\215\342\252\206\342\212\213\357\270\200\342\202\254\303\265\342\247\266\302\253\304\265\303\260\342"
+    "\200\202\342\212\263\342\250\266\320\254\342\251\257\342\250\270\342\212\264\342\252\216\302\241\360\235\224\247\342\204\260\321"
+    "\202\303\256\320\247\342\216\261\320\212\342\252\263\342\253\205\314\270\342\206\244\342\213\276\342\211\250\320\265\316\271\316"
+    "\240\342\227\212\342\206\224\317\260\342\213\212\342\252\232\303\226\342\245\264\342\211\247\314\270\342\210\263\342\211\202\305"
+    "\263\042\342\207\227\342\204\232\342\211\217\342\226\241\342\225\236\342\200\216\342\200\246\321\231\342\210\251\321\205\342\245"
+    "\221\342\225\221\360\235\224\230\360\235\225\247\342\214\213\316\223\342\204\261\342\244\226\342\245\230\342\244\216\342\252\225"
+    "\342\207\223\342\244\221\342\246\273\342\246\250\342\245\233\342\244\246\302\264\342\212\271\342\227\274\302\277\342\200\204\342"
+    "\210\256\360\235\225\224\342\204\226\342\207\222\360\235\225\236\342\244\252\342\253\210\317\202\342\211\216\314\270\342\211\247"
+    "\360\235\224\240\313\233\342\250\204\342\212\226\360\235\225\226\317\221\342\211\245\342\237\250\342\212\227\342\213\263\360\235"
+    "\225\212\342\210\265\342\224\224\342\252\213\302\271\360\235\224\267\342\211\257\342\226\210\342\250\227\321\223\342\246\232\304"
+    "\215\342\211\224\173\302\243\342\253\260\342\206\227\342\250\274\360\235\224\224\303\224\342\206\225\342\245\222\342\226\277\342"
+    "\231\202\342\206\243\342\206\253\342\212\211\342\210\265\342\213\236\342\245\243\360\235\224\216\313\231\342\210\210\342\225\224"
+    "\360\235\222\234\342\211\220\342\213\255\342\205\231\342\213\253\321\206\342\210\274\342\203\222\342\231\245\342\253\213\303\247"
+    "\342\200\265\342\212\231\342\253\221\342\250\242\043\321\203\303\250\342\250\215\342\211\213\314\270\342\213\213\342\206\233\342"
+    "\231\245\342\206\266\342\211\207\342\250\260\342\217\237\342\251\262\342\212\220\342\244\274\342\212\265\342\211\220\314\270\320"
+    "\274\320\213\304\205\342\246\254\042\342\212\245\342\207\222\342\211\263\342\200\205\342\251\211\342\237\246\342\214\212\342\206"
+    "\220\313\235\342\253\257\304\247\303\227\342\251\276\342\213\201\342\245\261\342\210\256\304\210\342\211\234\342\216\260\342\211"
+    "\251\073\342\225\233\342\207\204\342\253\213\357\270\200\342\245\212\342\207\276\342\247\201\302\275\342\206\275\342\237\251\136"
+    "\342\207\202\342\214\266\342\245\265\316\275\342\211\251\357\270\200\305\234\342\200\213\342\211\225\342\251\255\314\270\342\210"
+    "\243\302\251\317\260\342\211\237\360\235\224\217\342\207\222\360\235\224\204\342\212\240\342\210\275\314\261\342\210\202\342\211"
+    "\277\303\234\342\207\244\342\204\261\342\251\235\342\210\207\046\342\205\207\342\212\211\342\213\216\342\213\200\342\211\271\342"
+    "\211\201\342\204\235\342\211\273\342\211\262\342\212\243\303\214\342\247\253\342\212\270\342\206\227\305\275\342\226\277\342\246"
+    "\246\342\227\203\342\237\277\342\231\256\342\246\220\342\213\274\342\252\260\314\270\320\224\317\225\342\205\232\342\253\231\342"
+    "\212\232\360\235\222\276\342\224\202\342\231\246\342\244\263\303\222\342\211\277\314\270\342\211\204\360\235\224\276\320\242\342"
+    "\212\207\342\212\203\342\203\222\342\247\205\342\206\246\342\213\251\342\200\234\342\251\256\342\206\256\342\247\264\321\204\342"
+    "\211\245\342\212\250\342\225\252\342\213\233\342\210\210\342\210\236\360\235\225\223\316\237\342\250\251\342\206\260\342\252\223"
+    "\342\210\267\342\213\224\342\251\225\342\210\244\342\226\252\303\241\342\211\267\342\211\226\305\276\342\213\214\342\245\250\360"
+    "\235\222\271\342\213\266\342\206\235\342\251\276\314\270\303\246\342\250\273\360\235\224\233\133\342\200\234\342\253\247\342\211"
+    "\267\342\206\224\342\211\263\342\213\207\303\252\342\200\230\342\211\201\342\244\234\342\224\234\342\210\244\342\211\216\342\213"
+    "\204\342\220\243\342\210\245\342\245\270\342\251\275\342\204\251\305\256\342\213\201\342\251\271\304\272\302\250\313\230\320\222"
+    "\321\217\342\206\223\342\211\274\342\252\253\320\241\342\213\216\342\212\224\342\253\206\314\270\342\217\235\342\213\233\357\270"
+    "\200\342\211\214\305\226\313\206\342\210\204\342\244\244\302\267\342\244\233\303\242\342\246\213\342\212\206\342\212\210\342\244"
+    "\222\342\213\246\342\207\205\342\227\254\342\251\270\342\244\270\316\274\342\207\211\342\237\247\342\204\214\342\250\204\342\207"
+    "\223\342\231\243\342\210\232\342\213\210\041\303\231\357\254\200\342\213\261\342\245\244\320\207\342\201\237\342\244\243\342\214"
+    "\213\316\247\342\204\244\342\244\250\342\204\232\342\206\242\342\211\270\342\207\214\342\210\275\303\272\342\204\220\342\252\265"
+    "\342\204\265\320\243\342\253\253\303\247\342\206\272\342\206\220\342\231\240\342\211\220\342\211\260\342\225\222\342\211\276\342"
+    "\237\246\342\212\213\357\270\200\076\342\231\246\303\217\320\210\342\213\255\137\303\270\360\235\224\253\302\242\342\213\233\303"
+    "\255\342\251\273\303\233\360\235\225\244\302\246\342\214\236\303\256\342\246\274\342\212\244\342\212\272\342\200\264\342\245\274"
+    "\342\250\245\342\251\263\360\235\225\215\342\207\221\342\226\223\302\244\302\261\342\210\224\313\232\342\211\204\303\240\304\252"
+    "\317\203\342\252\200\342\246\221\302\267\321\233\360\235\223\212\342\212\202\342\203\222\342\210\202\314\270\342\246\214\342\252"
+    "\254\342\253\220\342\211\217\314\270\342\210\241\304\232\342\252\255\342\213\271\342\210\265\342\211\244\342\226\252\303\212\342"
+    "\213\231\342\213\214\303\263\342\212\220\342\211\202\342\226\252\342\253\205\342\252\247\320\273\342\211\245\342\227\203\342\214"
+    "\226\342\252\210\304\237\342\213\272\302\256\342\253\213\357\270\200\317\266\342\213\223\342\206\260\360\235\224\262\317\201\302"
+    "\265\342\210\201\342\206\276\360\235\224\226\302\252\342\205\206\342\204\250\074\342\203\222\304\241\342\252\241\314\270\342\206"
+    "\261\342\247\217\314\270\342\212\223\303\274\342\246\216\303\275\342\250\206\342\213\252\342\206\221\303\244\305\215\304\253\342"
+    "\247\217\342\205\205\342\245\262\305\225\342\211\221\342\210\242\342\252\242\342\200\242\342\237\255\342\213\250\342\205\234\342"
+    "\251\226\342\252\207\304\203\360\235\223\203\342\237\266\342\204\217\342\213\265\314\270\321\210\304\231\342\247\211\342\211\275"
+    "\360\235\225\234\342\226\276\303\257\342\211\231\342\211\205\044\342\210\273\342\251\207\305\266\302\277\342\246\226\342\245\231"
+    "\342\211\272\360\235\225\242\302\240\342\211\203\342\252\211\303\210\303\264\342\210\246\320\233\305\245\342\244\215\342\247\234"
+    "\342\206\231\342\210\214\360\235\225\204\011\342\230\216\342\245\241\342\212\267\342\226\265\305\270\303\253\302\262\360\235\222"
+    "\266\342\237\267\342\213\265\342\247\220\314\270\342\210\255\316\266\342\211\253\342\203\222\320\275\342\211\264\342\210\235\342"
+    "\204\223\342\244\215\342\212\253\360\235\224\215\320\253\342\212\255\342\211\270\342\211\216\314\270\303\241\342\246\264\303\201"
+    "\342\245\260\342\206\233\317\206\342\211\273\342\247\245\342\253\226\342\247\216\320\232\303\255\342\211\207\305\272\342\246\257"
+    "\342\200\207\342\252\236\342\211\266\320\251\342\244\266\304\277\305\232\342\213\237\342\244\214\342\245\226\342\214\212\342\211"
+    "\246\320\271\342\246\224\342\250\202\342\206\252\304\250\342\210\221\342\212\203\360\235\224\264\342\226\200\316\270\342\213\203"
+    "\342\253\205\314\270\342\205\226\342\214\237\342\211\273\342\212\241\342\212\222\342\251\205\342\206\274\342\206\274\360\235\224"
+    "\251\303\267\342\207\235\302\272\303\272\303\235\342\212\251\302\260\342\212\212\357\270\200\302\267\342\212\226\342\204\236\342"
+    "\211\257\342\246\261\303\236\342\212\222\342\252\212\076\342\203\222\360\235\224\223\342\252\222\342\211\246\314\270\342\206\227"
+    "\303\214\342\210\230\302\273\342\214\211\140\360\235\224\227\304\270\342\250\244\342\253\244\342\213\260\342\226\270\305\250\342"
+    "\211\210\342\252\264\342\211\266\342\211\253\314\270\342\247\243\342\253\232\304\230\303\220\133\342\212\217\314\270\360\235\224"
+    "\263\342\224\254\342\213\232\357\270\200\342\246\244\342\211\247\342\201\242\342\252\202\342\237\266\342\212\262\304\245\302\245"
+    "\303\222\342\213\213\360\235\223\200\342\207\216\342\207\211\342\212\200\342\211\210\305\235\360\235\224\260\342\204\230\320\270"
+    "\342\245\205\342\245\211\342\210\250\342\251\272\342\244\203\316\233\303\203\342\250\225\304\256\342\211\241\342\203\245\342\212"
+    "\203\342\203\222\360\235\224\274\046\316\245\342\214\211\342\214\210\305\221\342\252\271\321\216\342\246\251\342\226\263\317\265"
+    "\342\251\200\342\212\231\342\251\275\360\235\225\217\342\211\200\342\251\264\342\212\216\342\226\270\320\220\305\214\302\270\342"
+    "\211\252\342\251\220\320\206\342\245\256\342\253\214\342\213\232\342\211\226\342\206\256\305\255\320\226\360\235\223\207\320\263"
+    "\342\206\252\342\200\212\342\211\224\342\205\205\342\211\246\342\252\276\342\204\231\342\207\203\342\210\204\342\214\236\342\212"
+    "\232\342\213\205\076\342\253\256\342\251\275\314\270\342\213\202\342\244\245\342\213\227\342\210\200\342\200\226\342\210\246\316"
+    "\221\342\226\222\342\210\220\342\245\210\342\213\220\342\253\206\342\217\236\342\253\233\342\213\254\342\207\217\342\251\276\302"
+    "\264\342\213\220\342\244\232\302\255\342\245\271\342\212\201\342\205\210\302\263\342\210\211\316\231\342\210\245\342\200\217\305"
+    "\271\304\273\360\235\222\237\342\206\222\342\211\217\314\270\360\235\223\216\303\267\342\244\202\342\250\200\342\246\222\342\252"
+    "\230\302\255\303\276\342\212\203\342\203\222\320\227\100\342\211\271\342\210\255\320\216\305\231\342\210\277\303\224\342\210\262"
+    "\360\235\225\251\320\225\342\252\227\342\252\205\342\206\221\360\235\223\213\342\207\204\342\237\250\360\235\222\242\342\226\256"
+    "\342\250\255\342\214\235\316\246\360\235\224\237\360\235\225\202\303\276\342\210\237\342\253\214\357\270\200\342\212\247\303\277"
+    "\342\210\263\342\212\224\342\226\252\342\252\224\342\213\253\303\246\342\251\261\342\237\274\303\213\342\210\272\302\276\305\265"
+    "\342\213\201\342\211\234\342\210\247\342\213\241\342\214\235\342\204\247\342\206\230\321\224\046\304\261\342\225\220\342\210\253"
+    "\342\204\217\342\212\221\342\211\262\342\206\273\342\212\210\342\206\246\304\207\342\212\266\342\246\205\342\200\262\342\212\217"
+    "\342\211\242\342\212\233\342\206\254\342\225\246\321\230\342\252\217\342\214\255\317\226\342\204\221\303\201\317\235\012\342\251"
+    "\277\342\214\205\305\260\342\204\222\342\212\270\320\202\342\200\241\342\212\264\342\200\235\303\250\302\276\046\360\235\222\277"
+    "\342\206\225\302\246\316\261\342\223\210\342\211\274\303\211\342\252\242\314\270\342\213\226\342\200\220\342\211\240\342\246\276"
+    "\342\250\272\342\252\235\342\244\240\342\204\235\342\250\214\342\211\250\357\270\200\342\216\266\342\211\210\303\207\342\211\200"
+    "\316\250\342\204\234\342\214\222\303\200\342\204\202\342\201\203\342\200\261\342\244\245\342\211\264\342\237\274\342\210\226\305"
+    "\274\342\226\275\360\235\224\210\360\235\222\236\303\266\342\212\237\076\342\245\247\342\206\247\342\204\222\342\200\213\302\251"
+    "\317\207\342\201\242\360\235\222\273\303\221\302\257\316\264\342\210\270\342\213\267\342\245\256\303\202\342\226\265\304\226\303"
+    "\205\342\244\205\320\205\302\254\342\207\204\056\342\237\252\342\252\203\357\254\204\360\235\225\231\342\250\277\342\212\224\357"
+    "\270\200\320\240\305\240\342\206\231\342\252\231\342\245\223\342\200\213\342\205\235\342\211\252\342\203\222\360\235\222\256\342"
+    "\212\220\342\211\202\314\270\305\230\305\247\342\210\235\342\252\254\357\270\200\342\211\254\304\236\321\225\342\210\274\342\210"
+    "\246\303\226\342\212\237\320\217\342\207\224\342\210\276\342\252\245\342\252\226\342\213\225\342\251\267\342\207\210\342\213\255"
+    "\317\266\321\207\342\251\210\304\267\342\212\240\342\252\205\342\244\271\304\222\357\254\201\342\213\247\360\235\224\241\342\252"
+    "\246\320\236\342\207\200\305\261\342\210\235\342\210\245\342\227\270\342\212\221\342\250\200\302\266\342\204\234\342\210\257\305"
+    "\242\303\242\342\210\275\342\210\274\360\235\224\273\342\210\227\342\253\222\342\217\234\342\226\261\360\235\224\256\173\342\212"
+    "\212\360\235\224\266\342\205\223\342\244\220\342\207\206\342\252\257\314\270\320\211\342\206\225\305\246\321\234\306\265\342\213"
+    "\215\342\207\245\342\214\237\342\211\222\342\225\227\342\212\225\342\253\203\360\235\225\225\305\220\342\230\205\342\213\230\314"
+    "\270\342\207\202\305\251\342\213\232\342\211\216\360\235\225\253\303\204\360\235\225\243\342\231\252\321\200\342\251\224\342\204"
+    "\227\303\213\342\211\217\360\235\224\275\342\200\236\342\210\205\342\211\261\342\210\244\342\211\260\342\200\246\342\210\251\357"
+    "\270\200\342\205\227\342\213\256\342\213\231\314\270\302\240\342\212\217\342\204\267\304\213\342\207\220\342\253\201\342\206\236"
+    "\342\211\200\342\252\255\357\270\200\342\217\247\342\211\211\342\200\276\342\213\221\342\245\216\342\225\242\303\270\342\210\224"
+    "\342\252\244\302\245\342\204\255\342\213\254\053\342\251\206\342\226\253\317\210\342\252\257\342\252\204\342\212\200\342\204\234"
+    "\320\257\360\235\223\217\303\251\342\252\257\342\246\277\342\210\243\342\252\207\317\204\342\213\207\342\210\226\303\243\342\211"
+    "\223\342\251\260\342\204\222\342\226\241\342\253\275\342\207\206\342\252\260\314\270\342\253\202\342\213\252\342\212\201\360\235"
+    "\225\220\342\246\263\321\213\342\252\260\342\223\210\342\252\260\314\270\342\200\276\303\232\342\207\222\305\241\321\215\303\271"
+    "\342\214\234\342\210\220\303\263\342\211\262\305\233\360\235\223\214\342\213\206\342\225\237\342\200\211\303\262\342\200\230\342"
+    "\211\252\342\250\201\303\217\320\246\135\342\207\217\342\200\213\303\216\360\235\225\214\342\210\223\146\152\360\235\224\270\342"
+    "\251\275\303\227\302\274\342\252\260\342\245\251\342\245\213\342\211\263\302\266\342\210\213\342\211\220\342\213\275\342\213\264"
+    "\342\210\246\342\234\223\342\244\263\314\270\342\244\251\342\210\264\342\253\207\342\227\273\342\245\224\342\206\276\342\245\254"
+    "\047\342\244\275\342\235\263\303\230\305\243\342\235\230\342\214\275\342\206\224\304\275\342\206\261\302\256\360\235\224\236\342"
+    "\213\241\342\237\265\342\210\213\342\226\241\342\245\235\342\224\274\303\261\303\254\320\214\342\212\207\342\206\277\342\250\220"
+    "\342\247\215\342\203\233\342\211\241\317\261\302\272\305\203\342\207\212\342\252\257\314\270\303\235\342\210\267\342\210\235\320"
+    "\231\303\233\342\211\246\342\250\202\303\207\174\342\212\203\342\213\203\342\206\272\342\253\223\342\203\233\342\211\215\342\203"
+    "\222\342\253\261\304\274\342\210\203\342\253\200\342\201\243\342\204\215\342\206\232\342\214\234\342\210\274\342\251\260\314\270"
+    "\342\227\257\317\234\342\212\225\342\211\240\316\226\342\210\241\342\200\225\175\342\213\217\342\213\271\314\270\342\253\227\342"
+    "\213\251\360\235\224\244\342\206\254\342\252\257\314\270\342\244\237\342\252\265\342\210\253\074\342\252\214\342\207\265\342\251"
+    "\255\342\250\271\342\204\231\342\211\265\342\213\202\342\210\217\342\211\255\342\212\254\342\210\230\303\252\342\206\240\317\205"
+    "\342\206\222\342\231\256\342\214\242\303\204\342\211\241\342\206\275\342\246\215\342\225\247\342\206\265\303\212\360\235\222\254"
+    "\342\237\266\320\250\342\247\253\342\250\201\360\235\222\246\342\225\231\342\211\204\342\245\263\320\221\342\237\265\342\253\254"
+    "\342\251\276\304\235\342\231\243\050\304\262\342\206\222\342\206\245\342\225\225\342\213\273\342\225\223\342\204\225\342\247\202"
+    "\342\207\202\342\204\264\342\211\247\314\270\342\211\203\342\250\226\342\253\206\317\222\342\212\204\342\237\270\342\210\210\316"
+    "\262\342\205\236\342\213\226\342\251\223\342\212\245\342\204\260\360\235\222\265\342\207\232\342\245\252\342\210\221\342\214\225"
+    "\342\211\213\342\206\235\314\270\342\226\275\302\250\342\212\241\342\212\256\342\211\247\314\270\342\212\262\342\211\246\314\270"
+    "\342\210\256\342\211\277\302\270\360\235\224\234\342\253\263\342\216\265\342\246\225\317\202\342\210\254\342\212\202\321\226\313"
+    "\234\342\210\240\342\204\215\342\250\214\342\213\204\342\213\254\342\200\203\342\251\246\342\212\221\342\207\220\303\205\305\200"
+    "\304\244\342\210\261\342\210\262\342\212\252\303\237\342\246\235\074\342\225\253\342\210\232\360\235\224\250\316\236\342\211\253"
+    "\342\224\264\360\235\225\233\310\267\316\244\342\200\242\305\202\342\213\231\342\245\246\342\206\237\360\235\225\222\342\252\213"
+    "\342\214\242\360\235\222\245\304\242\342\200\212\342\212\245\342\206\223\360\235\225\213\342\213\206\342\212\202\342\252\266\342"
+    "\212\213\360\235\225\200\304\223\342\204\225\360\235\225\203\342\225\250\342\253\244\320\261\360\235\224\232\303\253\342\212\264"
+    "\305\253\342\225\240\342\206\222\342\253\205\342\244\231\342\212\222\342\206\277\342\212\244\303\223\342\204\254\342\211\252\314"
+    "\270\303\225\321\201\342\252\225\342\247\220\304\251\306\222\342\210\235\305\222\342\210\276\305\244\313\231\342\252\273\342\212"
+    "\277\342\204\213\342\207\224\342\207\230\304\271\342\253\224\342\200\232\342\244\247\342\216\265\342\211\232\342\212\263\175\342"
+    "\212\210\342\210\247\342\251\214\342\253\213\303\215\304\212\342\211\274\342\207\225\342\205\207\342\250\267\302\251\342\206\255"
+    "\342\206\232\303\223\342\210\250\342\251\215\342\237\247\342\204\220\342\213\250\342\211\225\342\211\252\302\250\360\235\222\270"
+    "\342\252\256\342\250\264\360\235\224\246\342\212\275\302\243\342\224\214\342\213\221\342\207\203\320\203\316\230\342\206\226\342"
+    "\225\243\342\230\206\342\215\274\303\225\360\235\224\205\302\270\342\212\235\342\252\220\302\240\302\251\137\303\266\342\211\267"
+    "\342\214\214\342\225\251\320\256\342\210\205\342\206\243\302\254\304\227\342\211\250\357\270\200\342\210\245\342\210\246\342\226"
+    "\264\360\235\224\245\342\204\202\342\206\220\316\241\320\264\342\211\260\342\212\215\342\212\260\342\211\253\342\251\204\342\211"
+    "\253\314\270\342\204\250\342\214\256\342\201\241\307\265\342\201\241\321\232\342\200\265\342\253\230\360\235\222\263\360\235\222"
+    "\260\321\236\342\212\211\302\267\342\200\213\342\212\201\342\245\253\342\213\224\342\210\211\305\227\342\225\245\302\256\342\207"
+    "\220\303\273\304\257\342\211\237\360\235\224\254\360\235\225\232\042\342\252\237\342\225\234\302\253\342\213\217\342\245\257\342"
+    "\252\251\304\264\342\237\250\342\247\235\305\210\342\227\202\342\212\212\357\270\200\360\235\225\227\342\211\244\342\203\222\342"
+    "\251\213\317\265\342\210\213\304\202\360\235\222\257\304\276\342\230\205\342\252\272\316\222\342\200\220\342\245\225\342\212\245"
+    "\342\251\275\314\270\342\252\252\342\210\252\317\235\342\213\200\302\274\342\246\223\342\206\255\360\235\225\230\342\237\211\342"
+    "\213\203\342\212\273\342\212\250\342\250\263\075\342\211\211\342\210\200\305\257\342\206\235\342\211\212\342\207\201\342\211\215"
+    "\342\237\272\342\226\276\342\224\200\342\237\270\342\210\252\357\270\200\342\247\200\342\246\262\342\206\221\342\246\217\342\210"
+    "\243\304\200\342\200\224\342\200\260\342\246\253\342\213\242\317\261\042\342\210\214\342\211\247\342\250\243\305\237\342\205\210"
+    "\342\206\251\342\211\254\303\264\342\252\241\342\205\207\342\211\214\342\212\265\342\203\222\045\302\247\342\207\210\304\233\342"
+    "\237\267\342\213\233\321\211\342\225\235\342\245\245\304\216\342\211\277\342\204\270\360\235\222\262\342\210\211\342\237\253\342"
+    "\244\267\342\210\203\303\261\342\214\220\313\234\357\254\202\342\224\220\342\251\252\342\206\245\360\235\225\216\342\251\203\342"
+    "\210\210\342\200\235\305\264\342\245\276\360\235\224\243\342\225\254\342\247\244\342\252\272\342\212\220\314\270\360\235\225\252"
+    "\342\201\227\320\201\342\252\277\316\265\342\224\200\342\244\204\342\207\201\360\235\222\252\342\207\216\342\204\233\302\241\342"
+    "\225\230\342\213\236\360\235\224\222\342\253\214\357\270\200\342\210\207\342\245\257\342\210\205\342\211\227\321\221\342\253\250"
+    "\342\211\211\342\211\276\342\226\271\342\210\264\305\254\316\263\342\251\275\314\270\342\253\246\342\200\241\342\210\202\342\213"
+    "\262\342\212\213\320\234\321\222\342\204\242\342\237\251\342\211\202\314\270\342\207\233\342\210\276\314\263\342\252\266\342\206"
+    "\230\304\220\303\211\342\206\221\303\215\320\230\342\206\220\342\210\270\304\234\316\272\342\206\262\304\211\303\245\342\206\253"
+    "\342\212\216\342\211\215\342\206\263\342\207\275\342\213\204\342\211\221\342\205\225\342\207\223\316\277\342\253\255\342\213\232"
+    "\342\211\206\305\213\360\235\225\201\342\251\233\342\210\204\342\207\201\342\204\263\304\240\342\212\262\342\214\243\342\252\215"
+    "\313\207\342\247\203\317\265\342\207\232\304\204\076\360\235\224\221\320\255\342\204\265\342\212\202\342\203\222\077\342\212\230"
+    "\303\240\342\212\202\342\203\222\316\251\316\225\302\250\303\275\321\212\342\210\201\321\237\342\207\212\342\237\265\342\252\214"
+    "\342\252\212\342\231\200\342\235\262\342\204\217\305\204\342\206\240\303\220\342\244\220\360\235\222\253\316\267\342\205\224\320"
+    "\245\342\210\243\342\213\202\342\206\222\342\212\200\342\213\253\302\247\303\274\360\235\225\246\342\244\246\342\204\266\342\212"
+    "\265\342\201\240\342\204\217\342\245\266\303\244\342\204\230\342\227\272\342\252\260\317\226\342\246\255\303\245\302\260\342\251"
+    "\230\342\207\203\342\210\274\342\250\221\305\211\342\225\226\305\224\342\211\242\305\201\342\200\245\316\265\342\206\223\342\246"
+    "\256\302\244\305\212\357\254\203\135\342\246\252\342\211\275\302\256\342\200\235\342\210\226\342\207\231\342\210\222\342\211\251"
+    "\357\270\200\305\207\342\216\264\342\213\242\342\204\263\342\237\267\342\253\214\342\245\277\342\245\236\360\235\224\212\342\211"
+    "\251\342\237\272\342\212\236\052\342\211\216\342\211\257\342\214\215\342\251\274\342\201\204\342\200\211\342\212\223\360\235\223"
+    "\206\342\204\242\342\210\245\303\202\360\235\222\275\342\213\243\320\260\342\212\233\302\263\342\225\241\342\212\242\342\211\272"
+    "\342\225\244\360\235\225\250\342\207\205\052\342\227\212\342\245\217\321\227\342\237\271\342\207\200\342\250\265\342\210\217\303"
+    "\210\342\244\223\302\275\320\237\304\263\305\236\342\251\212\360\235\224\271\342\214\277\314\221\320\277\320\204\342\206\273\342"
+    "\211\252\314\270\304\261\342\210\226\342\205\230\342\224\230\360\235\225\245\342\200\263\313\235\342\252\274\342\213\215\342\204"
+    "\257\342\244\250\303\200\303\251\342\252\270\342\206\223\317\205\342\212\236\342\207\225\342\211\250\342\252\270\342\245\255\342"
+    "\204\264\342\204\216\342\204\214\342\246\245\072\342\245\275\342\214\216\360\235\222\264\342\253\204\342\245\234\304\260\342\212"
+    "\235\342\251\237\342\204\254\342\214\217\342\234\240\342\237\251\342\210\226\313\207\342\216\264\303\262\360\235\224\231\342\245"
+    "\237\360\235\223\215\360\235\225\206\342\251\234\360\235\223\202\342\200\223\342\252\240\342\211\222\342\213\237\342\244\251\342"
+    "\225\232\304\246\305\267\342\226\255\342\251\276\314\270\303\243\305\252\342\206\267\342\252\210\342\252\221\342\250\222\316\232"
+    "\342\207\213\305\273\304\206\342\250\206\303\277\342\224\244\342\212\207\316\224\317\202\342\251\202\342\205\206\342\212\203\342"
+    "\211\253\342\212\242\342\253\275\342\203\245\342\246\271\342\252\275\054\342\246\266\303\203\342\213\200\342\207\245\304\221\342"
+    "\231\257\342\204\263\342\210\240\342\203\222\360\235\225\241\342\252\267\342\234\223\342\211\210\342\253\206\314\270\174\360\235"
+    "\224\207\303\257\302\262\360\235\223\211\342\252\201\342\253\225\342\231\240\342\210\223\342\210\264\342\200\214\075\342\203\245"
+    "\342\246\247\342\245\220\342\210\205\342\214\210\342\204\264\305\206\342\211\224\303\231\342\212\243\342\211\261\342\246\234\302"
+    "\265\342\206\242\342\207\221\342\204\213\342\210\260\342\210\223\342\212\212\342\206\246\342\207\213\342\206\266\342\200\231\320"
+    "\252\342\201\201\342\211\202\360\235\224\220\074\134\342\204\205\342\214\243\303\234\303\206\342\252\211\342\204\234\342\204\221"
+    "\303\230\342\250\256\342\226\221\342\204\221\342\237\271\342\212\205\342\207\226\342\211\275\313\230\342\211\210\342\216\261\342"
+    "\206\244\342\211\205\342\204\255\342\227\202\342\207\224\302\261\342\211\266\342\250\223\360\235\224\242\342\227\213\360\235\225"
+    "\237\342\212\206\342\250\261\342\200\236\342\206\231\342\253\262\321\214\342\245\240\342\231\255\342\206\277\342\207\215\303\254"
+    "\342\212\223\357\270\200\342\245\273\342\211\256\342\201\237\342\200\212\342\210\257\304\201\342\217\242\342\250\224\342\210\240"
+    "\342\245\227\342\252\267\342\246\265\320\266\360\235\222\261\342\211\217\303\205\342\244\235\342\212\272\342\212\217\342\200\231"
+    "\342\207\225\317\221\317\225\342\237\254\342\251\227\316\276\317\225\342\204\221\342\244\217\303\271\342\237\210\342\200\210\342"
+    "\213\252\342\207\214\342\234\266\342\204\254\302\261\342\251\232\342\210\266\342\210\214\342\212\264\342\203\222\342\206\251\303"
+    "\221\342\226\263\316\234\342\227\257\342\211\212\317\200\342\206\220\360\235\225\235\342\251\265\342\214\205\342\245\232\303\216"
+    "\305\223\342\207\244\051\320\267\342\207\233\342\237\271\360\235\224\257\342\207\277\342\250\257\302\256\342\212\227\342\245\242"
+    "\342\204\213\342\206\230\342\213\257\305\262\360\235\224\255\342\244\236\342\207\224\302\242\342\206\226\342\244\217\320\276\320"
+    "\223\342\216\260\342\212\265\342\203\234\342\253\217\342\247\204\342\226\204\342\247\236\316\227\320\235\342\213\230\342\214\223"
+    "\342\211\244\316\243\342\244\265\342\211\261\302\264\342\204\233\342\207\206\342\210\213\342\237\270\303\237\342\206\226\342\210"
+    "\244\342\227\271\342\211\256\342\201\243\303\236\342\200\240\342\252\206\342\200\271\342\200\272\342\234\240\302\250\303\273\342"
+    "\214\206\342\212\276\342\207\265\342\234\227\342\214\206\057\342\246\206\317\222\303\206\303\265\302\252\342\206\267\342\204\244"
+    "\342\226\264\342\200\232\342\206\241\342\211\272\303\260\074\360\235\222\267\342\250\247\317\211\302\261\342\252\271\342\207\221"
+    "\342\213\227\304\214\342\252\257\342\211\223\342\213\240\302\257\140\342\213\222"
+    ;
+
+static const uint16_t entity_disp[ENTITY_BUCKETS] = {
+    3, 5, 3, 2, 2, 1, 4, 2, 1, 1, 1, 4, 3, 2, 2, 0,
+    1, 1, 0, 5, 2, 1, 8, 0, 1, 2, 2, 0, 1, 3, 0, 1,
+    3, 2, 3, 3, 1, 7, 4, 2, 2, 1, 2, 1, 2, 2, 2, 0,
+    2, 4, 0, 1, 1, 2, 2, 2, 1, 3, 6, 1, 2, 0, 2, 0,
+    2, 2, 3, 1, 1, 0, 1, 4, 4, 1, 3, 2, 2, 3, 0, 3,
+    1, 1, 0, 1, 1, 1, 5, 2, 1, 1, 1, 1, 1, 0, 2, 1,
+    1, 1, 2, 1, 1, 1, 3, 1, 3, 1, 1, 7, 2, 3, 0, 4,
+    1, 1, 14, 6, 1, 7, 2, 17, 1, 1, 2, 1, 3, 1, 0, 1,
+    1, 8, 1, 1, 1, 2, 22, 1, 7, 1, 1, 1, 1, 0, 1, 2,
+    7, 0, 8, 1, 6, 1, 5, 0, 2, 1, 2, 1, 1, 2, 1, 2,
+    2, 2, 3, 0, 2, 2, 2, 1, 6, 1, 1, 1, 1, 1, 1, 1,
+    3, 8, 1, 0, 1, 1, 1, 7, 4, 1, 9, 1, 1, 0, 1, 2,
+    1, 1, 1, 1, 7, 4, 2, 6, 1, 3, 5, 1, 0, 1, 1, 1,
+    1, 2, 1, 8, 2, 1, 1, 2, 1, 1, 0, 5, 4, 1, 1, 1,
+    0, 2, 1, 2, 6, 1, 1, 1, 1, 1, 3, 1, 4, 1, 2, 1,
+    1, 1, 1, 2, 2, 3, 0, 4, 3, 1, 0, 2, 0, 43, 1, 2,
+    3, 2, 6, 1, 4, 1, 8, 1, 11, 14, 3, 5, 16, 0, 1, 1,
+    1, 2, 6, 2, 4, 2, 4, 1, 1, 4, 1, 4, 0, 0, 64, 2,
+    1, 3, 1, 1, 2, 1, 1, 3, 2, 1, 4, 1, 0, 5, 5, 1,
+    2, 2, 1, 1, 0, 1, 1, 0, 5, 1, 5, 2, 1, 3, 3, 3,
+    0, 1, 7, 9, 1, 3, 3, 0, 6, 1, 3, 2, 1, 0, 0, 3,
+    6, 1, 1, 1, 1, 17, 1, 7, 5, 2, 2, 1, 3, 2, 1, 2,
+    0, 5, 7, 3, 1, 2, 2, 0, 0, 1, 1, 1, 1, 1, 1, 3,
+    3, 1, 4, 1, 7, 3, 3, 1, 0, 1, 3, 5, 1, 2, 6, 4,
+    18, 2, 1, 2, 1, 4, 1, 2, 2, 1, 1, 1, 1, 4, 3, 1,
+    4, 5, 3, 1, 2, 1, 1, 1, 4, 3, 1, 3, 3, 6, 1, 16,
+    3, 4, 7, 1, 1, 3, 0, 9, 1, 3, 0, 9, 4, 0, 3, 10,
+    2, 1, 0, 3, 57, 6, 1, 1, 2, 0, 5, 20, 1, 2, 3, 2,
+    1, 1, 2, 3, 7, 1, 0, 1, 4, 1, 2, 5, 1, 1, 1, 0,
+    1, 1, 0, 1, 1, 5, 1, 1, 1, 4, 0, 2, 2, 2, 4, 0,
+    1, 1, 6, 2, 1, 0, 1, 4, 2, 1, 1, 0, 2, 1, 0, 64,
+    2, 1, 1, 1, 2, 2, 3, 1, 1, 14, 1, 1, 1, 1, 3, 2,
+    1, 2, 3, 1, 27, 1, 64, 5, 3, 1, 1, 1, 0, 7, 1, 1,
+    64, 1, 5, 4, 5, 1, 3, 4, 1, 1, 1, 3, 1, 2, 5, 0,
+    3, 2, 0, 1, 0, 1, 1, 2, 4, 5, 2, 2, 2, 2, 1, 9,
+    11, 1, 1, 0, 1, 0, 2, 4, 1, 2, 2, 1, 0, 4, 3, 1,
+    11, 3, 0, 1, 14, 5, 1, 0, 1, 2, 2, 0, 1, 2, 6, 0,
+    1, 2, 4, 0, 1, 20, 3, 65, 1, 5, 47, 1, 1, 3, 2, 1,
+    1, 1, 8, 16, 2, 1, 0, 6, 64, 50, 1, 64, 2, 0, 1, 9,
+    1, 2, 9, 1, 2, 4, 3, 5, 1, 1, 3, 0, 26, 2, 0, 4,
+    1, 1, 4, 0, 1, 0, 3, 1, 2, 1, 2, 5, 0, 0, 0, 1,
+    1, 4, 0, 1, 6, 3, 0, 5, 2, 2, 0, 17, 6, 0, 1, 2,
+    1, 10, 2, 1, 2, 2, 1, 1, 1, 1, 2, 0, 1, 17, 0, 1,
+    33, 1, 1, 6, 1, 5, 2, 0, 1, 1, 25, 3, 3, 2, 1, 1,
+    2, 0, 64, 1, 1, 21, 2, 1, 2, 1, 1, 3, 7, 3, 1, 4,
+    0, 2, 16, 7, 10, 3, 7, 2, 31, 64, 1, 1, 2, 2, 4, 0,
+    2, 5, 2, 2, 3, 2, 1, 3, 7, 4, 2, 4, 1, 1, 6, 0,
+    5, 4, 1, 4, 1, 3, 3, 29, 1, 6, 3, 2, 1, 9, 2, 2,
+    1, 0, 2, 10, 7, 5, 0, 1, 2, 5, 0, 3, 33, 10, 1, 4,
+    1, 3, 9, 1, 3, 0, 2, 1, 2, 3, 1, 4, 1, 3, 1, 6,
+    2, 47, 5, 4, 1, 5, 1, 2, 6, 2, 0, 3, 1, 3, 1, 1,
+    4, 1, 2, 1, 1, 5, 1, 4, 0, 12, 2, 3, 2, 8, 2, 73,
+    1, 4, 0, 1, 1, 3, 1, 2, 1, 9, 4, 2, 2, 1, 1, 67,
+    17, 0, 0, 3, 1, 3, 2, 3, 8, 2, 5, 9, 2, 4, 6, 5,
+    1, 0, 2, 6, 1, 2, 4, 2, 3, 6, 5, 0, 3, 1, 13, 0,
+    1, 3, 3, 1, 2, 1, 2, 4, 2, 3, 0, 6, 6, 2, 2, 1,
+    1, 3, 2, 2, 3, 2, 1, 2, 68, 1, 2, 2, 3, 1, 1, 9,
+    3, 2, 66, 1, 4, 10, 4, 1, 3, 1, 3, 1, 1, 1, 4, 0,
+    2, 64, 1, 5, 1, 1, 2, 1, 39, 30, 0, 9, 8, 2, 4, 1,
+    1, 34, 2, 1, 4, 2, 5, 3, 6, 2, 1, 2, 3, 3, 4, 6,
+    0, 0, 0, 1, 0, 2, 3, 1, 10, 3, 1, 1, 4, 0, 4, 0,
+    0, 1, 1, 19, 0, 2, 1, 1, 66, 2, 5, 4, 1, 12, 0, 2,
+    1, 4, 0, 0, 65, 3, 11, 11, 2, 25, 2, 5, 3, 4, 2, 3,
+    1, 8, 1, 1, 2, 3, 1, 2, 5, 2, 1, 1, 2, 2, 2, 3,
+};
+
+static const entity_entry entity_table[ENTITY_SLOTS] = {
+    {0, 0, 0, 0},
+    {0, 6, 0, 2},
+    {6, 5, 2, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11, 23, 6, 3},
+    {34, 5, 9, 3},
+    {0, 0, 0, 0},
+    {39, 6, 12, 2},
+    {0, 0, 0, 0},
+    {45, 5, 14, 1},
+    {50, 6, 15, 3},
+    {56, 4, 18, 4},
+    {0, 0, 0, 0},
+    {60, 5, 22, 3},
+    {65, 7, 25, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {72, 4, 27, 4},
+    {76, 21, 31, 5},
+    {0, 0, 0, 0},
+    {97, 14, 36, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {111, 6, 39, 3},
+    {117, 6, 42, 3},
+    {123, 7, 45, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {130, 15, 47, 3},
+    {145, 18, 50, 3},
+    {163, 5, 53, 3},
+    {168, 22, 56, 3},
+    {190, 6, 59, 3},
+    {196, 8, 62, 3},
+    {204, 4, 65, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {208, 7, 69, 3},
+    {215, 4, 72, 2},
+    {219, 4, 74, 2},
+    {0, 0, 0, 0},
+    {223, 17, 76, 3},
+    {240, 7, 79, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {247, 7, 81, 3},
+    {254, 5, 84, 4},
+    {259, 4, 88, 2},
+    {0, 0, 0, 0},
+    {263, 4, 90, 4},
+    {267, 15, 94, 3},
+    {282, 7, 97, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {289, 6, 99, 3},
+    {0, 0, 0, 0},
+    {295, 7, 102, 3},
+    {302, 8, 105, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {310, 5, 108, 4},
+    {0, 0, 0, 0},
+    {315, 5, 112, 2},
+    {320, 7, 114, 2},
+    {327, 14, 116, 3},
+    {341, 6, 119, 3},
+    {347, 5, 122, 3},
+    {0, 0, 0, 0},
+    {352, 15, 125, 3},
+    {367, 6, 128, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {373, 14, 131, 3},
+    {387, 4, 134, 2},
+    {0, 0, 0, 0},
+    {391, 11, 136, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {402, 5, 139, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {407, 7, 143, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {414, 11, 146, 3},
+    {425, 3, 149, 2},
+    {428, 5, 151, 4},
+    {433, 6, 155, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {439, 4, 157, 3},
+    {0, 0, 0, 0},
+    {443, 5, 160, 6},
+    {0, 0, 0, 0},
+    {448, 8, 166, 3},
+    {456, 7, 169, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {463, 17, 172, 3},
+    {480, 6, 175, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {486, 6, 178, 3},
+    {0, 0, 0, 0},
+    {492, 19, 181, 3},
+    {0, 0, 0, 0},
+    {511, 6, 184, 3},
+    {517, 8, 187, 3},
+    {525, 4, 190, 2},
+    {0, 0, 0, 0},
+    {529, 4, 192, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {533, 11, 194, 3},
+    {544, 4, 197, 3},
+    {0, 0, 0, 0},
+    {548, 4, 200, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {552, 7, 203, 6},
+    {0, 0, 0, 0},
+    {559, 5, 209, 3},
+    {0, 0, 0, 0},
+    {564, 6, 212, 2},
+    {570, 5, 214, 3},
+    {575, 6, 217, 2},
+    {0, 0, 0, 0},
+    {581, 6, 219, 2},
+    {0, 0, 0, 0},
+    {587, 3, 221, 2},
+    {590, 5, 223, 3},
+    {0, 0, 0, 0},
+    {595, 6, 226, 3},
+    {601, 9, 229, 3},
+    {0, 0, 0, 0},
+    {610, 7, 232, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {617, 7, 234, 3},
+    {624, 5, 237, 3},
+    {629, 6, 240, 3},
+    {0, 0, 0, 0},
+    {635, 6, 243, 3},
+    {641, 5, 246, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {646, 4, 248, 4},
+    {650, 12, 252, 3},
+    {662, 4, 255, 2},
+    {666, 5, 257, 2},
+    {671, 5, 259, 2},
+    {0, 0, 0, 0},
+    {676, 7, 261, 3},
+    {0, 0, 0, 0},
+    {683, 5, 264, 2},
+    {0, 0, 0, 0},
+    {688, 4, 266, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {692, 11, 269, 5},
+    {703, 13, 274, 3},
+    {0, 0, 0, 0},
+    {716, 8, 277, 3},
+    {724, 4, 280, 3},
+    {728, 5, 283, 2},
+    {733, 5, 285, 2},
+    {738, 3, 287, 2},
+    {0, 0, 0, 0},
+    {741, 8, 289, 3},
+    {749, 15, 292, 3},
+    {0, 0, 0, 0},
+    {764, 7, 295, 2},
+    {0, 0, 0, 0},
+    {771, 7, 297, 3},
+    {778, 3, 300, 3},
+    {781, 4, 303, 2},
+    {785, 8, 305, 3},
+    {0, 0, 0, 0},
+    {793, 20, 308, 5},
+    {813, 9, 313, 3},
+    {822, 5, 316, 3},
+    {0, 0, 0, 0},
+    {827, 6, 319, 2},
+    {833, 4, 321, 1},
+    {0, 0, 0, 0},
+    {837, 6, 322, 3},
+    {0, 0, 0, 0},
+    {843, 10, 325, 3},
+    {0, 0, 0, 0},
+    {853, 6, 328, 3},
+    {859, 7, 331, 3},
+    {866, 6, 334, 3},
+    {872, 4, 337, 3},
+    {876, 5, 340, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {881, 5, 343, 2},
+    {886, 4, 345, 3},
+    {0, 0, 0, 0},
+    {890, 5, 348, 2},
+    {895, 17, 350, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {912, 5, 353, 3},
+    {917, 4, 356, 4},
+    {0, 0, 0, 0},
+    {921, 5, 360, 4},
+    {0, 0, 0, 0},
+    {926, 7, 364, 3},
+    {0, 0, 0, 0},
+    {933, 6, 367, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {939, 5, 369, 3},
+    {944, 7, 372, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {951, 16, 375, 3},
+    {967, 6, 378, 3},
+    {973, 4, 381, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {977, 10, 384, 3},
+    {987, 9, 387, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {996, 8, 390, 3},
+    {1004, 9, 393, 3},
+    {1013, 15, 396, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1028, 9, 399, 3},
+    {0, 0, 0, 0},
+    {1037, 6, 402, 2},
+    {1043, 7, 404, 3},
+    {1050, 18, 407, 3},
+    {0, 0, 0, 0},
+    {1068, 6, 410, 2},
+    {1074, 7, 412, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1081, 16, 415, 3},
+    {0, 0, 0, 0},
+    {1097, 5, 418, 4},
+    {1102, 7, 422, 3},
+    {0, 0, 0, 0},
+    {1109, 17, 425, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1126, 5, 428, 4},
+    {1131, 7, 432, 3},
+    {0, 0, 0, 0},
+    {1138, 7, 435, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1145, 7, 438, 2},
+    {0, 0, 0, 0},
+    {1152, 16, 440, 5},
+    {1168, 17, 445, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1185, 4, 448, 4},
+    {0, 0, 0, 0},
+    {1189, 5, 452, 2},
+    {1194, 7, 454, 3},
+    {0, 0, 0, 0},
+    {1201, 12, 457, 3},
+    {1213, 5, 460, 4},
+    {1218, 9, 464, 2},
+    {1227, 13, 466, 3},
+    {1240, 17, 469, 3},
+    {1257, 7, 472, 3},
+    {1264, 7, 475, 3},
+    {1271, 5, 478, 4},
+    {1276, 7, 482, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1283, 6, 485, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1289, 11, 488, 3},
+    {0, 0, 0, 0},
+    {1300, 5, 491, 2},
+    {1305, 4, 493, 4},
+    {1309, 11, 497, 3},
+    {1320, 6, 500, 3},
+    {1326, 9, 503, 3},
+    {1335, 5, 506, 2},
+    {1340, 8, 508, 3},
+    {1348, 7, 511, 2},
+    {1355, 7, 513, 3},
+    {1362, 7, 516, 1},
+    {1369, 5, 517, 2},
+    {0, 0, 0, 0},
+    {1374, 7, 519, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1381, 16, 522, 3},
+    {1397, 8, 525, 3},
+    {1405, 4, 528, 4},
+    {1409, 5, 532, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1414, 12, 534, 3},
+    {1426, 14, 537, 3},
+    {1440, 5, 540, 3},
+    {1445, 5, 543, 3},
+    {1450, 7, 546, 3},
+    {1457, 14, 549, 3},
+    {1471, 17, 552, 3},
+    {1488, 8, 555, 3},
+    {0, 0, 0, 0},
+    {1496, 12, 558, 3},
+    {0, 0, 0, 0},
+    {1508, 5, 561, 3},
+    {1513, 4, 564, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1517, 15, 568, 2},
+    {0, 0, 0, 0},
+    {1532, 6, 570, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1538, 6, 573, 3},
+    {0, 0, 0, 0},
+    {1544, 5, 576, 4},
+    {0, 0, 0, 0},
+    {1549, 6, 580, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1555, 22, 583, 3},
+    {1577, 7, 586, 3},
+    {1584, 15, 589, 3},
+    {1599, 5, 592, 2},
+    {0, 0, 0, 0},
+    {1604, 6, 594, 6},
+    {0, 0, 0, 0},
+    {1610, 7, 600, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1617, 6, 603, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1623, 7, 606, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1630, 7, 608, 3},
+    {1637, 5, 611, 3},
+    {1642, 6, 614, 3},
+    {1648, 8, 617, 3},
+    {0, 0, 0, 0},
+    {1656, 4, 620, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1660, 4, 621, 2},
+    {1664, 7, 623, 2},
+    {1671, 9, 625, 3},
+    {1680, 6, 628, 5},
+    {0, 0, 0, 0},
+    {1686, 15, 633, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1701, 12, 636, 3},
+    {1713, 10, 639, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1723, 15, 642, 3},
+    {1738, 6, 645, 3},
+    {1744, 7, 648, 3},
+    {1751, 11, 651, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1762, 6, 654, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1768, 15, 657, 3},
+    {0, 0, 0, 0},
+    {1783, 8, 660, 3},
+    {0, 0, 0, 0},
+    {1791, 19, 663, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1810, 6, 666, 5},
+    {1816, 4, 671, 2},
+    {1820, 6, 673, 2},
+    {1826, 6, 675, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1832, 9, 677, 3},
+    {1841, 4, 680, 1},
+    {1845, 6, 681, 3},
+    {0, 0, 0, 0},
+    {1851, 11, 684, 3},
+    {1862, 5, 687, 3},
+    {0, 0, 0, 0},
+    {1867, 7, 690, 3},
+    {1874, 9, 693, 3},
+    {1883, 18, 696, 3},
+    {0, 0, 0, 0},
+    {1901, 7, 699, 3},
+    {1908, 15, 702, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1923, 6, 705, 2},
+    {0, 0, 0, 0},
+    {1929, 7, 707, 3},
+    {0, 0, 0, 0},
+    {1936, 7, 710, 2},
+    {1943, 6, 712, 2},
+    {0, 0, 0, 0},
+    {1949, 9, 714, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1958, 4, 717, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1962, 6, 720, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1968, 7, 723, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1975, 6, 726, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {1981, 5, 728, 3},
+    {1986, 7, 731, 3},
+    {1993, 4, 734, 3},
+    {1997, 5, 737, 1},
+    {2002, 6, 738, 3},
+    {2008, 20, 741, 3},
+    {2028, 14, 744, 6},
+    {2042, 9, 750, 3},
+    {0, 0, 0, 0},
+    {2051, 6, 753, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2057, 4, 756, 3},
+    {2061, 7, 759, 2},
+    {2068, 16, 761, 3},
+    {2084, 7, 764, 3},
+    {2091, 4, 767, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2095, 16, 768, 3},
+    {0, 0, 0, 0},
+    {2111, 7, 771, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2118, 7, 774, 3},
+    {0, 0, 0, 0},
+    {2125, 3, 777, 2},
+    {2128, 5, 779, 6},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2133, 6, 785, 2},
+    {2139, 20, 787, 3},
+    {0, 0, 0, 0},
+    {2159, 8, 790, 3},
+    {2167, 9, 793, 5},
+    {0, 0, 0, 0},
+    {2176, 9, 798, 3},
+    {2185, 5, 801, 2},
+    {2190, 9, 803, 2},
+    {2199, 7, 805, 3},
+    {2206, 4, 808, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2210, 8, 812, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2218, 4, 815, 4},
+    {0, 0, 0, 0},
+    {2222, 9, 819, 3},
+    {2231, 5, 822, 5},
+    {0, 0, 0, 0},
+    {2236, 9, 827, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2245, 8, 830, 3},
+    {0, 0, 0, 0},
+    {2253, 5, 833, 2},
+    {2258, 13, 835, 3},
+    {0, 0, 0, 0},
+    {2271, 11, 838, 3},
+    {0, 0, 0, 0},
+    {2282, 4, 841, 3},
+    {2286, 6, 844, 3},
+    {0, 0, 0, 0},
+    {2292, 3, 847, 1},
+    {2295, 13, 848, 3},
+    {0, 0, 0, 0},
+    {2308, 10, 851, 3},
+    {2318, 6, 854, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2324, 6, 857, 3},
+    {0, 0, 0, 0},
+    {2330, 5, 860, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2335, 9, 863, 3},
+    {0, 0, 0, 0},
+    {2344, 6, 866, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2350, 5, 869, 3},
+    {2355, 5, 872, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2360, 8, 875, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2368, 7, 878, 2},
+    {2375, 5, 880, 3},
+    {2380, 6, 883, 3},
+    {2386, 6, 886, 3},
+    {0, 0, 0, 0},
+    {2392, 7, 889, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2399, 13, 891, 3},
+    {2412, 8, 894, 3},
+    {2420, 5, 897, 3},
+    {0, 0, 0, 0},
+    {2425, 9, 900, 3},
+    {2434, 8, 903, 3},
+    {2442, 8, 906, 3},
+    {2450, 4, 909, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2454, 5, 912, 5},
+    {2459, 4, 917, 2},
+    {2463, 5, 919, 2},
+    {0, 0, 0, 0},
+    {2468, 7, 921, 3},
+    {2475, 6, 924, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2481, 12, 927, 3},
+    {2493, 5, 930, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2498, 5, 934, 3},
+    {2503, 6, 937, 3},
+    {2509, 6, 940, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2515, 6, 943, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2521, 17, 945, 5},
+    {2538, 7, 950, 3},
+    {2545, 5, 953, 4},
+    {2550, 4, 957, 2},
+    {0, 0, 0, 0},
+    {2554, 5, 959, 3},
+    {0, 0, 0, 0},
+    {2559, 6, 962, 6},
+    {2565, 6, 968, 3},
+    {0, 0, 0, 0},
+    {2571, 4, 971, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2575, 9, 974, 3},
+    {2584, 21, 977, 3},
+    {2605, 7, 980, 3},
+    {0, 0, 0, 0},
+    {2612, 6, 983, 3},
+    {2618, 12, 986, 3},
+    {0, 0, 0, 0},
+    {2630, 4, 989, 2},
+    {2634, 3, 991, 3},
+    {0, 0, 0, 0},
+    {2637, 15, 994, 3},
+    {0, 0, 0, 0},
+    {2652, 6, 997, 3},
+    {2658, 10, 1000, 3},
+    {0, 0, 0, 0},
+    {2668, 8, 1003, 3},
+    {0, 0, 0, 0},
+    {2676, 6, 1006, 3},
+    {2682, 5, 1009, 4},
+    {0, 0, 0, 0},
+    {2687, 8, 1013, 2},
+    {0, 0, 0, 0},
+    {2695, 7, 1015, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2702, 4, 1018, 3},
+    {0, 0, 0, 0},
+    {2706, 7, 1021, 3},
+    {2713, 6, 1024, 3},
+    {2719, 10, 1027, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2729, 7, 1030, 3},
+    {2736, 15, 1033, 3},
+    {2751, 22, 1036, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2773, 6, 1039, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2779, 12, 1041, 3},
+    {2791, 5, 1044, 3},
+    {2796, 7, 1047, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2803, 16, 1049, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2819, 8, 1052, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2827, 5, 1055, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {2832, 8, 1059, 3},
+    {0, 0, 0, 0},
+    {2840, 6, 1062, 3},
+    {2846, 5, 1065, 5},
+    {0, 0, 0, 0},
+    {2851, 5, 1070, 2},
+    {0, 0, 0, 0},
+    {2856, 8, 1072, 3},
+    {2864, 4, 1075, 4},
+    {2868, 5, 1079, 1},
+    {2873, 6, 1080, 3},
+    {0, 0, 0, 0},
+    {2879, 5, 1083, 3},
+    {2884, 8, 1086, 3},
+    {2892, 5, 1089, 3},
+    {0, 0, 0, 0},
+    {2897, 7, 1092, 3},
+    {2904, 7, 1095, 3},
+    {2911, 6, 1098, 2},
+    {0, 0, 0, 0},
+    {2917, 6, 1100, 3},
+    {2923, 5, 1103, 3},
+    {2928, 7, 1106, 3},
+    {0, 0, 0, 0},
+    {2935, 6, 1109, 3},
+    {0, 0, 0, 0},
+    {2941, 6, 1112, 3},
+    {2947, 5, 1115, 3},
+    {2952, 8, 1118, 3},
+    {2960, 6, 1121, 3},
+    {0, 0, 0, 0},
+    {2966, 5, 1124, 3},
+    {0, 0, 0, 0},
+    {2971, 7, 1127, 3},
+    {2978, 15, 1130, 3},
+    {2993, 6, 1133, 3},
+    {2999, 6, 1136, 2},
+    {3005, 7, 1138, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3012, 6, 1141, 3},
+    {3018, 7, 1144, 2},
+    {3025, 4, 1146, 2},
+    {3029, 6, 1148, 2},
+    {3035, 4, 1150, 2},
+    {0, 0, 0, 0},
+    {3039, 5, 1152, 2},
+    {3044, 15, 1154, 3},
+    {0, 0, 0, 0},
+    {3059, 12, 1157, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3071, 4, 1160, 3},
+    {3075, 4, 1163, 2},
+    {0, 0, 0, 0},
+    {3079, 9, 1165, 3},
+    {3088, 6, 1168, 3},
+    {3094, 6, 1171, 5},
+    {3100, 17, 1176, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3117, 5, 1179, 6},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3122, 6, 1185, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3128, 7, 1188, 2},
+    {3135, 5, 1190, 2},
+    {0, 0, 0, 0},
+    {3140, 8, 1192, 3},
+    {3148, 7, 1195, 3},
+    {3155, 10, 1198, 2},
+    {3165, 7, 1200, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3172, 6, 1203, 2},
+    {3178, 6, 1205, 3},
+    {3184, 9, 1208, 3},
+    {3193, 6, 1211, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3199, 11, 1214, 3},
+    {3210, 6, 1217, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3216, 17, 1220, 3},
+    {0, 0, 0, 0},
+    {3233, 7, 1223, 3},
+    {0, 0, 0, 0},
+    {3240, 8, 1226, 3},
+    {0, 0, 0, 0},
+    {3248, 8, 1229, 3},
+    {3256, 3, 1232, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3259, 6, 1234, 3},
+    {3265, 6, 1237, 3},
+    {3271, 4, 1240, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3275, 9, 1243, 3},
+    {3284, 16, 1246, 3},
+    {3300, 9, 1249, 3},
+    {3309, 5, 1252, 3},
+    {3314, 7, 1255, 3},
+    {3321, 5, 1258, 1},
+    {3326, 6, 1259, 2},
+    {3332, 6, 1261, 3},
+    {3338, 6, 1264, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3344, 5, 1267, 3},
+    {3349, 5, 1270, 2},
+    {0, 0, 0, 0},
+    {3354, 12, 1272, 3},
+    {0, 0, 0, 0},
+    {3366, 7, 1275, 3},
+    {3373, 11, 1278, 3},
+    {3384, 4, 1281, 2},
+    {3388, 5, 1283, 3},
+    {3393, 7, 1286, 3},
+    {0, 0, 0, 0},
+    {3400, 5, 1289, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3405, 7, 1292, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3412, 5, 1295, 3},
+    {0, 0, 0, 0},
+    {3417, 12, 1298, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3429, 8, 1301, 3},
+    {3437, 7, 1304, 2},
+    {3444, 5, 1306, 3},
+    {3449, 5, 1309, 3},
+    {0, 0, 0, 0},
+    {3454, 8, 1312, 3},
+    {0, 0, 0, 0},
+    {3462, 4, 1315, 2},
+    {3466, 5, 1317, 3},
+    {3471, 6, 1320, 2},
+    {3477, 6, 1322, 3},
+    {3483, 10, 1325, 3},
+    {0, 0, 0, 0},
+    {3493, 10, 1328, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3503, 9, 1331, 3},
+    {3512, 5, 1334, 3},
+    {3517, 6, 1337, 3},
+    {0, 0, 0, 0},
+    {3523, 6, 1340, 3},
+    {3529, 6, 1343, 3},
+    {3535, 13, 1346, 6},
+    {3548, 3, 1352, 1},
+    {3551, 12, 1353, 3},
+    {3563, 4, 1356, 2},
+    {3567, 7, 1358, 2},
+    {3574, 7, 1360, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3581, 7, 1363, 1},
+    {0, 0, 0, 0},
+    {3588, 7, 1364, 2},
+    {3595, 4, 1366, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3599, 5, 1370, 2},
+    {0, 0, 0, 0},
+    {3604, 17, 1372, 3},
+    {3621, 6, 1375, 2},
+    {3627, 8, 1377, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3635, 5, 1380, 2},
+    {0, 0, 0, 0},
+    {3640, 5, 1382, 4},
+    {3645, 6, 1386, 2},
+    {3651, 9, 1388, 3},
+    {0, 0, 0, 0},
+    {3660, 6, 1391, 2},
+    {3666, 7, 1393, 3},
+    {3673, 8, 1396, 3},
+    {3681, 7, 1399, 3},
+    {3688, 7, 1402, 3},
+    {3695, 7, 1405, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3702, 7, 1408, 3},
+    {0, 0, 0, 0},
+    {3709, 5, 1411, 3},
+    {3714, 5, 1414, 4},
+    {3719, 5, 1418, 3},
+    {3724, 6, 1421, 3},
+    {3730, 6, 1424, 2},
+    {3736, 10, 1426, 2},
+    {0, 0, 0, 0},
+    {3746, 7, 1428, 3},
+    {3753, 5, 1431, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3758, 14, 1433, 3},
+    {3772, 7, 1436, 2},
+    {0, 0, 0, 0},
+    {3779, 6, 1438, 2},
+    {3785, 6, 1440, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3791, 7, 1442, 3},
+    {3798, 6, 1445, 3},
+    {3804, 7, 1448, 2},
+    {3811, 6, 1450, 2},
+    {3817, 5, 1452, 4},
+    {3822, 10, 1456, 6},
+    {0, 0, 0, 0},
+    {3832, 6, 1462, 5},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3838, 6, 1467, 3},
+    {3844, 5, 1470, 3},
+    {3849, 5, 1473, 3},
+    {3854, 13, 1476, 5},
+    {0, 0, 0, 0},
+    {3867, 7, 1481, 3},
+    {0, 0, 0, 0},
+    {3874, 7, 1484, 2},
+    {0, 0, 0, 0},
+    {3881, 5, 1486, 3},
+    {3886, 6, 1489, 3},
+    {0, 0, 0, 0},
+    {3892, 8, 1492, 3},
+    {3900, 3, 1495, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3903, 7, 1498, 3},
+    {3910, 5, 1501, 2},
+    {3915, 4, 1503, 3},
+    {0, 0, 0, 0},
+    {3919, 7, 1506, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3926, 6, 1509, 2},
+    {3932, 9, 1511, 3},
+    {3941, 11, 1514, 3},
+    {3952, 5, 1517, 3},
+    {3957, 5, 1520, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3962, 5, 1523, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3967, 4, 1526, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3971, 4, 1528, 3},
+    {0, 0, 0, 0},
+    {3975, 13, 1531, 3},
+    {3988, 7, 1534, 3},
+    {0, 0, 0, 0},
+    {3995, 4, 1537, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {3999, 7, 1540, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4006, 5, 1542, 3},
+    {0, 0, 0, 0},
+    {4011, 4, 1545, 2},
+    {4015, 7, 1547, 6},
+    {0, 0, 0, 0},
+    {4022, 12, 1553, 2},
+    {4034, 4, 1555, 3},
+    {0, 0, 0, 0},
+    {4038, 4, 1558, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4042, 4, 1561, 4},
+    {4046, 4, 1565, 2},
+    {4050, 6, 1567, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4056, 11, 1569, 3},
+    {0, 0, 0, 0},
+    {4067, 14, 1572, 3},
+    {0, 0, 0, 0},
+    {4081, 4, 1575, 4},
+    {0, 0, 0, 0},
+    {4085, 4, 1579, 2},
+    {0, 0, 0, 0},
+    {4089, 3, 1581, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4092, 4, 1584, 3},
+    {4096, 5, 1587, 4},
+    {4101, 5, 1591, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4106, 18, 1593, 5},
+    {4124, 4, 1598, 3},
+    {4128, 19, 1601, 5},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4147, 6, 1606, 3},
+    {4153, 4, 1609, 2},
+    {0, 0, 0, 0},
+    {4157, 8, 1611, 3},
+    {4165, 6, 1614, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4171, 7, 1616, 3},
+    {4178, 6, 1619, 3},
+    {4184, 8, 1622, 3},
+    {4192, 5, 1625, 2},
+    {4197, 6, 1627, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4203, 6, 1629, 2},
+    {4209, 16, 1631, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4225, 21, 1634, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4246, 8, 1637, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4254, 7, 1640, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4261, 5, 1642, 3},
+    {4266, 7, 1645, 3},
+    {4273, 15, 1648, 3},
+    {4288, 5, 1651, 3},
+    {4293, 6, 1654, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4299, 9, 1657, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4308, 7, 1660, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4315, 5, 1663, 3},
+    {0, 0, 0, 0},
+    {4320, 5, 1666, 3},
+    {4325, 7, 1669, 2},
+    {4332, 5, 1671, 4},
+    {4337, 15, 1675, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4352, 7, 1678, 3},
+    {4359, 9, 1681, 5},
+    {4368, 5, 1686, 2},
+    {4373, 6, 1688, 2},
+    {4379, 7, 1690, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4386, 6, 1693, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4392, 5, 1696, 4},
+    {4397, 18, 1700, 3},
+    {4415, 4, 1703, 2},
+    {4419, 7, 1705, 3},
+    {0, 0, 0, 0},
+    {4426, 15, 1708, 3},
+    {4441, 7, 1711, 1},
+    {0, 0, 0, 0},
+    {4448, 7, 1712, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4455, 7, 1715, 3},
+    {4462, 6, 1718, 2},
+    {0, 0, 0, 0},
+    {4468, 7, 1720, 2},
+    {4475, 7, 1722, 3},
+    {4482, 18, 1725, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4500, 3, 1728, 3},
+    {4503, 5, 1731, 4},
+    {4508, 5, 1735, 2},
+    {0, 0, 0, 0},
+    {4513, 6, 1737, 3},
+    {4519, 9, 1740, 3},
+    {4528, 6, 1743, 2},
+    {0, 0, 0, 0},
+    {4534, 6, 1745, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4540, 5, 1747, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4545, 4, 1750, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4549, 7, 1752, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4556, 7, 1754, 3},
+    {4563, 7, 1757, 3},
+    {0, 0, 0, 0},
+    {4570, 8, 1760, 3},
+    {4578, 18, 1763, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4596, 5, 1766, 4},
+    {0, 0, 0, 0},
+    {4601, 4, 1770, 1},
+    {4605, 6, 1771, 3},
+    {4611, 18, 1774, 3},
+    {4629, 5, 1777, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4634, 9, 1780, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4643, 5, 1783, 2},
+    {4648, 5, 1785, 2},
+    {4653, 4, 1787, 2},
+    {4657, 5, 1789, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4662, 6, 1793, 3},
+    {0, 0, 0, 0},
+    {4668, 8, 1796, 3},
+    {4676, 20, 1799, 5},
+    {4696, 5, 1804, 3},
+    {0, 0, 0, 0},
+    {4701, 5, 1807, 2},
+    {0, 0, 0, 0},
+    {4706, 4, 1809, 6},
+    {4710, 4, 1815, 2},
+    {4714, 13, 1817, 3},
+    {4727, 13, 1820, 3},
+    {0, 0, 0, 0},
+    {4740, 4, 1823, 3},
+    {4744, 6, 1826, 3},
+    {0, 0, 0, 0},
+    {4750, 6, 1829, 3},
+    {4756, 4, 1832, 4},
+    {4760, 4, 1836, 2},
+    {4764, 7, 1838, 3},
+    {4771, 15, 1841, 3},
+    {4786, 6, 1844, 5},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4792, 7, 1849, 2},
+    {0, 0, 0, 0},
+    {4799, 9, 1851, 3},
+    {4808, 7, 1854, 2},
+    {0, 0, 0, 0},
+    {4815, 13, 1856, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4828, 6, 1859, 3},
+    {4834, 4, 1862, 2},
+    {4838, 3, 1864, 3},
+    {4841, 9, 1867, 3},
+    {0, 0, 0, 0},
+    {4850, 7, 1870, 3},
+    {0, 0, 0, 0},
+    {4857, 9, 1873, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4866, 4, 1876, 2},
+    {4870, 7, 1878, 2},
+    {0, 0, 0, 0},
+    {4877, 18, 1880, 3},
+    {4895, 7, 1883, 2},
+    {4902, 9, 1885, 3},
+    {4911, 6, 1888, 3},
+    {4917, 5, 1891, 3},
+    {4922, 8, 1894, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4930, 7, 1897, 2},
+    {4937, 5, 1899, 3},
+    {4942, 7, 1902, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4949, 7, 1904, 2},
+    {4956, 12, 1906, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4968, 6, 1909, 3},
+    {0, 0, 0, 0},
+    {4974, 18, 1912, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {4992, 10, 1915, 3},
+    {5002, 3, 1918, 3},
+    {0, 0, 0, 0},
+    {5005, 4, 1921, 2},
+    {0, 0, 0, 0},
+    {5009, 7, 1923, 3},
+    {0, 0, 0, 0},
+    {5016, 7, 1926, 3},
+    {0, 0, 0, 0},
+    {5023, 15, 1929, 3},
+    {5038, 7, 1932, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5045, 4, 1934, 3},
+    {5049, 7, 1937, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5056, 4, 1940, 4},
+    {5060, 6, 1944, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5066, 6, 1947, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5072, 6, 1949, 3},
+    {5078, 6, 1952, 5},
+    {0, 0, 0, 0},
+    {5084, 7, 1957, 3},
+    {0, 0, 0, 0},
+    {5091, 9, 1960, 3},
+    {5100, 9, 1963, 3},
+    {0, 0, 0, 0},
+    {5109, 6, 1966, 3},
+    {5115, 7, 1969, 3},
+    {5122, 6, 1972, 3},
+    {5128, 11, 1975, 3},
+    {5139, 6, 1978, 3},
+    {5145, 4, 1981, 4},
+    {5149, 6, 1985, 2},
+    {0, 0, 0, 0},
+    {5155, 8, 1987, 3},
+    {5163, 4, 1990, 2},
+    {5167, 6, 1992, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5173, 7, 1994, 2},
+    {5180, 6, 1996, 3},
+    {5186, 4, 1999, 2},
+    {0, 0, 0, 0},
+    {5190, 13, 2001, 6},
+    {0, 0, 0, 0},
+    {5203, 6, 2007, 2},
+    {5209, 7, 2009, 3},
+    {5216, 3, 2012, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5219, 5, 2015, 3},
+    {0, 0, 0, 0},
+    {5224, 8, 2018, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5232, 5, 2021, 2},
+    {5237, 20, 2023, 3},
+    {0, 0, 0, 0},
+    {5257, 9, 2026, 3},
+    {5266, 5, 2029, 4},
+    {0, 0, 0, 0},
+    {5271, 4, 2033, 4},
+    {0, 0, 0, 0},
+    {5275, 4, 2037, 3},
+    {5279, 6, 2040, 5},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5285, 8, 2045, 3},
+    {5293, 6, 2048, 2},
+    {5299, 12, 2050, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5311, 6, 2053, 2},
+    {5317, 13, 2055, 3},
+    {0, 0, 0, 0},
+    {5330, 6, 2058, 1},
+    {0, 0, 0, 0},
+    {5336, 4, 2059, 4},
+    {5340, 7, 2063, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5347, 8, 2065, 3},
+    {5355, 6, 2068, 3},
+    {5361, 6, 2071, 3},
+    {5367, 6, 2074, 3},
+    {0, 0, 0, 0},
+    {5373, 7, 2077, 2},
+    {5380, 7, 2079, 3},
+    {5387, 4, 2082, 3},
+    {5391, 3, 2085, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5394, 5, 2088, 5},
+    {5399, 7, 2093, 3},
+    {5406, 8, 2096, 3},
+    {0, 0, 0, 0},
+    {5414, 6, 2099, 2},
+    {0, 0, 0, 0},
+    {5420, 4, 2101, 2},
+    {5424, 7, 2103, 1},
+    {5431, 16, 2104, 5},
+    {5447, 4, 2109, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5451, 6, 2113, 3},
+    {5457, 5, 2116, 6},
+    {5462, 5, 2122, 3},
+    {5467, 5, 2125, 3},
+    {0, 0, 0, 0},
+    {5472, 3, 2128, 3},
+    {0, 0, 0, 0},
+    {5475, 8, 2131, 3},
+    {5483, 6, 2134, 3},
+    {5489, 16, 2137, 3},
+    {5505, 6, 2140, 2},
+    {5511, 3, 2142, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5514, 7, 2144, 2},
+    {0, 0, 0, 0},
+    {5521, 7, 2146, 3},
+    {0, 0, 0, 0},
+    {5528, 5, 2149, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5533, 6, 2153, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5539, 17, 2156, 3},
+    {0, 0, 0, 0},
+    {5556, 12, 2159, 3},
+    {5568, 11, 2162, 3},
+    {0, 0, 0, 0},
+    {5579, 6, 2165, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5585, 4, 2167, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5589, 3, 2171, 3},
+    {5592, 4, 2174, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5596, 7, 2176, 3},
+    {0, 0, 0, 0},
+    {5603, 9, 2179, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5612, 3, 2182, 3},
+    {5615, 6, 2185, 3},
+    {0, 0, 0, 0},
+    {5621, 7, 2188, 3},
+    {0, 0, 0, 0},
+    {5628, 7, 2191, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5635, 7, 2193, 2},
+    {5642, 9, 2195, 3},
+    {5651, 6, 2198, 2},
+    {5657, 8, 2200, 6},
+    {5665, 8, 2206, 6},
+    {0, 0, 0, 0},
+    {5673, 5, 2212, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5678, 3, 2216, 1},
+    {5681, 8, 2217, 2},
+    {5689, 6, 2219, 3},
+    {0, 0, 0, 0},
+    {5695, 6, 2222, 3},
+    {5701, 7, 2225, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5708, 6, 2227, 3},
+    {5714, 5, 2230, 2},
+    {5719, 9, 2232, 3},
+    {5728, 6, 2235, 3},
+    {5734, 11, 2238, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5745, 7, 2240, 3},
+    {0, 0, 0, 0},
+    {5752, 10, 2243, 3},
+    {0, 0, 0, 0},
+    {5762, 4, 2246, 3},
+    {0, 0, 0, 0},
+    {5766, 5, 2249, 4},
+    {5771, 7, 2253, 3},
+    {5778, 7, 2256, 3},
+    {0, 0, 0, 0},
+    {5785, 10, 2259, 3},
+    {5795, 19, 2262, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5814, 4, 2265, 2},
+    {5818, 6, 2267, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5824, 5, 2269, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5829, 15, 2271, 3},
+    {5844, 8, 2274, 3},
+    {5852, 6, 2277, 2},
+    {5858, 6, 2279, 3},
+    {5864, 11, 2282, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5875, 4, 2285, 3},
+    {5879, 7, 2288, 3},
+    {0, 0, 0, 0},
+    {5886, 16, 2291, 3},
+    {5902, 7, 2294, 2},
+    {5909, 5, 2296, 2},
+    {0, 0, 0, 0},
+    {5914, 5, 2298, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5919, 4, 2302, 2},
+    {0, 0, 0, 0},
+    {5923, 7, 2304, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5930, 7, 2307, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5937, 8, 2310, 3},
+    {5945, 3, 2313, 3},
+    {5948, 14, 2316, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5962, 7, 2319, 3},
+    {5969, 7, 2322, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5976, 6, 2325, 3},
+    {0, 0, 0, 0},
+    {5982, 7, 2328, 3},
+    {5989, 7, 2331, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {5996, 5, 2334, 3},
+    {6001, 5, 2337, 3},
+    {0, 0, 0, 0},
+    {6006, 2, 2340, 1},
+    {0, 0, 0, 0},
+    {6008, 6, 2341, 3},
+    {0, 0, 0, 0},
+    {6014, 18, 2344, 5},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6032, 5, 2349, 3},
+    {0, 0, 0, 0},
+    {6037, 7, 2352, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6044, 7, 2355, 3},
+    {0, 0, 0, 0},
+    {6051, 7, 2358, 3},
+    {0, 0, 0, 0},
+    {6058, 5, 2361, 3},
+    {6063, 21, 2364, 3},
+    {6084, 6, 2367, 2},
+    {6090, 6, 2369, 3},
+    {6096, 7, 2372, 3},
+    {6103, 8, 2375, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6111, 7, 2378, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6118, 5, 2381, 3},
+    {0, 0, 0, 0},
+    {6123, 10, 2384, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6133, 5, 2387, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6138, 16, 2390, 3},
+    {6154, 6, 2393, 3},
+    {0, 0, 0, 0},
+    {6160, 4, 2396, 3},
+    {0, 0, 0, 0},
+    {6164, 17, 2399, 2},
+    {6181, 4, 2401, 3},
+    {0, 0, 0, 0},
+    {6185, 7, 2404, 3},
+    {6192, 4, 2407, 2},
+    {6196, 8, 2409, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6204, 4, 2412, 3},
+    {6208, 11, 2415, 3},
+    {6219, 4, 2418, 2},
+    {6223, 11, 2420, 3},
+    {6234, 5, 2423, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6239, 18, 2425, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6257, 4, 2428, 3},
+    {0, 0, 0, 0},
+    {6261, 7, 2431, 2},
+    {6268, 7, 2433, 2},
+    {0, 0, 0, 0},
+    {6275, 5, 2435, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6280, 5, 2439, 3},
+    {6285, 7, 2442, 5},
+    {6292, 5, 2447, 4},
+    {0, 0, 0, 0},
+    {6297, 7, 2451, 2},
+    {0, 0, 0, 0},
+    {6304, 7, 2453, 3},
+    {6311, 6, 2456, 3},
+    {0, 0, 0, 0},
+    {6317, 6, 2459, 3},
+    {0, 0, 0, 0},
+    {6323, 7, 2462, 3},
+    {6330, 3, 2465, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6333, 6, 2467, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6339, 12, 2469, 6},
+    {6351, 4, 2475, 2},
+    {6355, 7, 2477, 1},
+    {6362, 15, 2478, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6377, 6, 2481, 3},
+    {0, 0, 0, 0},
+    {6383, 6, 2484, 2},
+    {6389, 7, 2486, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6396, 4, 2488, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6400, 6, 2491, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6406, 9, 2493, 3},
+    {6415, 5, 2496, 4},
+    {0, 0, 0, 0},
+    {6420, 5, 2500, 2},
+    {0, 0, 0, 0},
+    {6425, 7, 2502, 3},
+    {6432, 4, 2505, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6436, 13, 2508, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6449, 5, 2511, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6454, 6, 2515, 3},
+    {0, 0, 0, 0},
+    {6460, 5, 2518, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6465, 5, 2521, 4},
+    {0, 0, 0, 0},
+    {6470, 7, 2525, 3},
+    {6477, 7, 2528, 3},
+    {6484, 9, 2531, 3},
+    {6493, 4, 2534, 2},
+    {0, 0, 0, 0},
+    {6497, 4, 2536, 4},
+    {0, 0, 0, 0},
+    {6501, 5, 2540, 4},
+    {6506, 5, 2544, 2},
+    {0, 0, 0, 0},
+    {6511, 6, 2546, 3},
+    {6517, 14, 2549, 6},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6531, 7, 2555, 3},
+    {0, 0, 0, 0},
+    {6538, 4, 2558, 2},
+    {6542, 32, 2560, 3},
+    {6574, 12, 2563, 3},
+    {6586, 12, 2566, 3},
+    {0, 0, 0, 0},
+    {6598, 7, 2569, 3},
+    {0, 0, 0, 0},
+    {6605, 17, 2572, 3},
+    {6622, 6, 2575, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6628, 6, 2577, 3},
+    {6634, 11, 2580, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6645, 5, 2583, 2},
+    {6650, 6, 2585, 3},
+    {0, 0, 0, 0},
+    {6656, 6, 2588, 2},
+    {6662, 6, 2590, 2},
+    {6668, 5, 2592, 3},
+    {0, 0, 0, 0},
+    {6673, 10, 2595, 3},
+    {6683, 6, 2598, 3},
+    {6689, 22, 2601, 3},
+    {6711, 7, 2604, 3},
+    {0, 0, 0, 0},
+    {6718, 4, 2607, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6722, 6, 2610, 3},
+    {6728, 6, 2613, 2},
+    {0, 0, 0, 0},
+    {6734, 4, 2615, 1},
+    {0, 0, 0, 0},
+    {6738, 7, 2616, 2},
+    {6745, 5, 2618, 3},
+    {6750, 9, 2621, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6759, 7, 2624, 3},
+    {6766, 7, 2627, 3},
+    {6773, 10, 2630, 3},
+    {6783, 17, 2633, 3},
+    {6800, 15, 2636, 3},
+    {6815, 7, 2639, 3},
+    {6822, 7, 2642, 2},
+    {6829, 7, 2644, 3},
+    {6836, 6, 2647, 3},
+    {0, 0, 0, 0},
+    {6842, 6, 2650, 3},
+    {0, 0, 0, 0},
+    {6848, 13, 2653, 3},
+    {0, 0, 0, 0},
+    {6861, 7, 2656, 3},
+    {6868, 11, 2659, 3},
+    {6879, 15, 2662, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6894, 6, 2665, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6900, 7, 2668, 2},
+    {6907, 6, 2670, 3},
+    {6913, 7, 2673, 3},
+    {6920, 6, 2676, 2},
+    {6926, 4, 2678, 3},
+    {6930, 6, 2681, 2},
+    {6936, 7, 2683, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {6943, 8, 2685, 1},
+    {6951, 7, 2686, 3},
+    {6958, 7, 2689, 3},
+    {6965, 7, 2692, 2},
+    {6972, 5, 2694, 3},
+    {0, 0, 0, 0},
+    {6977, 9, 2697, 3},
+    {0, 0, 0, 0},
+    {6986, 5, 2700, 2},
+    {0, 0, 0, 0},
+    {6991, 8, 2702, 3},
+    {6999, 18, 2705, 3},
+    {0, 0, 0, 0},
+    {7017, 6, 2708, 3},
+    {7023, 6, 2711, 2},
+    {7029, 7, 2713, 2},
+    {7036, 4, 2715, 1},
+    {7040, 5, 2716, 4},
+    {0, 0, 0, 0},
+    {7045, 12, 2720, 3},
+    {7057, 7, 2723, 2},
+    {7064, 6, 2725, 2},
+    {7070, 3, 2727, 3},
+    {7073, 19, 2730, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7092, 7, 2733, 2},
+    {0, 0, 0, 0},
+    {7099, 24, 2735, 5},
+    {0, 0, 0, 0},
+    {7123, 6, 2740, 3},
+    {7129, 5, 2743, 3},
+    {0, 0, 0, 0},
+    {7134, 3, 2746, 3},
+    {7137, 6, 2749, 3},
+    {7143, 9, 2752, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7152, 5, 2755, 3},
+    {7157, 8, 2758, 3},
+    {0, 0, 0, 0},
+    {7165, 5, 2761, 3},
+    {7170, 7, 2764, 3},
+    {7177, 10, 2767, 6},
+    {7187, 9, 2773, 3},
+    {0, 0, 0, 0},
+    {7196, 6, 2776, 3},
+    {7202, 6, 2779, 2},
+    {0, 0, 0, 0},
+    {7208, 14, 2781, 3},
+    {0, 0, 0, 0},
+    {7222, 4, 2784, 2},
+    {7226, 9, 2786, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7235, 9, 2789, 3},
+    {7244, 7, 2792, 2},
+    {0, 0, 0, 0},
+    {7251, 5, 2794, 3},
+    {7256, 7, 2797, 3},
+    {7263, 8, 2800, 3},
+    {7271, 9, 2803, 3},
+    {7280, 6, 2806, 3},
+    {7286, 5, 2809, 3},
+    {7291, 6, 2812, 3},
+    {7297, 5, 2815, 2},
+    {7302, 6, 2817, 3},
+    {7308, 4, 2820, 4},
+    {7312, 5, 2824, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7317, 5, 2828, 2},
+    {7322, 7, 2830, 3},
+    {0, 0, 0, 0},
+    {7329, 2, 2833, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7331, 8, 2834, 3},
+    {7339, 13, 2837, 3},
+    {7352, 11, 2840, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7363, 22, 2843, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7385, 4, 2846, 2},
+    {7389, 4, 2848, 2},
+    {7393, 15, 2850, 3},
+    {0, 0, 0, 0},
+    {7408, 5, 2853, 4},
+    {0, 0, 0, 0},
+    {7413, 6, 2857, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7419, 6, 2859, 2},
+    {7425, 6, 2861, 2},
+    {0, 0, 0, 0},
+    {7431, 9, 2863, 3},
+    {7440, 8, 2866, 3},
+    {7448, 14, 2869, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7462, 5, 2872, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7467, 5, 2874, 3},
+    {0, 0, 0, 0},
+    {7472, 5, 2877, 2},
+    {7477, 6, 2879, 2},
+    {0, 0, 0, 0},
+    {7483, 4, 2881, 3},
+    {7487, 5, 2884, 2},
+    {0, 0, 0, 0},
+    {7492, 3, 2886, 2},
+    {7495, 16, 2888, 3},
+    {7511, 7, 2891, 1},
+    {0, 0, 0, 0},
+    {7518, 5, 2892, 3},
+    {7523, 9, 2895, 3},
+    {7532, 7, 2898, 3},
+    {7539, 5, 2901, 4},
+    {7544, 6, 2905, 3},
+    {7550, 7, 2908, 6},
+    {7557, 4, 2914, 2},
+    {7561, 7, 2916, 2},
+    {7568, 15, 2918, 3},
+    {7583, 3, 2921, 3},
+    {7586, 15, 2924, 3},
+    {0, 0, 0, 0},
+    {7601, 19, 2927, 3},
+    {7620, 7, 2930, 3},
+    {7627, 4, 2933, 6},
+    {7631, 5, 2939, 4},
+    {7636, 6, 2943, 3},
+    {7642, 14, 2946, 5},
+    {7656, 7, 2951, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7663, 7, 2953, 2},
+    {7670, 6, 2955, 3},
+    {0, 0, 0, 0},
+    {7676, 6, 2958, 6},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7682, 8, 2964, 3},
+    {0, 0, 0, 0},
+    {7690, 7, 2967, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7697, 5, 2969, 2},
+    {7702, 7, 2971, 3},
+    {0, 0, 0, 0},
+    {7709, 15, 2974, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7724, 5, 2977, 2},
+    {7729, 9, 2979, 3},
+    {0, 0, 0, 0},
+    {7738, 5, 2982, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7743, 15, 2984, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7758, 3, 2987, 3},
+    {0, 0, 0, 0},
+    {7761, 4, 2990, 3},
+    {7765, 4, 2993, 3},
+    {7769, 5, 2996, 3},
+    {0, 0, 0, 0},
+    {7774, 6, 2999, 3},
+    {0, 0, 0, 0},
+    {7780, 11, 3002, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7791, 17, 3005, 3},
+    {0, 0, 0, 0},
+    {7808, 6, 3008, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7814, 5, 3010, 2},
+    {7819, 9, 3012, 3},
+    {7828, 7, 3015, 2},
+    {0, 0, 0, 0},
+    {7835, 7, 3017, 3},
+    {7842, 11, 3020, 3},
+    {7853, 7, 3023, 3},
+    {0, 0, 0, 0},
+    {7860, 6, 3026, 2},
+    {7866, 6, 3028, 3},
+    {7872, 6, 3031, 3},
+    {0, 0, 0, 0},
+    {7878, 4, 3034, 4},
+    {0, 0, 0, 0},
+    {7882, 5, 3038, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7887, 4, 3041, 2},
+    {7891, 15, 3043, 3},
+    {7906, 7, 3046, 2},
+    {7913, 7, 3048, 3},
+    {7920, 14, 3051, 3},
+    {7934, 6, 3054, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7940, 11, 3057, 3},
+    {7951, 8, 3060, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {7959, 5, 3063, 2},
+    {0, 0, 0, 0},
+    {7964, 3, 3065, 3},
+    {7967, 22, 3068, 3},
+    {0, 0, 0, 0},
+    {7989, 7, 3071, 2},
+    {7996, 5, 3073, 2},
+    {0, 0, 0, 0},
+    {8001, 5, 3075, 3},
+    {8006, 4, 3078, 3},
+    {8010, 5, 3081, 4},
+    {0, 0, 0, 0},
+    {8015, 7, 3085, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8022, 6, 3088, 3},
+    {0, 0, 0, 0},
+    {8028, 16, 3091, 3},
+    {8044, 6, 3094, 3},
+    {8050, 4, 3097, 4},
+    {0, 0, 0, 0},
+    {8054, 5, 3101, 1},
+    {8059, 6, 3102, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8065, 4, 3105, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8069, 7, 3109, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8076, 9, 3112, 3},
+    {0, 0, 0, 0},
+    {8085, 6, 3115, 3},
+    {0, 0, 0, 0},
+    {8091, 5, 3118, 5},
+    {8096, 5, 3123, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8101, 5, 3125, 3},
+    {0, 0, 0, 0},
+    {8106, 7, 3128, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8113, 5, 3130, 2},
+    {8118, 6, 3132, 2},
+    {0, 0, 0, 0},
+    {8124, 10, 3134, 3},
+    {8134, 14, 3137, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8148, 7, 3140, 3},
+    {0, 0, 0, 0},
+    {8155, 14, 3143, 3},
+    {8169, 6, 3146, 3},
+    {0, 0, 0, 0},
+    {8175, 6, 3149, 3},
+    {0, 0, 0, 0},
+    {8181, 8, 3152, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8189, 5, 3155, 4},
+    {0, 0, 0, 0},
+    {8194, 7, 3159, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8201, 8, 3161, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8209, 4, 3164, 5},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8213, 6, 3169, 3},
+    {8219, 7, 3172, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8226, 10, 3174, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8236, 7, 3177, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8243, 5, 3180, 4},
+    {8248, 4, 3184, 2},
+    {0, 0, 0, 0},
+    {8252, 5, 3186, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8257, 5, 3190, 3},
+    {8262, 4, 3193, 2},
+    {8266, 3, 3195, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8269, 7, 3198, 3},
+    {8276, 4, 3201, 2},
+    {8280, 10, 3203, 3},
+    {0, 0, 0, 0},
+    {8290, 5, 3206, 4},
+    {8295, 6, 3210, 3},
+    {0, 0, 0, 0},
+    {8301, 6, 3213, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8307, 4, 3216, 3},
+    {0, 0, 0, 0},
+    {8311, 5, 3219, 3},
+    {8316, 4, 3222, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8320, 7, 3225, 3},
+    {8327, 5, 3228, 6},
+    {8332, 7, 3234, 3},
+    {8339, 7, 3237, 3},
+    {8346, 4, 3240, 5},
+    {8350, 17, 3245, 2},
+    {8367, 6, 3247, 3},
+    {8373, 6, 3250, 3},
+    {8379, 5, 3253, 2},
+    {8384, 16, 3255, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8400, 8, 3258, 3},
+    {0, 0, 0, 0},
+    {8408, 5, 3261, 3},
+    {8413, 3, 3264, 3},
+    {8416, 6, 3267, 6},
+    {8422, 9, 3273, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8431, 8, 3276, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8439, 6, 3279, 3},
+    {8445, 4, 3282, 3},
+    {8449, 16, 3285, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8465, 6, 3288, 3},
+    {8471, 6, 3291, 2},
+    {8477, 8, 3293, 3},
+    {8485, 4, 3296, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8489, 4, 3299, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8493, 4, 3301, 3},
+    {8497, 7, 3304, 3},
+    {0, 0, 0, 0},
+    {8504, 5, 3307, 1},
+    {8509, 7, 3308, 3},
+    {0, 0, 0, 0},
+    {8516, 21, 3311, 3},
+    {8537, 4, 3314, 2},
+    {0, 0, 0, 0},
+    {8541, 7, 3316, 3},
+    {8548, 9, 3319, 3},
+    {8557, 4, 3322, 3},
+    {8561, 5, 3325, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8566, 5, 3328, 2},
+    {8571, 5, 3330, 4},
+    {8576, 6, 3334, 2},
+    {8582, 4, 3336, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8586, 6, 3339, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8592, 12, 3342, 3},
+    {8604, 4, 3345, 3},
+    {8608, 4, 3348, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8612, 14, 3350, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8626, 10, 3353, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8636, 6, 3356, 2},
+    {8642, 6, 3358, 3},
+    {8648, 4, 3361, 3},
+    {8652, 7, 3364, 3},
+    {8659, 7, 3367, 3},
+    {8666, 6, 3370, 3},
+    {8672, 16, 3373, 3},
+    {0, 0, 0, 0},
+    {8688, 17, 3376, 5},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8705, 8, 3381, 3},
+    {8713, 14, 3384, 3},
+    {8727, 12, 3387, 3},
+    {0, 0, 0, 0},
+    {8739, 5, 3390, 4},
+    {0, 0, 0, 0},
+    {8744, 9, 3394, 3},
+    {8753, 4, 3397, 2},
+    {0, 0, 0, 0},
+    {8757, 4, 3399, 3},
+    {0, 0, 0, 0},
+    {8761, 9, 3402, 3},
+    {8770, 8, 3405, 5},
+    {8778, 8, 3410, 3},
+    {0, 0, 0, 0},
+    {8786, 7, 3413, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8793, 5, 3415, 3},
+    {0, 0, 0, 0},
+    {8798, 7, 3418, 2},
+    {8805, 4, 3420, 2},
+    {8809, 7, 3422, 2},
+    {8816, 7, 3424, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8823, 10, 3427, 3},
+    {8833, 7, 3430, 2},
+    {8840, 8, 3432, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8848, 7, 3435, 2},
+    {0, 0, 0, 0},
+    {8855, 5, 3437, 4},
+    {8860, 5, 3441, 3},
+    {8865, 6, 3444, 3},
+    {8871, 10, 3447, 3},
+    {8881, 7, 3450, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8888, 15, 3452, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8903, 3, 3455, 3},
+    {8906, 9, 3458, 3},
+    {0, 0, 0, 0},
+    {8915, 5, 3461, 2},
+    {0, 0, 0, 0},
+    {8920, 5, 3463, 2},
+    {8925, 5, 3465, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8930, 12, 3466, 3},
+    {8942, 18, 3469, 3},
+    {8960, 5, 3472, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8965, 5, 3474, 4},
+    {0, 0, 0, 0},
+    {8970, 7, 3478, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8977, 6, 3481, 2},
+    {8983, 5, 3483, 4},
+    {8988, 9, 3487, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {8997, 5, 3490, 2},
+    {0, 0, 0, 0},
+    {9002, 6, 3492, 2},
+    {9008, 7, 3494, 3},
+    {0, 0, 0, 0},
+    {9015, 8, 3497, 3},
+    {0, 0, 0, 0},
+    {9023, 9, 3500, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9032, 13, 3503, 3},
+    {0, 0, 0, 0},
+    {9045, 4, 3506, 2},
+    {9049, 9, 3508, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9058, 6, 3511, 3},
+    {0, 0, 0, 0},
+    {9064, 8, 3514, 3},
+    {9072, 6, 3517, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9078, 10, 3520, 3},
+    {9088, 6, 3523, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9094, 7, 3526, 5},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9101, 5, 3531, 3},
+    {9106, 10, 3534, 3},
+    {9116, 7, 3537, 3},
+    {9123, 17, 3540, 3},
+    {9140, 17, 3543, 3},
+    {9157, 6, 3546, 3},
+    {0, 0, 0, 0},
+    {9163, 7, 3549, 3},
+    {9170, 5, 3552, 1},
+    {9175, 8, 3553, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9183, 6, 3556, 3},
+    {0, 0, 0, 0},
+    {9189, 6, 3559, 2},
+    {9195, 7, 3561, 2},
+    {9202, 18, 3563, 3},
+    {0, 0, 0, 0},
+    {9220, 6, 3566, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9226, 15, 3569, 3},
+    {0, 0, 0, 0},
+    {9241, 7, 3572, 2},
+    {0, 0, 0, 0},
+    {9248, 4, 3574, 3},
+    {0, 0, 0, 0},
+    {9252, 4, 3577, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9256, 4, 3579, 4},
+    {9260, 7, 3583, 3},
+    {9267, 14, 3586, 3},
+    {9281, 4, 3589, 3},
+    {9285, 4, 3592, 3},
+    {9289, 19, 3595, 3},
+    {0, 0, 0, 0},
+    {9308, 6, 3598, 3},
+    {9314, 6, 3601, 2},
+    {0, 0, 0, 0},
+    {9320, 7, 3603, 2},
+    {9327, 5, 3605, 2},
+    {9332, 14, 3607, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9346, 14, 3610, 3},
+    {0, 0, 0, 0},
+    {9360, 9, 3613, 3},
+    {0, 0, 0, 0},
+    {9369, 6, 3616, 3},
+    {0, 0, 0, 0},
+    {9375, 10, 3619, 3},
+    {0, 0, 0, 0},
+    {9385, 10, 3622, 3},
+    {0, 0, 0, 0},
+    {9395, 5, 3625, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9400, 5, 3627, 2},
+    {0, 0, 0, 0},
+    {9405, 7, 3629, 2},
+    {9412, 15, 3631, 3},
+    {9427, 8, 3634, 5},
+    {0, 0, 0, 0},
+    {9435, 6, 3639, 2},
+    {9441, 11, 3641, 3},
+    {9452, 5, 3644, 3},
+    {9457, 4, 3647, 2},
+    {9461, 6, 3649, 2},
+    {0, 0, 0, 0},
+    {9467, 5, 3651, 3},
+    {9472, 10, 3654, 3},
+    {0, 0, 0, 0},
+    {9482, 7, 3657, 2},
+    {9489, 13, 3659, 1},
+    {9502, 4, 3660, 3},
+    {9506, 5, 3663, 3},
+    {9511, 16, 3666, 3},
+    {9527, 7, 3669, 3},
+    {9534, 5, 3672, 3},
+    {9539, 5, 3675, 6},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9544, 7, 3681, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9551, 7, 3684, 2},
+    {9558, 6, 3686, 3},
+    {0, 0, 0, 0},
+    {9564, 8, 3689, 3},
+    {9572, 15, 3692, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9587, 12, 3695, 3},
+    {9599, 6, 3698, 3},
+    {9605, 9, 3701, 3},
+    {9614, 9, 3704, 3},
+    {0, 0, 0, 0},
+    {9623, 5, 3707, 5},
+    {9628, 6, 3712, 3},
+    {9634, 7, 3715, 2},
+    {0, 0, 0, 0},
+    {9641, 11, 3717, 3},
+    {9652, 9, 3720, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9661, 5, 3723, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9666, 14, 3725, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9680, 7, 3728, 3},
+    {9687, 5, 3731, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9692, 11, 3732, 3},
+    {0, 0, 0, 0},
+    {9703, 7, 3735, 5},
+    {9710, 8, 3740, 3},
+    {9718, 7, 3743, 3},
+    {9725, 4, 3746, 4},
+    {9729, 7, 3750, 3},
+    {9736, 17, 3753, 5},
+    {0, 0, 0, 0},
+    {9753, 8, 3758, 3},
+    {0, 0, 0, 0},
+    {9761, 9, 3761, 3},
+    {0, 0, 0, 0},
+    {9770, 4, 3764, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9774, 3, 3767, 1},
+    {9777, 11, 3768, 3},
+    {0, 0, 0, 0},
+    {9788, 6, 3771, 3},
+    {0, 0, 0, 0},
+    {9794, 8, 3774, 3},
+    {9802, 8, 3777, 3},
+    {0, 0, 0, 0},
+    {9810, 5, 3780, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9815, 16, 3783, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9831, 13, 3786, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9844, 5, 3789, 3},
+    {9849, 10, 3792, 3},
+    {9859, 7, 3795, 3},
+    {9866, 7, 3798, 3},
+    {9873, 5, 3801, 2},
+    {9878, 5, 3803, 3},
+    {9883, 5, 3806, 2},
+    {9888, 11, 3808, 3},
+    {9899, 6, 3811, 3},
+    {9905, 6, 3814, 3},
+    {0, 0, 0, 0},
+    {9911, 5, 3817, 2},
+    {9916, 6, 3819, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9922, 6, 3822, 3},
+    {9928, 8, 3825, 3},
+    {9936, 6, 3828, 3},
+    {9942, 6, 3831, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {9948, 6, 3834, 2},
+    {9954, 5, 3836, 4},
+    {9959, 15, 3840, 3},
+    {9974, 5, 3843, 2},
+    {9979, 13, 3845, 3},
+    {9992, 7, 3848, 3},
+    {0, 0, 0, 0},
+    {9999, 5, 3851, 4},
+    {10004, 6, 3855, 3},
+    {10010, 6, 3858, 3},
+    {10016, 8, 3861, 3},
+    {10024, 4, 3864, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10028, 6, 3866, 3},
+    {10034, 4, 3869, 3},
+    {10038, 18, 3872, 3},
+    {10056, 6, 3875, 2},
+    {0, 0, 0, 0},
+    {10062, 6, 3877, 3},
+    {0, 0, 0, 0},
+    {10068, 5, 3880, 1},
+    {0, 0, 0, 0},
+    {10073, 6, 3881, 2},
+    {10079, 16, 3883, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10095, 9, 3886, 3},
+    {0, 0, 0, 0},
+    {10104, 6, 3889, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10110, 5, 3892, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10115, 6, 3895, 3},
+    {10121, 9, 3898, 3},
+    {0, 0, 0, 0},
+    {10130, 8, 3901, 3},
+    {10138, 17, 3904, 3},
+    {10155, 6, 3907, 3},
+    {10161, 6, 3910, 5},
+    {10167, 11, 3915, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10178, 8, 3918, 3},
+    {10186, 10, 3921, 3},
+    {10196, 5, 3924, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10201, 5, 3926, 3},
+    {10206, 6, 3929, 3},
+    {0, 0, 0, 0},
+    {10212, 3, 3932, 3},
+    {0, 0, 0, 0},
+    {10215, 5, 3935, 2},
+    {10220, 7, 3937, 3},
+    {10227, 8, 3940, 3},
+    {10235, 4, 3943, 3},
+    {0, 0, 0, 0},
+    {10239, 7, 3946, 3},
+    {0, 0, 0, 0},
+    {10246, 5, 3949, 3},
+    {10251, 5, 3952, 4},
+    {0, 0, 0, 0},
+    {10256, 11, 3956, 3},
+    {0, 0, 0, 0},
+    {10267, 7, 3959, 3},
+    {10274, 4, 3962, 3},
+    {0, 0, 0, 0},
+    {10278, 7, 3965, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10285, 5, 3968, 3},
+    {10290, 7, 3971, 5},
+    {0, 0, 0, 0},
+    {10297, 16, 3976, 3},
+    {0, 0, 0, 0},
+    {10313, 10, 3979, 2},
+    {10323, 10, 3981, 3},
+    {10333, 7, 3984, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10340, 4, 3987, 5},
+    {10344, 6, 3992, 3},
+    {0, 0, 0, 0},
+    {10350, 4, 3995, 5},
+    {0, 0, 0, 0},
+    {10354, 5, 4000, 3},
+    {0, 0, 0, 0},
+    {10359, 14, 4003, 3},
+    {10373, 8, 4006, 2},
+    {10381, 4, 4008, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10385, 7, 4012, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10392, 5, 4015, 3},
+    {10397, 7, 4018, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10404, 7, 4021, 2},
+    {10411, 4, 4023, 3},
+    {0, 0, 0, 0},
+    {10415, 7, 4026, 3},
+    {10422, 6, 4029, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10428, 17, 4031, 2},
+    {0, 0, 0, 0},
+    {10445, 6, 4033, 3},
+    {10451, 5, 4036, 3},
+    {0, 0, 0, 0},
+    {10456, 5, 4039, 3},
+    {10461, 5, 4042, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10466, 21, 4045, 3},
+    {10487, 5, 4048, 3},
+    {10492, 6, 4051, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10498, 18, 4054, 3},
+    {10516, 5, 4057, 3},
+    {10521, 5, 4060, 2},
+    {10526, 7, 4062, 2},
+    {10533, 6, 4064, 2},
+    {10539, 6, 4066, 3},
+    {10545, 25, 4069, 3},
+    {0, 0, 0, 0},
+    {10570, 7, 4072, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10577, 5, 4075, 2},
+    {10582, 9, 4077, 3},
+    {10591, 3, 4080, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10594, 6, 4081, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10600, 6, 4084, 3},
+    {10606, 4, 4087, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10610, 3, 4091, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10613, 3, 4093, 3},
+    {10616, 6, 4096, 3},
+    {10622, 5, 4099, 4},
+    {10627, 6, 4103, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10633, 4, 4105, 2},
+    {10637, 7, 4107, 3},
+    {10644, 7, 4110, 2},
+    {10651, 3, 4112, 3},
+    {0, 0, 0, 0},
+    {10654, 8, 4115, 3},
+    {10662, 5, 4118, 3},
+    {10667, 5, 4121, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10672, 4, 4125, 3},
+    {10676, 7, 4128, 3},
+    {10683, 5, 4131, 4},
+    {0, 0, 0, 0},
+    {10688, 7, 4135, 2},
+    {10695, 14, 4137, 3},
+    {10709, 4, 4140, 3},
+    {10713, 10, 4143, 3},
+    {0, 0, 0, 0},
+    {10723, 5, 4146, 4},
+    {0, 0, 0, 0},
+    {10728, 7, 4150, 3},
+    {10735, 4, 4153, 3},
+    {0, 0, 0, 0},
+    {10739, 5, 4156, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10744, 6, 4159, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10750, 5, 4162, 4},
+    {0, 0, 0, 0},
+    {10755, 6, 4166, 2},
+    {0, 0, 0, 0},
+    {10761, 5, 4168, 3},
+    {0, 0, 0, 0},
+    {10766, 5, 4171, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10771, 6, 4175, 3},
+    {10777, 14, 4178, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10791, 4, 4181, 2},
+    {0, 0, 0, 0},
+    {10795, 4, 4183, 4},
+    {10799, 4, 4187, 2},
+    {10803, 15, 4189, 3},
+    {10818, 6, 4192, 2},
+    {10824, 6, 4194, 3},
+    {10830, 6, 4197, 3},
+    {10836, 10, 4200, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10846, 7, 4203, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10853, 11, 4206, 3},
+    {10864, 6, 4209, 3},
+    {10870, 4, 4212, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10874, 6, 4215, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10880, 5, 4217, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10885, 12, 4220, 5},
+    {0, 0, 0, 0},
+    {10897, 6, 4225, 2},
+    {10903, 4, 4227, 2},
+    {10907, 12, 4229, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10919, 17, 4232, 3},
+    {10936, 7, 4235, 2},
+    {10943, 5, 4237, 2},
+    {0, 0, 0, 0},
+    {10948, 10, 4239, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {10958, 6, 4242, 2},
+    {10964, 7, 4244, 3},
+    {0, 0, 0, 0},
+    {10971, 7, 4247, 2},
+    {10978, 4, 4249, 2},
+    {10982, 3, 4251, 3},
+    {10985, 6, 4254, 3},
+    {0, 0, 0, 0},
+    {10991, 5, 4257, 3},
+    {10996, 4, 4260, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11000, 6, 4263, 3},
+    {0, 0, 0, 0},
+    {11006, 7, 4266, 2},
+    {11013, 7, 4268, 3},
+    {0, 0, 0, 0},
+    {11020, 6, 4271, 3},
+    {0, 0, 0, 0},
+    {11026, 7, 4274, 3},
+    {11033, 13, 4277, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11046, 6, 4280, 3},
+    {11052, 14, 4283, 3},
+    {11066, 7, 4286, 1},
+    {11073, 10, 4287, 3},
+    {11083, 4, 4290, 3},
+    {11087, 6, 4293, 3},
+    {0, 0, 0, 0},
+    {11093, 11, 4296, 3},
+    {11104, 7, 4299, 2},
+    {11111, 5, 4301, 2},
+    {11116, 6, 4303, 3},
+    {0, 0, 0, 0},
+    {11122, 12, 4306, 3},
+    {0, 0, 0, 0},
+    {11134, 3, 4309, 3},
+    {0, 0, 0, 0},
+    {11137, 7, 4312, 3},
+    {11144, 4, 4315, 2},
+    {11148, 6, 4317, 3},
+    {11154, 11, 4320, 3},
+    {11165, 7, 4323, 2},
+    {11172, 4, 4325, 3},
+    {11176, 6, 4328, 3},
+    {11182, 19, 4331, 3},
+    {11201, 9, 4334, 3},
+    {11210, 7, 4337, 3},
+    {11217, 7, 4340, 3},
+    {0, 0, 0, 0},
+    {11224, 3, 4343, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11227, 3, 4346, 2},
+    {11230, 5, 4348, 4},
+    {11235, 6, 4352, 3},
+    {11241, 8, 4355, 3},
+    {11249, 4, 4358, 4},
+    {11253, 7, 4362, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11260, 6, 4365, 2},
+    {11266, 6, 4367, 3},
+    {11272, 7, 4370, 3},
+    {0, 0, 0, 0},
+    {11279, 16, 4373, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11295, 5, 4376, 2},
+    {11300, 6, 4378, 2},
+    {11306, 8, 4380, 3},
+    {11314, 6, 4383, 3},
+    {11320, 5, 4386, 3},
+    {11325, 8, 4389, 3},
+    {0, 0, 0, 0},
+    {11333, 7, 4392, 2},
+    {11340, 4, 4394, 4},
+    {11344, 6, 4398, 2},
+    {11350, 6, 4400, 3},
+    {11356, 6, 4403, 3},
+    {0, 0, 0, 0},
+    {11362, 4, 4406, 2},
+    {11366, 5, 4408, 2},
+    {0, 0, 0, 0},
+    {11371, 9, 4410, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11380, 4, 4411, 2},
+    {11384, 3, 4413, 3},
+    {11387, 7, 4416, 3},
+    {0, 0, 0, 0},
+    {11394, 6, 4419, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11400, 5, 4422, 2},
+    {11405, 9, 4424, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11414, 15, 4427, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11429, 4, 4430, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11433, 5, 4432, 2},
+    {11438, 5, 4434, 6},
+    {11443, 9, 4440, 3},
+    {11452, 6, 4443, 3},
+    {0, 0, 0, 0},
+    {11458, 6, 4446, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11464, 4, 4449, 4},
+    {0, 0, 0, 0},
+    {11468, 10, 4453, 3},
+    {11478, 6, 4456, 3},
+    {0, 0, 0, 0},
+    {11484, 4, 4459, 2},
+    {0, 0, 0, 0},
+    {11488, 4, 4461, 2},
+    {0, 0, 0, 0},
+    {11492, 13, 4463, 3},
+    {11505, 7, 4466, 3},
+    {11512, 7, 4469, 3},
+    {11519, 21, 4472, 3},
+    {11540, 7, 4475, 3},
+    {11547, 18, 4478, 5},
+    {11565, 7, 4483, 3},
+    {11572, 9, 4486, 3},
+    {11581, 14, 4489, 3},
+    {11595, 7, 4492, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11602, 3, 4494, 3},
+    {11605, 5, 4497, 2},
+    {11610, 10, 4499, 3},
+    {11620, 8, 4502, 3},
+    {11628, 5, 4505, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11633, 5, 4509, 4},
+    {11638, 6, 4513, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11644, 6, 4515, 3},
+    {11650, 10, 4518, 2},
+    {11660, 15, 4520, 3},
+    {11675, 6, 4523, 3},
+    {11681, 7, 4526, 3},
+    {0, 0, 0, 0},
+    {11688, 5, 4529, 3},
+    {11693, 6, 4532, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11699, 7, 4535, 2},
+    {11706, 6, 4537, 3},
+    {11712, 3, 4540, 2},
+    {11715, 10, 4542, 3},
+    {11725, 5, 4545, 2},
+    {11730, 6, 4547, 2},
+    {0, 0, 0, 0},
+    {11736, 8, 4549, 3},
+    {11744, 4, 4552, 4},
+    {0, 0, 0, 0},
+    {11748, 5, 4556, 4},
+    {0, 0, 0, 0},
+    {11753, 5, 4560, 1},
+    {11758, 6, 4561, 3},
+    {0, 0, 0, 0},
+    {11764, 6, 4564, 3},
+    {11770, 5, 4567, 2},
+    {11775, 6, 4569, 3},
+    {11781, 21, 4572, 3},
+    {11802, 6, 4575, 3},
+    {11808, 6, 4578, 2},
+    {0, 0, 0, 0},
+    {11814, 7, 4580, 3},
+    {11821, 9, 4583, 3},
+    {11830, 7, 4586, 2},
+    {11837, 6, 4588, 3},
+    {11843, 7, 4591, 6},
+    {11850, 5, 4597, 4},
+    {11855, 5, 4601, 6},
+    {11860, 7, 4607, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11867, 6, 4610, 2},
+    {0, 0, 0, 0},
+    {11873, 3, 4612, 3},
+    {11876, 7, 4615, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11883, 5, 4617, 4},
+    {0, 0, 0, 0},
+    {11888, 7, 4621, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11895, 6, 4623, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11901, 12, 4626, 3},
+    {0, 0, 0, 0},
+    {11913, 5, 4629, 2},
+    {0, 0, 0, 0},
+    {11918, 7, 4631, 3},
+    {11925, 19, 4634, 3},
+    {11944, 5, 4637, 3},
+    {11949, 10, 4640, 5},
+    {11959, 4, 4645, 3},
+    {11963, 4, 4648, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {11967, 8, 4651, 2},
+    {11975, 9, 4653, 3},
+    {11984, 7, 4656, 2},
+    {0, 0, 0, 0},
+    {11991, 7, 4658, 3},
+    {11998, 20, 4661, 3},
+    {0, 0, 0, 0},
+    {12018, 5, 4664, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12023, 8, 4668, 3},
+    {12031, 7, 4671, 3},
+    {0, 0, 0, 0},
+    {12038, 7, 4674, 3},
+    {12045, 6, 4677, 3},
+    {0, 0, 0, 0},
+    {12051, 7, 4680, 3},
+    {0, 0, 0, 0},
+    {12058, 7, 4683, 1},
+    {12065, 4, 4684, 3},
+    {0, 0, 0, 0},
+    {12069, 7, 4687, 3},
+    {12076, 6, 4690, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12082, 16, 4692, 3},
+    {12098, 4, 4695, 3},
+    {0, 0, 0, 0},
+    {12102, 6, 4698, 3},
+    {12108, 8, 4701, 3},
+    {0, 0, 0, 0},
+    {12116, 19, 4704, 3},
+    {12135, 6, 4707, 3},
+    {0, 0, 0, 0},
+    {12141, 5, 4710, 3},
+    {12146, 14, 4713, 3},
+    {0, 0, 0, 0},
+    {12160, 5, 4716, 6},
+    {12165, 4, 4722, 3},
+    {12169, 8, 4725, 3},
+    {0, 0, 0, 0},
+    {12177, 8, 4728, 3},
+    {12185, 8, 4731, 3},
+    {12193, 4, 4734, 3},
+    {12197, 6, 4737, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12203, 6, 4739, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12209, 7, 4742, 3},
+    {12216, 9, 4745, 3},
+    {0, 0, 0, 0},
+    {12225, 21, 4748, 3},
+    {12246, 7, 4751, 2},
+    {12253, 5, 4753, 1},
+    {0, 0, 0, 0},
+    {12258, 8, 4754, 3},
+    {12266, 3, 4757, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12269, 9, 4760, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12278, 7, 4763, 2},
+    {0, 0, 0, 0},
+    {12285, 3, 4765, 3},
+    {12288, 7, 4768, 3},
+    {0, 0, 0, 0},
+    {12295, 6, 4771, 3},
+    {12301, 5, 4774, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12306, 9, 4776, 3},
+    {12315, 13, 4779, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12328, 9, 4782, 3},
+    {12337, 8, 4785, 6},
+    {12345, 7, 4791, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12352, 5, 4792, 2},
+    {12357, 6, 4794, 3},
+    {0, 0, 0, 0},
+    {12363, 7, 4797, 2},
+    {12370, 19, 4799, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12389, 4, 4802, 3},
+    {12393, 7, 4805, 2},
+    {12400, 6, 4807, 3},
+    {12406, 5, 4810, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12411, 7, 4813, 2},
+    {12418, 6, 4815, 3},
+    {0, 0, 0, 0},
+    {12424, 7, 4818, 3},
+    {0, 0, 0, 0},
+    {12431, 5, 4821, 4},
+    {0, 0, 0, 0},
+    {12436, 8, 4825, 3},
+    {12444, 5, 4828, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12449, 5, 4831, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12454, 7, 4834, 3},
+    {12461, 7, 4837, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12468, 5, 4839, 3},
+    {12473, 6, 4842, 2},
+    {0, 0, 0, 0},
+    {12479, 6, 4844, 3},
+    {12485, 6, 4847, 3},
+    {0, 0, 0, 0},
+    {12491, 7, 4850, 3},
+    {12498, 11, 4853, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12509, 5, 4856, 4},
+    {12514, 5, 4860, 3},
+    {12519, 5, 4863, 3},
+    {12524, 22, 4866, 3},
+    {0, 0, 0, 0},
+    {12546, 6, 4869, 2},
+    {12552, 7, 4871, 3},
+    {12559, 4, 4874, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12563, 6, 4878, 3},
+    {12569, 9, 4881, 3},
+    {12578, 6, 4884, 3},
+    {12584, 18, 4887, 5},
+    {0, 0, 0, 0},
+    {12602, 5, 4892, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12607, 7, 4896, 3},
+    {0, 0, 0, 0},
+    {12614, 5, 4899, 2},
+    {12619, 8, 4901, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12627, 5, 4904, 2},
+    {12632, 15, 4906, 3},
+    {12647, 7, 4909, 3},
+    {0, 0, 0, 0},
+    {12654, 17, 4912, 3},
+    {12671, 5, 4915, 4},
+    {12676, 16, 4919, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12692, 8, 4922, 3},
+    {0, 0, 0, 0},
+    {12700, 6, 4925, 2},
+    {12706, 6, 4927, 3},
+    {12712, 6, 4930, 3},
+    {0, 0, 0, 0},
+    {12718, 4, 4933, 4},
+    {12722, 7, 4937, 6},
+    {12729, 4, 4943, 3},
+    {0, 0, 0, 0},
+    {12733, 6, 4946, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12739, 11, 4949, 3},
+    {12750, 5, 4952, 3},
+    {0, 0, 0, 0},
+    {12755, 5, 4955, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12760, 5, 4957, 3},
+    {12765, 14, 4960, 3},
+    {12779, 8, 4963, 3},
+    {0, 0, 0, 0},
+    {12787, 5, 4966, 3},
+    {12792, 10, 4969, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12802, 7, 4972, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12809, 6, 4974, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12815, 5, 4976, 5},
+    {12820, 7, 4981, 3},
+    {12827, 7, 4984, 3},
+    {0, 0, 0, 0},
+    {12834, 5, 4987, 3},
+    {12839, 6, 4990, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12845, 10, 4993, 3},
+    {12855, 4, 4996, 2},
+    {12859, 5, 4998, 2},
+    {0, 0, 0, 0},
+    {12864, 6, 5000, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12870, 5, 5003, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12875, 6, 5006, 5},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12881, 12, 5011, 3},
+    {0, 0, 0, 0},
+    {12893, 4, 5014, 5},
+    {0, 0, 0, 0},
+    {12897, 9, 5019, 3},
+    {12906, 8, 5022, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12914, 7, 5025, 2},
+    {0, 0, 0, 0},
+    {12921, 6, 5027, 2},
+    {12927, 5, 5029, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {12932, 6, 5032, 2},
+    {12938, 4, 5034, 2},
+    {12942, 10, 5036, 3},
+    {12952, 7, 5039, 3},
+    {0, 0, 0, 0},
+    {12959, 6, 5042, 2},
+    {12965, 6, 5044, 2},
+    {12971, 5, 5046, 3},
+    {0, 0, 0, 0},
+    {12976, 6, 5049, 2},
+    {0, 0, 0, 0},
+    {12982, 5, 5051, 2},
+    {0, 0, 0, 0},
+    {12987, 7, 5053, 3},
+    {12994, 6, 5056, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13000, 7, 5059, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13007, 5, 5062, 3},
+    {0, 0, 0, 0},
+    {13012, 6, 5065, 3},
+    {13018, 8, 5068, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13026, 9, 5071, 3},
+    {0, 0, 0, 0},
+    {13035, 7, 5074, 3},
+    {13042, 5, 5077, 3},
+    {0, 0, 0, 0},
+    {13047, 8, 5080, 2},
+    {0, 0, 0, 0},
+    {13055, 5, 5082, 3},
+    {13060, 17, 5085, 3},
+    {0, 0, 0, 0},
+    {13077, 6, 5088, 3},
+    {0, 0, 0, 0},
+    {13083, 4, 5091, 2},
+    {13087, 5, 5093, 4},
+    {0, 0, 0, 0},
+    {13092, 4, 5097, 3},
+    {0, 0, 0, 0},
+    {13096, 10, 5100, 3},
+    {0, 0, 0, 0},
+    {13106, 16, 5103, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13122, 7, 5106, 3},
+    {13129, 5, 5109, 2},
+    {0, 0, 0, 0},
+    {13134, 13, 5111, 3},
+    {0, 0, 0, 0},
+    {13147, 7, 5114, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13154, 6, 5117, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13160, 6, 5120, 2},
+    {0, 0, 0, 0},
+    {13166, 5, 5122, 3},
+    {13171, 16, 5125, 2},
+    {13187, 6, 5127, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13193, 6, 5130, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13199, 3, 5132, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13202, 4, 5133, 4},
+    {0, 0, 0, 0},
+    {13206, 4, 5137, 2},
+    {13210, 6, 5139, 3},
+    {0, 0, 0, 0},
+    {13216, 8, 5142, 6},
+    {0, 0, 0, 0},
+    {13224, 6, 5148, 1},
+    {13230, 5, 5149, 3},
+    {0, 0, 0, 0},
+    {13235, 6, 5152, 2},
+    {13241, 6, 5154, 6},
+    {13247, 4, 5160, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13251, 8, 5162, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13259, 4, 5164, 2},
+    {0, 0, 0, 0},
+    {13263, 7, 5166, 2},
+    {0, 0, 0, 0},
+    {13270, 7, 5168, 2},
+    {13277, 5, 5170, 3},
+    {13282, 5, 5173, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13287, 6, 5175, 3},
+    {13293, 14, 5178, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13307, 4, 5181, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13311, 5, 5184, 3},
+    {13316, 7, 5187, 3},
+    {0, 0, 0, 0},
+    {13323, 6, 5190, 3},
+    {0, 0, 0, 0},
+    {13329, 5, 5193, 3},
+    {13334, 7, 5196, 2},
+    {0, 0, 0, 0},
+    {13341, 18, 5198, 3},
+    {0, 0, 0, 0},
+    {13359, 3, 5201, 2},
+    {13362, 6, 5203, 3},
+    {13368, 5, 5206, 4},
+    {0, 0, 0, 0},
+    {13373, 4, 5210, 2},
+    {13377, 7, 5212, 3},
+    {13384, 5, 5215, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13389, 5, 5217, 3},
+    {13394, 7, 5220, 3},
+    {13401, 11, 5223, 3},
+    {0, 0, 0, 0},
+    {13412, 6, 5226, 3},
+    {13418, 6, 5229, 3},
+    {0, 0, 0, 0},
+    {13424, 4, 5232, 2},
+    {13428, 5, 5234, 2},
+    {0, 0, 0, 0},
+    {13433, 5, 5236, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13438, 7, 5240, 3},
+    {13445, 5, 5243, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13450, 6, 5246, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13456, 8, 5249, 3},
+    {13464, 7, 5252, 3},
+    {13471, 7, 5255, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13478, 4, 5258, 2},
+    {13482, 7, 5260, 3},
+    {13489, 6, 5263, 3},
+    {13495, 14, 5266, 3},
+    {13509, 4, 5269, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13513, 9, 5271, 3},
+    {0, 0, 0, 0},
+    {13522, 6, 5274, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13528, 3, 5276, 2},
+    {13531, 9, 5278, 3},
+    {0, 0, 0, 0},
+    {13540, 15, 5281, 3},
+    {13555, 6, 5284, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13561, 6, 5287, 3},
+    {13567, 6, 5290, 2},
+    {13573, 6, 5292, 3},
+    {13579, 7, 5295, 2},
+    {13586, 13, 5297, 3},
+    {13599, 7, 5300, 2},
+    {13606, 5, 5302, 3},
+    {0, 0, 0, 0},
+    {13611, 8, 5305, 2},
+    {13619, 5, 5307, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13624, 9, 5310, 3},
+    {13633, 7, 5313, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13640, 4, 5315, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13644, 7, 5317, 3},
+    {0, 0, 0, 0},
+    {13651, 7, 5320, 1},
+    {13658, 9, 5321, 3},
+    {13667, 12, 5324, 3},
+    {13679, 9, 5327, 2},
+    {0, 0, 0, 0},
+    {13688, 7, 5329, 3},
+    {13695, 7, 5332, 3},
+    {0, 0, 0, 0},
+    {13702, 6, 5335, 3},
+    {0, 0, 0, 0},
+    {13708, 6, 5338, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13714, 10, 5341, 6},
+    {13724, 7, 5347, 2},
+    {13731, 12, 5349, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13743, 8, 5352, 3},
+    {0, 0, 0, 0},
+    {13751, 10, 5355, 3},
+    {0, 0, 0, 0},
+    {13761, 19, 5358, 3},
+    {0, 0, 0, 0},
+    {13780, 6, 5361, 3},
+    {13786, 7, 5364, 3},
+    {13793, 18, 5367, 3},
+    {0, 0, 0, 0},
+    {13811, 4, 5370, 4},
+    {13815, 6, 5374, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13821, 25, 5377, 3},
+    {13846, 6, 5380, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13852, 7, 5383, 1},
+    {0, 0, 0, 0},
+    {13859, 13, 5384, 3},
+    {13872, 4, 5387, 3},
+    {0, 0, 0, 0},
+    {13876, 7, 5390, 3},
+    {13883, 8, 5393, 3},
+    {0, 0, 0, 0},
+    {13891, 6, 5396, 3},
+    {13897, 7, 5399, 3},
+    {0, 0, 0, 0},
+    {13904, 19, 5402, 3},
+    {13923, 5, 5405, 4},
+    {13928, 6, 5409, 3},
+    {13934, 4, 5412, 3},
+    {13938, 6, 5415, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13944, 5, 5417, 4},
+    {13949, 8, 5421, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13957, 4, 5424, 2},
+    {0, 0, 0, 0},
+    {13961, 5, 5426, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {13966, 5, 5429, 2},
+    {0, 0, 0, 0},
+    {13971, 6, 5431, 3},
+    {13977, 6, 5434, 3},
+    {13983, 5, 5437, 3},
+    {13988, 6, 5440, 3},
+    {13994, 5, 5443, 4},
+    {13999, 6, 5447, 3},
+    {14005, 4, 5450, 1},
+    {14009, 4, 5451, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14013, 18, 5454, 3},
+    {0, 0, 0, 0},
+    {14031, 5, 5457, 2},
+    {14036, 21, 5459, 3},
+    {0, 0, 0, 0},
+    {14057, 12, 5462, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14069, 8, 5465, 3},
+    {14077, 8, 5468, 3},
+    {14085, 7, 5471, 2},
+    {14092, 13, 5473, 3},
+    {14105, 5, 5476, 2},
+    {0, 0, 0, 0},
+    {14110, 4, 5478, 2},
+    {0, 0, 0, 0},
+    {14114, 6, 5480, 2},
+    {0, 0, 0, 0},
+    {14120, 7, 5482, 2},
+    {14127, 7, 5484, 3},
+    {14134, 5, 5487, 4},
+    {14139, 7, 5491, 3},
+    {14146, 10, 5494, 2},
+    {14156, 4, 5496, 2},
+    {14160, 6, 5498, 2},
+    {14166, 6, 5500, 3},
+    {14172, 5, 5503, 5},
+    {14177, 6, 5508, 2},
+    {14183, 9, 5510, 3},
+    {14192, 7, 5513, 3},
+    {14199, 6, 5516, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14205, 5, 5519, 4},
+    {0, 0, 0, 0},
+    {14210, 6, 5523, 3},
+    {14216, 23, 5526, 2},
+    {14239, 3, 5528, 3},
+    {14242, 6, 5531, 3},
+    {14248, 5, 5534, 3},
+    {0, 0, 0, 0},
+    {14253, 5, 5537, 3},
+    {14258, 6, 5540, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14264, 7, 5542, 2},
+    {0, 0, 0, 0},
+    {14271, 11, 5544, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14282, 10, 5547, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14292, 8, 5550, 2},
+    {14300, 8, 5552, 3},
+    {14308, 18, 5555, 3},
+    {14326, 6, 5558, 3},
+    {14332, 5, 5561, 3},
+    {14337, 7, 5564, 3},
+    {14344, 8, 5567, 3},
+    {0, 0, 0, 0},
+    {14352, 8, 5570, 3},
+    {14360, 14, 5573, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14374, 6, 5576, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14380, 6, 5579, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14386, 7, 5580, 3},
+    {14393, 7, 5583, 3},
+    {14400, 5, 5586, 4},
+    {0, 0, 0, 0},
+    {14405, 8, 5590, 3},
+    {0, 0, 0, 0},
+    {14413, 17, 5593, 3},
+    {0, 0, 0, 0},
+    {14430, 5, 5596, 2},
+    {0, 0, 0, 0},
+    {14435, 12, 5598, 3},
+    {14447, 7, 5601, 3},
+    {14454, 7, 5604, 3},
+    {14461, 7, 5607, 3},
+    {14468, 8, 5610, 3},
+    {0, 0, 0, 0},
+    {14476, 18, 5613, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14494, 14, 5616, 3},
+    {14508, 6, 5619, 2},
+    {14514, 5, 5621, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14519, 6, 5624, 2},
+    {14525, 4, 5626, 4},
+    {0, 0, 0, 0},
+    {14529, 19, 5630, 3},
+    {14548, 5, 5633, 4},
+    {0, 0, 0, 0},
+    {14553, 5, 5637, 4},
+    {14558, 5, 5641, 3},
+    {14563, 5, 5644, 4},
+    {14568, 6, 5648, 3},
+    {14574, 6, 5651, 3},
+    {14580, 6, 5654, 3},
+    {14586, 6, 5657, 3},
+    {14592, 7, 5660, 3},
+    {14599, 6, 5663, 3},
+    {14605, 7, 5666, 2},
+    {14612, 6, 5668, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14618, 5, 5670, 3},
+    {0, 0, 0, 0},
+    {14623, 10, 5673, 5},
+    {14633, 7, 5678, 2},
+    {14640, 6, 5680, 2},
+    {0, 0, 0, 0},
+    {14646, 7, 5682, 3},
+    {14653, 5, 5685, 3},
+    {14658, 4, 5688, 3},
+    {14662, 9, 5691, 3},
+    {0, 0, 0, 0},
+    {14671, 6, 5694, 2},
+    {0, 0, 0, 0},
+    {14677, 6, 5696, 3},
+    {14683, 5, 5699, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14688, 7, 5701, 2},
+    {14695, 9, 5703, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14704, 5, 5706, 2},
+    {0, 0, 0, 0},
+    {14709, 6, 5708, 3},
+    {14715, 9, 5711, 3},
+    {14724, 6, 5714, 2},
+    {14730, 9, 5716, 2},
+    {14739, 5, 5718, 3},
+    {0, 0, 0, 0},
+    {14744, 14, 5721, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14758, 9, 5724, 3},
+    {14767, 3, 5727, 3},
+    {0, 0, 0, 0},
+    {14770, 9, 5730, 3},
+    {0, 0, 0, 0},
+    {14779, 7, 5733, 6},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14786, 6, 5739, 3},
+    {14792, 7, 5742, 3},
+    {0, 0, 0, 0},
+    {14799, 6, 5745, 1},
+    {0, 0, 0, 0},
+    {14805, 5, 5746, 3},
+    {14810, 6, 5749, 2},
+    {0, 0, 0, 0},
+    {14816, 7, 5751, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14823, 6, 5754, 3},
+    {14829, 7, 5757, 2},
+    {0, 0, 0, 0},
+    {14836, 6, 5759, 3},
+    {14842, 5, 5762, 3},
+    {14847, 5, 5765, 6},
+    {14852, 5, 5771, 4},
+    {0, 0, 0, 0},
+    {14857, 5, 5775, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14862, 10, 5778, 3},
+    {0, 0, 0, 0},
+    {14872, 3, 5781, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14875, 11, 5784, 5},
+    {14886, 7, 5789, 1},
+    {0, 0, 0, 0},
+    {14893, 4, 5790, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {14897, 5, 5794, 2},
+    {14902, 5, 5796, 2},
+    {14907, 5, 5798, 4},
+    {0, 0, 0, 0},
+    {14912, 8, 5802, 3},
+    {0, 0, 0, 0},
+    {14920, 7, 5805, 3},
+    {14927, 7, 5808, 3},
+    {14934, 3, 5811, 3},
+    {14937, 7, 5814, 3},
+    {0, 0, 0, 0},
+    {14944, 5, 5817, 3},
+    {14949, 4, 5820, 4},
+    {0, 0, 0, 0},
+    {14953, 8, 5824, 3},
+    {14961, 20, 5827, 3},
+    {14981, 7, 5830, 3},
+    {0, 0, 0, 0},
+    {14988, 12, 5833, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15000, 5, 5836, 3},
+    {15005, 7, 5839, 2},
+    {0, 0, 0, 0},
+    {15012, 7, 5841, 3},
+    {15019, 7, 5844, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15026, 6, 5846, 3},
+    {15032, 16, 5849, 3},
+    {15048, 7, 5852, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15055, 5, 5855, 2},
+    {15060, 14, 5857, 3},
+    {0, 0, 0, 0},
+    {15074, 8, 5860, 3},
+    {15082, 7, 5863, 3},
+    {15089, 8, 5866, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15097, 10, 5869, 3},
+    {15107, 10, 5872, 3},
+    {0, 0, 0, 0},
+    {15117, 14, 5875, 3},
+    {15131, 18, 5878, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15149, 7, 5881, 3},
+    {0, 0, 0, 0},
+    {15156, 16, 5884, 3},
+    {15172, 7, 5887, 2},
+    {15179, 6, 5889, 3},
+    {0, 0, 0, 0},
+    {15185, 6, 5892, 3},
+    {15191, 4, 5895, 4},
+    {15195, 2, 5899, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15197, 5, 5900, 1},
+    {15202, 7, 5901, 3},
+    {15209, 6, 5904, 3},
+    {15215, 4, 5907, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15219, 6, 5909, 2},
+    {15225, 5, 5911, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15230, 4, 5914, 3},
+    {15234, 6, 5917, 3},
+    {15240, 7, 5920, 2},
+    {15247, 7, 5922, 3},
+    {0, 0, 0, 0},
+    {15254, 6, 5925, 3},
+    {15260, 3, 5928, 3},
+    {0, 0, 0, 0},
+    {15263, 15, 5931, 3},
+    {0, 0, 0, 0},
+    {15278, 5, 5934, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15283, 6, 5937, 3},
+    {15289, 19, 5940, 3},
+    {15308, 6, 5943, 2},
+    {15314, 12, 5945, 3},
+    {0, 0, 0, 0},
+    {15326, 11, 5948, 3},
+    {15337, 11, 5951, 3},
+    {0, 0, 0, 0},
+    {15348, 5, 5954, 3},
+    {15353, 8, 5957, 3},
+    {15361, 18, 5960, 3},
+    {15379, 5, 5963, 3},
+    {15384, 7, 5966, 2},
+    {15391, 12, 5968, 3},
+    {15403, 9, 5971, 3},
+    {15412, 4, 5974, 4},
+    {15416, 4, 5978, 3},
+    {15420, 5, 5981, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15425, 12, 5985, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15437, 9, 5988, 3},
+    {15446, 7, 5991, 3},
+    {15453, 6, 5994, 3},
+    {15459, 6, 5997, 3},
+    {0, 0, 0, 0},
+    {15465, 7, 6000, 2},
+    {15472, 16, 6002, 3},
+    {0, 0, 0, 0},
+    {15488, 5, 6005, 3},
+    {15493, 13, 6008, 3},
+    {0, 0, 0, 0},
+    {15506, 6, 6011, 3},
+    {15512, 6, 6014, 2},
+    {0, 0, 0, 0},
+    {15518, 7, 6016, 6},
+    {15525, 8, 6022, 3},
+    {0, 0, 0, 0},
+    {15533, 8, 6025, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15541, 11, 6028, 6},
+    {15552, 7, 6034, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15559, 6, 6037, 2},
+    {15565, 9, 6039, 3},
+    {15574, 8, 6042, 3},
+    {0, 0, 0, 0},
+    {15582, 4, 6045, 3},
+    {0, 0, 0, 0},
+    {15586, 19, 6048, 3},
+    {15605, 11, 6051, 3},
+    {0, 0, 0, 0},
+    {15616, 6, 6054, 3},
+    {15622, 5, 6057, 2},
+    {0, 0, 0, 0},
+    {15627, 5, 6059, 4},
+    {15632, 7, 6063, 3},
+    {0, 0, 0, 0},
+    {15639, 6, 6066, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15645, 7, 6068, 3},
+    {15652, 9, 6071, 3},
+    {15661, 9, 6074, 3},
+    {15670, 7, 6077, 3},
+    {0, 0, 0, 0},
+    {15677, 5, 6080, 3},
+    {0, 0, 0, 0},
+    {15682, 9, 6083, 2},
+    {0, 0, 0, 0},
+    {15691, 7, 6085, 2},
+    {15698, 6, 6087, 3},
+    {0, 0, 0, 0},
+    {15704, 8, 6090, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15712, 3, 6093, 2},
+    {15715, 12, 6095, 2},
+    {15727, 9, 6097, 3},
+    {0, 0, 0, 0},
+    {15736, 6, 6100, 3},
+    {15742, 6, 6103, 2},
+    {0, 0, 0, 0},
+    {15748, 9, 6105, 3},
+    {15757, 7, 6108, 3},
+    {15764, 16, 6111, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15780, 6, 6114, 3},
+    {15786, 5, 6117, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15791, 11, 6120, 3},
+    {0, 0, 0, 0},
+    {15802, 3, 6123, 2},
+    {0, 0, 0, 0},
+    {15805, 5, 6125, 3},
+    {15810, 6, 6128, 3},
+    {0, 0, 0, 0},
+    {15816, 6, 6131, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15822, 8, 6134, 6},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15830, 14, 6140, 3},
+    {15844, 7, 6143, 2},
+    {0, 0, 0, 0},
+    {15851, 14, 6145, 3},
+    {0, 0, 0, 0},
+    {15865, 3, 6148, 2},
+    {15868, 8, 6150, 3},
+    {15876, 9, 6153, 3},
+    {15885, 3, 6156, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15888, 5, 6158, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15893, 5, 6161, 4},
+    {0, 0, 0, 0},
+    {15898, 6, 6165, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15904, 9, 6168, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15913, 14, 6171, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15927, 6, 6174, 2},
+    {0, 0, 0, 0},
+    {15933, 6, 6176, 2},
+    {15939, 6, 6178, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15945, 5, 6181, 1},
+    {0, 0, 0, 0},
+    {15950, 4, 6182, 2},
+    {15954, 6, 6184, 3},
+    {15960, 6, 6187, 3},
+    {15966, 4, 6190, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {15970, 6, 6194, 3},
+    {0, 0, 0, 0},
+    {15976, 6, 6197, 3},
+    {15982, 3, 6200, 2},
+    {15985, 12, 6202, 3},
+    {15997, 5, 6205, 3},
+    {16002, 13, 6208, 3},
+    {0, 0, 0, 0},
+    {16015, 16, 6211, 3},
+    {16031, 6, 6214, 3},
+    {16037, 6, 6217, 2},
+    {16043, 4, 6219, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16047, 7, 6223, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16054, 21, 6226, 3},
+    {0, 0, 0, 0},
+    {16075, 4, 6229, 2},
+    {16079, 6, 6231, 3},
+    {16085, 8, 6234, 3},
+    {16093, 4, 6237, 2},
+    {16097, 4, 6239, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16101, 11, 6241, 3},
+    {16112, 16, 6244, 3},
+    {0, 0, 0, 0},
+    {16128, 7, 6247, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16135, 5, 6250, 3},
+    {16140, 5, 6253, 3},
+    {16145, 6, 6256, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16151, 8, 6259, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16159, 4, 6262, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16163, 4, 6264, 2},
+    {16167, 3, 6266, 3},
+    {16170, 9, 6269, 3},
+    {16179, 4, 6272, 3},
+    {16183, 6, 6275, 2},
+    {16189, 8, 6277, 3},
+    {16197, 5, 6280, 3},
+    {0, 0, 0, 0},
+    {16202, 5, 6283, 2},
+    {16207, 5, 6285, 3},
+    {16212, 20, 6288, 3},
+    {16232, 15, 6291, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16247, 20, 6294, 3},
+    {0, 0, 0, 0},
+    {16267, 6, 6297, 2},
+    {16273, 15, 6299, 3},
+    {16288, 10, 6302, 3},
+    {16298, 6, 6305, 3},
+    {0, 0, 0, 0},
+    {16304, 6, 6308, 3},
+    {16310, 3, 6311, 3},
+    {0, 0, 0, 0},
+    {16313, 6, 6314, 2},
+    {16319, 7, 6316, 3},
+    {16326, 10, 6319, 3},
+    {16336, 7, 6322, 3},
+    {0, 0, 0, 0},
+    {16343, 7, 6325, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16350, 5, 6328, 3},
+    {0, 0, 0, 0},
+    {16355, 4, 6331, 2},
+    {0, 0, 0, 0},
+    {16359, 6, 6333, 2},
+    {16365, 15, 6335, 3},
+    {16380, 8, 6338, 3},
+    {0, 0, 0, 0},
+    {16388, 17, 6341, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16405, 6, 6344, 3},
+    {16411, 7, 6347, 3},
+    {16418, 4, 6350, 1},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16422, 6, 6351, 3},
+    {16428, 6, 6354, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16434, 5, 6356, 2},
+    {16439, 7, 6358, 2},
+    {16446, 5, 6360, 2},
+    {16451, 16, 6362, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16467, 9, 6365, 3},
+    {0, 0, 0, 0},
+    {16476, 14, 6368, 3},
+    {16490, 7, 6371, 3},
+    {16497, 5, 6374, 3},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16502, 9, 6377, 3},
+    {0, 0, 0, 0},
+    {16511, 4, 6380, 2},
+    {0, 0, 0, 0},
+    {16515, 2, 6382, 1},
+    {16517, 5, 6383, 4},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16522, 8, 6387, 3},
+    {0, 0, 0, 0},
+    {16530, 6, 6390, 2},
+    {0, 0, 0, 0},
+    {16536, 6, 6392, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16542, 12, 6394, 3},
+    {16554, 14, 6397, 3},
+    {16568, 6, 6400, 3},
+    {16574, 7, 6403, 2},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0},
+    {16581, 14, 6405, 3},
+    {16595, 13, 6408, 3},
+    {0, 0, 0, 0},
+    {16608, 7, 6411, 3},
+    {16615, 5, 6414, 2},
+    {16620, 17, 6416, 1},
+    {0, 0, 0, 0},
+    {16637, 4, 6417, 3}
+};
+
+static uint32_t entity_hash(const char *name, size_t len, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)name[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+const char* entity_lookup(const char *name, size_t len, size_t *value_len) {
+    if (len == 0 || len > ENTITY_MAX_NAME) return NULL;
+    uint32_t seed = entity_disp[entity_hash(name, len, 0) % ENTITY_BUCKETS];
+    if (seed == 0) return NULL;
+    const entity_entry *e = &entity_table[entity_hash(name, len, seed) % ENTITY_SLOTS];
+    if (e->name_len != len || memcmp(entity_names + e->name_off, name, len) != 0) return NULL;
+    *value_len = e->value_len;
+    return entity_values + e->value_off;
+}
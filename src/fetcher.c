@@ -2,118 +2,485 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <pthread.h>
 #include <sys/socket.h>
-#include <netdb.h>
+#include <netinet/in.h>
 #include <openssl/ssl.h>
 #include <openssl/err.h>
 #include "fetcher.h"
+#include "archive.h"
+#include "dns.h"
+#include "preload.h"
+#include "trace.h"
 
-#define BUFFER_SIZE 4096
+#define BUFFER_SIZE 16384
+#define POOL_SIZE 8
+#define DRAIN_LIMIT (16 * 1024)
+#define MAX_REDIRECTS 5
+#define ATTEMPT_DELAY_MS 250
+#define CONNECT_TIMEOUT_MS 10000
 
-char* fetch_html(const char *hostname, const char *port, const char *path, size_t *out_size) {
-    char request[1024];
+typedef struct {
+    int sockfd;
+    SSL *ssl;
+    int tls;
+    char host[URL_HOST_MAX];
+    char port[8];
+} connection;
 
-    snprintf(request, sizeof(request),
-             "GET %s HTTP/1.0\r\n"
-             "Host: %s\r\n"
-             "User-Agent: Mozilla/5.0 (X11; Linux x86_64) C-Browser/1.0\r\n"
-             "Accept: text/html, image/png, image/jpeg, */*\r\n"
-             "Connection: close\r\n\r\n", path, hostname);
+static SSL_CTX *ssl_ctx = NULL;
+static pthread_once_t ssl_once = PTHREAD_ONCE_INIT;
 
-    int sockfd;
-    struct addrinfo hints, *res;
+static connection pool[POOL_SIZE];
+static int pool_count = 0;
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
 
-    memset(&hints, 0, sizeof(hints));
-    hints.ai_family = AF_INET;
-    hints.ai_socktype = SOCK_STREAM;
+static void init_ssl() {
+    SSL_library_init();
+    OpenSSL_add_all_algorithms();
+    SSL_load_error_strings();
+    ssl_ctx = SSL_CTX_new(TLS_client_method());
+}
 
-    if (getaddrinfo(hostname, port, &hints, &res) != 0) {
-        return NULL;
+static void close_connection(connection *conn) {
+    if (conn->ssl) {
+        SSL_free(conn->ssl);
+        conn->ssl = NULL;
     }
+    if (conn->sockfd >= 0) close(conn->sockfd);
+    conn->sockfd = -1;
+}
 
-    sockfd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
-    if (sockfd == -1) {
-        freeaddrinfo(res);
-        return NULL;
+static int connection_alive(connection *conn) {
+    char probe;
+    ssize_t n = recv(conn->sockfd, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (n == 0) return 0;
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) return 0;
+    if (n > 0 && !conn->ssl) return 0;
+    return 1;
+}
+
+static int pool_take(int tls, const char *hostname, const char *port, connection *conn) {
+    int found = 0;
+    pthread_mutex_lock(&pool_lock);
+    for (int i = pool_count - 1; i >= 0 && !found; i--) {
+        if (pool[i].tls != tls || strcmp(pool[i].host, hostname) != 0 || strcmp(pool[i].port, port) != 0) continue;
+        *conn = pool[i];
+        pool[i] = pool[--pool_count];
+        if (connection_alive(conn)) found = 1;
+        else close_connection(conn);
     }
+    pthread_mutex_unlock(&pool_lock);
+    return found;
+}
 
-    if (connect(sockfd, res->ai_addr, res->ai_addrlen) == -1) {
-        close(sockfd);
-        freeaddrinfo(res);
-        return NULL;
+static void pool_put(connection *conn) {
+    pthread_mutex_lock(&pool_lock);
+    if (pool_count == POOL_SIZE) {
+        close_connection(&pool[0]);
+        memmove(pool, pool + 1, sizeof(connection) * (POOL_SIZE - 1));
+        pool_count--;
     }
-    freeaddrinfo(res);
+    pool[pool_count++] = *conn;
+    pthread_mutex_unlock(&pool_lock);
+    conn->sockfd = -1;
+    conn->ssl = NULL;
+}
+
+void http_close_idle() {
+    pthread_mutex_lock(&pool_lock);
+    for (int i = 0; i < pool_count; i++) close_connection(&pool[i]);
+    pool_count = 0;
+    pthread_mutex_unlock(&pool_lock);
+}
+
+static double elapsed_ms(const struct timespec *since) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - since->tv_sec) * 1000.0 + (now.tv_nsec - since->tv_nsec) / 1e6;
+}
 
-    int is_https = (strcmp(port, "443") == 0);
-    SSL_CTX *ctx = NULL;
-    SSL *ssl = NULL;
+static int start_attempt(const struct sockaddr_storage *addr, socklen_t len, int port) {
+    struct sockaddr_storage target = *addr;
+    if (target.ss_family == AF_INET6) ((struct sockaddr_in6*)&target)->sin6_port = htons(port);
+    else ((struct sockaddr_in*)&target)->sin_port = htons(port);
 
-    if (is_https) {
-        SSL_library_init();
-        OpenSSL_add_all_algorithms();
-        SSL_load_error_strings();
+    int fd = socket(target.ss_family, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (fd == -1) return -1;
+    if (connect(fd, (struct sockaddr*)&target, len) == 0 || errno == EINPROGRESS) return fd;
+    close(fd);
+    return -1;
+}
 
-        ctx = SSL_CTX_new(TLS_client_method());
-        if (!ctx) { close(sockfd); return NULL; }
+static int connect_racing(const dns_result *addrs, int port) {
+    struct pollfd pending[DNS_MAX_ADDRS];
+    int pending_count = 0;
+    int next = 0;
+    int winner = -1;
+    struct timespec started, last_attempt;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    last_attempt = started;
 
-        ssl = SSL_new(ctx);
-        SSL_set_fd(ssl, sockfd);
-        SSL_set_tlsext_host_name(ssl, hostname);
+    while (winner == -1) {
+        if (next < addrs->count && (pending_count == 0 || elapsed_ms(&last_attempt) >= ATTEMPT_DELAY_MS)) {
+            int fd = start_attempt(&addrs->addrs[next], addrs->lens[next], port);
+            next++;
+            clock_gettime(CLOCK_MONOTONIC, &last_attempt);
+            if (fd != -1) {
+                pending[pending_count].fd = fd;
+                pending[pending_count].events = POLLOUT;
+                pending_count++;
+            }
+            continue;
+        }
+        if (pending_count == 0) break;
 
-        if (SSL_connect(ssl) <= 0) {
-            SSL_free(ssl);
-            SSL_CTX_free(ctx);
-            close(sockfd);
-            return NULL;
+        double budget = CONNECT_TIMEOUT_MS - elapsed_ms(&started);
+        if (budget <= 0) break;
+        double wait = budget;
+        if (next < addrs->count) {
+            double until_next = ATTEMPT_DELAY_MS - elapsed_ms(&last_attempt);
+            if (until_next < wait) wait = until_next;
         }
-    }
+        if (wait < 0) wait = 0;
+        if (poll(pending, pending_count, (int)wait) < 0 && errno != EINTR) break;
 
-    if (is_https) {
-        if (SSL_write(ssl, request, strlen(request)) <= 0) {
-            SSL_free(ssl); SSL_CTX_free(ctx); close(sockfd); return NULL;
+        for (int i = 0; i < pending_count; i++) {
+            if (!pending[i].revents) continue;
+            int err = 0;
+            socklen_t err_len = sizeof(err);
+            getsockopt(pending[i].fd, SOL_SOCKET, SO_ERROR, &err, &err_len);
+            if (err == 0 && winner == -1) {
+                winner = pending[i].fd;
+            } else {
+                close(pending[i].fd);
+            }
+            pending[i--] = pending[--pending_count];
         }
-    } else {
-        if (send(sockfd, request, strlen(request), 0) == -1) {
-            close(sockfd); return NULL;
+    }
+
+    for (int i = 0; i < pending_count; i++) close(pending[i].fd);
+    if (winner != -1) fcntl(winner, F_SETFL, fcntl(winner, F_GETFL) & ~O_NONBLOCK);
+    return winner;
+}
+
+static int open_connection(int tls, const char *hostname, const char *port, connection *conn) {
+    conn->sockfd = -1;
+    conn->ssl = NULL;
+    conn->tls = tls;
+    strncpy(conn->host, hostname, sizeof(conn->host) - 1);
+    conn->host[sizeof(conn->host) - 1] = '\0';
+    strncpy(conn->port, port, sizeof(conn->port) - 1);
+    conn->port[sizeof(conn->port) - 1] = '\0';
+
+    dns_result addrs;
+    TRACE_BEGIN("fetch.dns");
+    int resolved = dns_resolve(hostname, &addrs);
+    TRACE_END("fetch.dns");
+    if (resolved != 0) {
+        return -1;
+    }
+
+    TRACE_BEGIN("fetch.connect");
+    conn->sockfd = connect_racing(&addrs, atoi(port));
+    TRACE_END("fetch.connect");
+    if (conn->sockfd == -1) {
+        return -1;
+    }
+
+    if (tls) {
+        pthread_once(&ssl_once, init_ssl);
+        if (!ssl_ctx) { close_connection(conn); return -1; }
+
+        conn->ssl = SSL_new(ssl_ctx);
+        SSL_set_fd(conn->ssl, conn->sockfd);
+        SSL_set_tlsext_host_name(conn->ssl, hostname);
+
+        TRACE_BEGIN("fetch.tls");
+        int handshake = SSL_connect(conn->ssl);
+        TRACE_END("fetch.tls");
+        if (handshake <= 0) {
+            close_connection(conn);
+            return -1;
         }
     }
+    return 0;
+}
+
+static ssize_t conn_write(connection *conn, const char *data, size_t len) {
+    if (conn->ssl) return SSL_write(conn->ssl, data, (int)len);
+    return send(conn->sockfd, data, len, MSG_NOSIGNAL);
+}
+
+static ssize_t conn_read(connection *conn, char *buffer, size_t len) {
+    if (conn->ssl) return SSL_read(conn->ssl, buffer, (int)len);
+    return recv(conn->sockfd, buffer, len, 0);
+}
+
+static int drain_body(connection *conn, const http_response *resp, const char *leftover, size_t leftover_len) {
+    if (!resp->keep_alive) return -1;
+    if (resp->has_body && !resp->chunked && resp->content_length < 0) return -1;
+    if (resp->has_body && resp->content_length > DRAIN_LIMIT) return -1;
+
+    http_response skip = *resp;
+    skip.encoding = HTTP_ENCODING_IDENTITY;
+    http_decoder *dec = http_decoder_new(&skip, NULL);
+    int rc = http_decoder_feed(dec, leftover, leftover_len);
+    size_t drained = leftover_len;
 
-    size_t total_size = 0;
-    size_t capacity = 8192;
-    char *response = malloc(capacity);
     char buffer[BUFFER_SIZE];
-    ssize_t bytes_received;
+    while (rc >= 0 && !http_decoder_done(dec) && drained <= DRAIN_LIMIT) {
+        ssize_t n = conn_read(conn, buffer, BUFFER_SIZE);
+        if (n <= 0) { rc = -1; break; }
+        drained += n;
+        rc = http_decoder_feed(dec, buffer, n);
+    }
+    int done = rc >= 0 && http_decoder_done(dec);
+    http_decoder_free(dec);
+    return done ? 0 : -1;
+}
+
+static void format_host_header(int tls, const char *hostname, const char *port, char *buf, size_t size) {
+    int v6 = strchr(hostname, ':') != NULL;
+    if (strcmp(port, tls ? "443" : "80") == 0) {
+        snprintf(buf, size, v6 ? "[%s]" : "%s", hostname);
+    } else {
+        snprintf(buf, size, v6 ? "[%s]:%s" : "%s:%s", hostname, port);
+    }
+}
 
-    while (1) {
-        if (is_https) {
-            bytes_received = SSL_read(ssl, buffer, BUFFER_SIZE);
-        } else {
-            bytes_received = recv(sockfd, buffer, BUFFER_SIZE, 0);
+int http_fetch(const char *scheme, const char *hostname, const char *port, const char *path, http_response *resp, const http_sink *sink) {
+    TRACE_SCOPE("fetch");
+    memset(resp, 0, sizeof(*resp));
+    int tls = strcmp(scheme, "https") == 0;
+    char host_header[URL_HOST_MAX + 16];
+    format_host_header(tls, hostname, port, host_header, sizeof(host_header));
+
+    size_t request_cap = strlen(path) + strlen(host_header) + 512;
+    char *request = malloc(request_cap);
+    int request_len = snprintf(request, request_cap,
+             "GET %s HTTP/1.1\r\n"
+             "Host: %s\r\n"
+             "User-Agent: Mozilla/5.0 (X11; Linux x86_64) C-Browser/1.0\r\n"
+             "Accept: text/html, image/png, image/jpeg, */*\r\n"
+             "Accept-Encoding: gzip, deflate\r\n"
+             "Connection: keep-alive\r\n\r\n", path, host_header);
+
+    connection conn;
+    char *head = malloc(HTTP_MAX_HEAD);
+    size_t head_fill = 0;
+    long head_end = -1;
+
+    for (int attempt = 0; attempt < 2 && head_end < 0; attempt++) {
+        int reused = attempt == 0 && pool_take(tls, hostname, port, &conn);
+        if (!reused && open_connection(tls, hostname, port, &conn) != 0) break;
+
+        TRACE_BEGIN("fetch.ttfb");
+        head_fill = 0;
+        if (conn_write(&conn, request, request_len) > 0) {
+            while (head_end < 0 && head_fill < HTTP_MAX_HEAD) {
+                ssize_t n = conn_read(&conn, head + head_fill, HTTP_MAX_HEAD - head_fill);
+                if (n <= 0) break;
+                head_fill += n;
+                head_end = http_find_head_end(head, head_fill);
+            }
         }
+        TRACE_END("fetch.ttfb");
+
+        if (head_end < 0) {
+            close_connection(&conn);
+            if (!reused) break;
+        }
+    }
+    free(request);
+
+    if (head_end < 0 || http_parse_head(head, head_end, resp) != 0) {
+        if (head_end >= 0) close_connection(&conn);
+        free(head);
+        return -1;
+    }
+
+    int skip = sink && sink->on_headers ? sink->on_headers(resp, sink->user) : 0;
+    if (skip < 0) {
+        close_connection(&conn);
+        free(head);
+        return -1;
+    }
+    if (skip) {
+        if (drain_body(&conn, resp, head + head_end, head_fill - head_end) == 0) pool_put(&conn);
+        else close_connection(&conn);
+        free(head);
+        return 0;
+    }
+
+    TRACE_BEGIN("fetch.body");
+    int rc = 0;
+    http_decoder *dec = http_decoder_new(resp, sink);
+    if (http_decoder_feed(dec, head + head_end, head_fill - head_end) < 0) rc = -1;
+    free(head);
 
+    char buffer[BUFFER_SIZE];
+    ssize_t bytes_received = 0;
+    while (rc == 0 && !http_decoder_done(dec)) {
+        bytes_received = conn_read(&conn, buffer, BUFFER_SIZE);
         if (bytes_received <= 0) break;
+        if (http_decoder_feed(dec, buffer, bytes_received) < 0) rc = -1;
+    }
+    TRACE_END("fetch.body");
+
+    if (rc == 0 && bytes_received < 0 && !http_decoder_done(dec)) rc = -1;
+    if (rc == 0 && http_decoder_finish(dec) != 0) rc = -1;
+
+    if (rc == 0 && resp->keep_alive && http_decoder_done(dec) && bytes_received >= 0 && (resp->chunked || resp->content_length >= 0 || !resp->has_body)) pool_put(&conn);
+    else close_connection(&conn);
+
+    http_decoder_free(dec);
+    return rc;
+}
+
+typedef struct {
+    const http_sink *inner;
+    int redirect_allowed;
+    int redirected;
+} redirect_filter;
+
+static int is_redirect(int status) {
+    return status == 301 || status == 302 || status == 303 || status == 307 || status == 308;
+}
+
+static int filter_headers(const http_response *resp, void *user) {
+    redirect_filter *f = user;
+    if (f->redirect_allowed && is_redirect(resp->status) && http_get_header(resp, "Location")) {
+        f->redirected = 1;
+        return 1;
+    }
+    if (f->inner && f->inner->on_headers) return f->inner->on_headers(resp, f->inner->user);
+    return 0;
+}
 
-        if (total_size + bytes_received + 1 > capacity) {
-            capacity *= 2;
-            response = realloc(response, capacity);
+static int filter_data(const char *data, size_t len, void *user) {
+    redirect_filter *f = user;
+    if (f->inner && f->inner->on_data) return f->inner->on_data(data, len, f->inner->user);
+    return 0;
+}
+
+typedef struct {
+    const http_sink *inner;
+    http_body body;
+} record_tap;
+
+static int tap_headers(const http_response *resp, void *user) {
+    record_tap *tap = user;
+    if (tap->inner && tap->inner->on_headers) return tap->inner->on_headers(resp, tap->inner->user);
+    return 0;
+}
+
+static int tap_data(const char *data, size_t len, void *user) {
+    record_tap *tap = user;
+    http_body_append(data, len, &tap->body);
+    if (tap->inner && tap->inner->on_data) return tap->inner->on_data(data, len, tap->inner->user);
+    return 0;
+}
+
+static int serve_offline(const offline_resource *res, http_response *resp, const http_sink *sink) {
+    char head[512];
+    int head_len = snprintf(head, sizeof(head), "HTTP/1.1 200 OK\r\nContent-Length: %zu\r\nContent-Type: %s\r\n\r\n", res->len, res->type);
+    if (http_parse_head(head, head_len, resp) != 0) return -1;
+    int skip = sink && sink->on_headers ? sink->on_headers(resp, sink->user) : 0;
+    if (skip) return skip < 0 ? -1 : 0;
+    if (sink && sink->on_data && res->len > 0 && sink->on_data(res->data, res->len, sink->user) != 0) return -1;
+    return 0;
+}
+
+int http_fetch_url(const parsed_url *target, http_response *resp, const http_sink *sink, parsed_url *final_url) {
+    parsed_url current = *target;
+
+    offline_resource local;
+    if (offline_open(target, &local) == 0) {
+        if (final_url) *final_url = local.url;
+        int rc = serve_offline(&local, resp, sink);
+        offline_release(&local);
+        return rc;
+    }
+    if (url_is_file(target)) {
+        memset(resp, 0, sizeof(*resp));
+        return -1;
+    }
+
+    record_tap tap = { sink, {0} };
+    http_sink tapped = { tap_headers, tap_data, &tap };
+    if (archive_recording()) sink = &tapped;
+
+    for (int hops = 0; ; hops++) {
+        if (final_url) *final_url = current;
+        redirect_filter filter = { sink, hops < MAX_REDIRECTS, 0 };
+        http_sink wrapped = { filter_headers, filter_data, &filter };
+
+        if (http_fetch(current.scheme, current.host, current.port, current.path, resp, &wrapped) != 0) {
+            http_body_free(&tap.body);
+            return -1;
         }
-        memcpy(response + total_size, buffer, bytes_received);
-        total_size += bytes_received;
+        if (!filter.redirected) break;
+
+        parsed_url next;
+        if (url_resolve(&current, http_get_header(resp, "Location"), &next) != 0) {
+            http_body_free(&tap.body);
+            return -1;
+        }
+        char shown[URL_MAX];
+        url_format(&next, shown, sizeof(shown));
+        printf("redirected to: %s\n", shown);
+        http_response_free(resp);
+        current = next;
     }
 
-    if (is_https) {
-        SSL_free(ssl);
-        SSL_CTX_free(ctx);
+    if (sink == &tapped) {
+        if (resp->status == 200) {
+            char url[URL_MAX];
+            const char *type = http_get_header(resp, "Content-Type");
+            url_format(target, url, sizeof(url));
+            archive_record(url, type, tap.body.data ? tap.body.data : "", tap.body.len);
+            url_format(&current, url, sizeof(url));
+            archive_record(url, type, tap.body.data ? tap.body.data : "", tap.body.len);
+        }
+        http_body_free(&tap.body);
     }
-    close(sockfd);
+    return 0;
+}
+
+char* fetch_html_scheme(const char *scheme, const char *hostname, const char *port, const char *path, size_t *out_size) {
+    http_response resp;
+    http_body body = {0};
+    http_sink sink = { http_body_headers, http_body_append, &body };
+
+    parsed_url target = {0};
+    strncpy(target.scheme, scheme, sizeof(target.scheme) - 1);
+    strncpy(target.host, hostname, URL_HOST_MAX - 1);
+    strncpy(target.port, port, sizeof(target.port) - 1);
+    strncpy(target.path, path, URL_MAX - 1);
 
-    if (bytes_received < 0) {
-        free(response);
+    if (preload_take(&target, &resp, &body) != 0 && http_fetch_url(&target, &resp, &sink, NULL) != 0) {
+        http_response_free(&resp);
+        http_body_free(&body);
         return NULL;
     }
 
+    size_t total_size = resp.head_len + body.len;
+    char *response = malloc(total_size + 1);
+    memcpy(response, resp.head, resp.head_len);
+    if (body.len) memcpy(response + resp.head_len, body.data, body.len);
     response[total_size] = '\0';
     *out_size = total_size;
 
+    http_response_free(&resp);
+    http_body_free(&body);
     return response;
 }
+
+char* fetch_html(const char *hostname, const char *port, const char *path, size_t *out_size) {
+    return fetch_html_scheme(strcmp(port, "443") == 0 ? "https" : "http", hostname, port, path, out_size);
+}
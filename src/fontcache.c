@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fontcache.h"
+#include "archive.h"
+#include "trace.h"
+
+typedef struct {
+    int px;
+    int style;
+    TTF_Font *font;
+    unsigned long last_used;
+} font_entry;
+
+static font_entry entries[FONT_CACHE_MAX];
+static int entry_count = 0;
+static unsigned long font_clock = 0;
+
+static mapped_file font_file;
+static int font_state = 0;
+
+static const char* font_path() {
+    const char *path = getenv("BROWSER_FONT");
+    return path && *path ? path : "font.ttf";
+}
+
+static int map_font() {
+    if (font_state == 0) {
+        font_state = map_file(font_path(), &font_file) == 0 ? 1 : -1;
+        if (font_state < 0) printf("could not load font: %s\n", font_path());
+    }
+    return font_state > 0 ? 0 : -1;
+}
+
+static TTF_Font* open_font(int px, int style) {
+    if (map_font() != 0) return NULL;
+    TRACE_BEGIN("font.open");
+    SDL_RWops *rw = SDL_RWFromConstMem(font_file.data, (int)font_file.len);
+    TTF_Font *font = rw ? TTF_OpenFontRW(rw, 1, px) : NULL;
+    if (font && style != TTF_STYLE_NORMAL) TTF_SetFontStyle(font, style);
+    TRACE_END("font.open");
+    return font;
+}
+
+TTF_Font* font_get(int px, int style) {
+    if (px < FONT_MIN_PX) px = FONT_MIN_PX;
+    if (px > FONT_MAX_PX) px = FONT_MAX_PX;
+
+    font_entry *slot = NULL;
+    for (int i = 0; i < entry_count; i++) {
+        font_entry *e = &entries[i];
+        if (e->px == px && e->style == style) {
+            e->last_used = ++font_clock;
+            return e->font;
+        }
+        if (!slot || e->last_used < slot->last_used) slot = e;
+    }
+
+    TTF_Font *font = open_font(px, style);
+    if (!font) return NULL;
+
+    if (entry_count < FONT_CACHE_MAX) {
+        slot = &entries[entry_count++];
+    } else {
+        TTF_CloseFont(slot->font);
+    }
+    slot->px = px;
+    slot->style = style;
+    slot->font = font;
+    slot->last_used = ++font_clock;
+    return font;
+}
+
+int font_px_from_css(const char *value) {
+    if (!value) return 0;
+    float size = atof(value);
+    if (size <= 0) return 0;
+    if (strstr(value, "em")) size *= FONT_DEFAULT_PX;
+    else if (strchr(value, '%')) size = size / 100.0f * FONT_DEFAULT_PX;
+    else if (strstr(value, "pt")) size = size * 4.0f / 3.0f;
+    return (int)(size + 0.5f);
+}
+
+void font_cache_shutdown() {
+    for (int i = 0; i < entry_count; i++) TTF_CloseFont(entries[i].font);
+    entry_count = 0;
+    if (font_state > 0) unmap_file(&font_file);
+    font_state = 0;
+}
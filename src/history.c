@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "history.h"
+#include "renderer.h"
+#include "imagepool.h"
+#include "memstat.h"
+#include "trace.h"
+
+#define HISTORY_MAX 50
+#define BFCACHE_MAX_DOCS 8
+
+static history_entry *entries[HISTORY_MAX];
+static int entry_count = 0;
+static int current = -1;
+
+static void drop_tree(history_entry *e) {
+    if (!e->tree) return;
+    free_textures(e->tree);
+    free_tree(e->tree);
+    e->tree = NULL;
+    e->textures_dropped = 0;
+}
+
+static void drop_entry(int index) {
+    drop_tree(entries[index]);
+    free(entries[index]);
+    memmove(entries + index, entries + index + 1, sizeof(history_entry*) * (entry_count - index - 1));
+    entry_count--;
+}
+
+static size_t entry_bytes(history_entry *e) {
+    if (!e->tree) return 0;
+    mem_stats stats;
+    memstat_measure_tree(e->tree, &stats);
+    stats.bytes[MEM_RESPONSE] = 0;
+    return memstat_total(&stats);
+}
+
+static int farthest_entry(int want_textures) {
+    int best = -1;
+    int best_distance = -1;
+    for (int i = 0; i < entry_count; i++) {
+        history_entry *e = entries[i];
+        if (!e->tree || (want_textures && e->textures_dropped)) continue;
+        int distance = abs(i - current);
+        if (distance > best_distance) {
+            best = i;
+            best_distance = distance;
+        }
+    }
+    return best;
+}
+
+static void enforce_budget() {
+    size_t limit = memstat_budget()->bfcache_bytes;
+    size_t total = 0;
+    int docs = 0;
+    for (int i = 0; i < entry_count; i++) {
+        if (entries[i]->tree) docs++;
+        total += entry_bytes(entries[i]);
+    }
+
+    while (total > limit || docs > BFCACHE_MAX_DOCS) {
+        int victim = docs > BFCACHE_MAX_DOCS ? -1 : farthest_entry(1);
+        if (victim >= 0) {
+            total -= entry_bytes(entries[victim]);
+            free_textures(entries[victim]->tree);
+            entries[victim]->textures_dropped = 1;
+            total += entry_bytes(entries[victim]);
+            continue;
+        }
+        victim = farthest_entry(0);
+        if (victim < 0) break;
+        printf("back/forward cache evicted %s\n", entries[victim]->url);
+        total -= entry_bytes(entries[victim]);
+        drop_tree(entries[victim]);
+        docs--;
+    }
+    TRACE_COUNTER("mem.bfcache", (long)total);
+}
+
+void history_store(dom_node *tree, int scroll_y) {
+    if (!tree) return;
+    int pending_images = image_pool_cancel(tree);
+    if (current < 0) {
+        free_textures(tree);
+        free_tree(tree);
+        return;
+    }
+    history_entry *e = entries[current];
+    drop_tree(e);
+    e->tree = tree;
+    e->scroll_y = scroll_y;
+    e->textures_dropped = pending_images > 0;
+    enforce_budget();
+}
+
+void history_commit(const char *url, int replace) {
+    if (replace && current >= 0) {
+        strncpy(entries[current]->url, url, URL_MAX - 1);
+        return;
+    }
+
+    while (entry_count > current + 1) drop_entry(entry_count - 1);
+    if (entry_count == HISTORY_MAX) drop_entry(0);
+
+    history_entry *e = calloc(1, sizeof(history_entry));
+    strncpy(e->url, url, URL_MAX - 1);
+    entries[entry_count++] = e;
+    current = entry_count - 1;
+}
+
+int history_can_go(int delta) {
+    int target = current + delta;
+    return current >= 0 && target >= 0 && target < entry_count;
+}
+
+history_entry* history_go(int delta) {
+    if (!history_can_go(delta)) return NULL;
+    current += delta;
+    return entries[current];
+}
+
+size_t history_cached_bytes() {
+    size_t total = 0;
+    for (int i = 0; i < entry_count; i++) total += entry_bytes(entries[i]);
+    return total;
+}
+
+void history_clear() {
+    while (entry_count > 0) drop_entry(entry_count - 1);
+    current = -1;
+}
@@ -0,0 +1,343 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <zlib.h>
+#include "http.h"
+
+#define INFLATE_CHUNK 16384
+
+typedef enum {
+    CHUNK_SIZE,
+    CHUNK_EXT,
+    CHUNK_SIZE_LF,
+    CHUNK_DATA,
+    CHUNK_DATA_CR,
+    CHUNK_DATA_LF,
+    CHUNK_TRAILER,
+    CHUNK_TRAILER_LF,
+    CHUNK_DONE
+} chunk_state;
+
+struct http_decoder {
+    const http_sink *sink;
+    int chunked;
+    long remaining;
+    int done;
+    int failed;
+
+    chunk_state state;
+    size_t chunk_left;
+    int trailer_line_len;
+
+    http_encoding encoding;
+    int inflating;
+    int raw_retry;
+    z_stream zs;
+};
+
+long http_find_head_end(const char *data, size_t len) {
+    for (size_t i = 0; i + 3 < len; i++) {
+        if (data[i] == '\r' && data[i + 1] == '\n' && data[i + 2] == '\r' && data[i + 3] == '\n') return (long)(i + 4);
+    }
+    for (size_t i = 0; i + 1 < len; i++) {
+        if (data[i] == '\n' && data[i + 1] == '\n') return (long)(i + 2);
+    }
+    return -1;
+}
+
+static char* trim(char *s) {
+    while (*s == ' ' || *s == '\t') s++;
+    char *end = s + strlen(s);
+    while (end > s && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) *--end = '\0';
+    return s;
+}
+
+int http_parse_head(const char *data, size_t len, http_response *resp) {
+    memset(resp, 0, sizeof(*resp));
+    resp->content_length = -1;
+
+    if (len < 12 || strncmp(data, "HTTP/", 5) != 0) return -1;
+
+    resp->head = malloc(len + 1);
+    memcpy(resp->head, data, len);
+    resp->head[len] = '\0';
+    resp->head_len = len;
+
+    char *line = resp->head;
+    char *next = strchr(line, '\n');
+    if (next) *next++ = '\0';
+
+    int major = 1;
+    if (sscanf(line, "HTTP/%d.%d %d", &major, &resp->minor_version, &resp->status) < 3) {
+        if (sscanf(line, "HTTP/%d %d", &major, &resp->status) < 2) {
+            http_response_free(resp);
+            return -1;
+        }
+    }
+
+    while (next && *next) {
+        line = next;
+        next = strchr(line, '\n');
+        if (next) *next++ = '\0';
+
+        char *colon = strchr(line, ':');
+        if (!colon) continue;
+        *colon = '\0';
+        if (resp->header_count >= HTTP_MAX_HEADERS) continue;
+        resp->headers[resp->header_count].name = trim(line);
+        resp->headers[resp->header_count].value = trim(colon + 1);
+        resp->header_count++;
+    }
+
+    const char *val = http_get_header(resp, "Content-Length");
+    if (val) resp->content_length = atol(val);
+
+    val = http_get_header(resp, "Transfer-Encoding");
+    if (val && strcasestr(val, "chunked")) resp->chunked = 1;
+
+    val = http_get_header(resp, "Content-Encoding");
+    if (val && (strcasestr(val, "gzip") || strcasestr(val, "x-gzip"))) resp->encoding = HTTP_ENCODING_GZIP;
+    else if (val && strcasestr(val, "deflate")) resp->encoding = HTTP_ENCODING_DEFLATE;
+
+    val = http_get_header(resp, "Connection");
+    if (major == 1 && resp->minor_version >= 1) {
+        resp->keep_alive = !(val && strcasestr(val, "close"));
+    } else {
+        resp->keep_alive = (val && strcasestr(val, "keep-alive"));
+    }
+
+    resp->has_body = !((resp->status >= 100 && resp->status < 200) || resp->status == 204 || resp->status == 304);
+    if (resp->chunked) resp->content_length = -1;
+
+    return 0;
+}
+
+const char* http_get_header(const http_response *resp, const char *name) {
+    for (int i = 0; i < resp->header_count; i++) {
+        if (strcasecmp(resp->headers[i].name, name) == 0) return resp->headers[i].value;
+    }
+    return NULL;
+}
+
+long http_freshness_lifetime(const http_response *resp) {
+    const char *cc = http_get_header(resp, "Cache-Control");
+    if (cc) {
+        if (strcasestr(cc, "no-store")) return -1;
+        if (strcasestr(cc, "no-cache")) return 0;
+        const char *age = strcasestr(cc, "max-age=");
+        if (age) return atol(age + 8) > 0 ? atol(age + 8) : 0;
+    }
+    return 0;
+}
+
+void http_response_free(http_response *resp) {
+    if (resp->head) free(resp->head);
+    resp->head = NULL;
+    resp->header_count = 0;
+}
+
+http_decoder* http_decoder_new(const http_response *resp, const http_sink *sink) {
+    http_decoder *dec = calloc(1, sizeof(http_decoder));
+    dec->sink = sink;
+    dec->chunked = resp->chunked;
+    dec->remaining = resp->has_body ? resp->content_length : 0;
+    dec->encoding = resp->encoding;
+    dec->state = CHUNK_SIZE;
+    if (!resp->has_body || (!dec->chunked && dec->remaining == 0)) dec->done = 1;
+
+    if (dec->encoding != HTTP_ENCODING_IDENTITY) {
+        int window = dec->encoding == HTTP_ENCODING_GZIP ? 15 + 32 : 15;
+        if (inflateInit2(&dec->zs, window) == Z_OK) dec->inflating = 1;
+        else dec->failed = 1;
+    }
+    return dec;
+}
+
+static int emit(http_decoder *dec, const char *data, size_t len) {
+    if (len == 0) return 0;
+    if (dec->sink && dec->sink->on_data) return dec->sink->on_data(data, len, dec->sink->user);
+    return 0;
+}
+
+static int inflate_into_sink(http_decoder *dec, const char *data, size_t len) {
+    if (!dec->inflating) return emit(dec, data, len);
+
+    char out[INFLATE_CHUNK];
+    dec->zs.next_in = (Bytef*)data;
+    dec->zs.avail_in = (uInt)len;
+
+    while (dec->zs.avail_in > 0) {
+        dec->zs.next_out = (Bytef*)out;
+        dec->zs.avail_out = sizeof(out);
+        int rc = inflate(&dec->zs, Z_NO_FLUSH);
+
+        if (rc == Z_DATA_ERROR && dec->encoding == HTTP_ENCODING_DEFLATE && !dec->raw_retry && dec->zs.total_out == 0) {
+            dec->raw_retry = 1;
+            inflateEnd(&dec->zs);
+            memset(&dec->zs, 0, sizeof(dec->zs));
+            if (inflateInit2(&dec->zs, -15) != Z_OK) return -1;
+            dec->zs.next_in = (Bytef*)data;
+            dec->zs.avail_in = (uInt)len;
+            continue;
+        }
+        if (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR) return -1;
+
+        if (emit(dec, out, sizeof(out) - dec->zs.avail_out) != 0) return -1;
+        if (rc == Z_STREAM_END) break;
+        if (rc == Z_BUF_ERROR && dec->zs.avail_out != 0) break;
+    }
+    return 0;
+}
+
+static int feed_chunked(http_decoder *dec, const char *data, size_t len) {
+    const char *p = data;
+    const char *end = data + len;
+
+    while (p < end && dec->state != CHUNK_DONE) {
+        char c = *p;
+        switch (dec->state) {
+            case CHUNK_SIZE:
+                if (isxdigit((unsigned char)c)) {
+                    if (dec->chunk_left > ((size_t)-1 >> 4)) return -1;
+                    int d = isdigit((unsigned char)c) ? c - '0' : tolower((unsigned char)c) - 'a' + 10;
+                    dec->chunk_left = dec->chunk_left * 16 + d;
+                } else if (c == ';' || c == ' ' || c == '\t') {
+                    dec->state = CHUNK_EXT;
+                } else if (c == '\r') {
+                    dec->state = CHUNK_SIZE_LF;
+                } else if (c == '\n') {
+                    dec->state = dec->chunk_left ? CHUNK_DATA : CHUNK_TRAILER;
+                } else {
+                    return -1;
+                }
+                p++;
+                break;
+            case CHUNK_EXT:
+                if (c == '\n') dec->state = dec->chunk_left ? CHUNK_DATA : CHUNK_TRAILER;
+                p++;
+                break;
+            case CHUNK_SIZE_LF:
+                if (c != '\n') return -1;
+                dec->state = dec->chunk_left ? CHUNK_DATA : CHUNK_TRAILER;
+                dec->trailer_line_len = 0;
+                p++;
+                break;
+            case CHUNK_DATA: {
+                size_t n = (size_t)(end - p) < dec->chunk_left ? (size_t)(end - p) : dec->chunk_left;
+                if (inflate_into_sink(dec, p, n) != 0) return -1;
+                p += n;
+                dec->chunk_left -= n;
+                if (dec->chunk_left == 0) dec->state = CHUNK_DATA_CR;
+                break;
+            }
+            case CHUNK_DATA_CR:
+                dec->state = (c == '\r') ? CHUNK_DATA_LF : CHUNK_SIZE;
+                if (c == '\n') dec->state = CHUNK_SIZE;
+                if (c == '\r' || c == '\n') p++;
+                break;
+            case CHUNK_DATA_LF:
+                if (c != '\n') return -1;
+                dec->state = CHUNK_SIZE;
+                p++;
+                break;
+            case CHUNK_TRAILER:
+                if (c == '\r') {
+                    dec->state = CHUNK_TRAILER_LF;
+                } else if (c == '\n') {
+                    if (dec->trailer_line_len == 0) dec->state = CHUNK_DONE;
+                    dec->trailer_line_len = 0;
+                } else {
+                    dec->trailer_line_len++;
+                }
+                p++;
+                break;
+            case CHUNK_TRAILER_LF:
+                if (c != '\n') return -1;
+                if (dec->trailer_line_len == 0) dec->state = CHUNK_DONE;
+                else dec->state = CHUNK_TRAILER;
+                dec->trailer_line_len = 0;
+                p++;
+                break;
+            case CHUNK_DONE:
+                break;
+        }
+    }
+
+    if (dec->state == CHUNK_DONE) dec->done = 1;
+    return 0;
+}
+
+int http_decoder_feed(http_decoder *dec, const char *data, size_t len) {
+    if (dec->failed) return -1;
+    if (dec->done || len == 0) return dec->done;
+
+    int rc;
+    if (dec->chunked) {
+        rc = feed_chunked(dec, data, len);
+    } else {
+        if (dec->remaining >= 0 && (long)len > dec->remaining) len = dec->remaining;
+        rc = inflate_into_sink(dec, data, len);
+        if (dec->remaining >= 0) {
+            dec->remaining -= len;
+            if (dec->remaining == 0) dec->done = 1;
+        }
+    }
+    if (rc != 0) {
+        dec->failed = 1;
+        return -1;
+    }
+    return dec->done;
+}
+
+int http_decoder_finish(http_decoder *dec) {
+    if (dec->failed) return -1;
+    if (!dec->chunked && dec->remaining < 0) dec->done = 1;
+    return dec->done ? 0 : -1;
+}
+
+int http_decoder_done(const http_decoder *dec) {
+    return dec->done;
+}
+
+void http_decoder_free(http_decoder *dec) {
+    if (!dec) return;
+    if (dec->inflating) inflateEnd(&dec->zs);
+    free(dec);
+}
+
+int http_body_headers(const http_response *resp, void *user) {
+    http_body *body = user;
+    if (resp->content_length <= 0 || resp->encoding != HTTP_ENCODING_IDENTITY) return 0;
+    size_t cap = resp->content_length < HTTP_MAX_PREALLOC ? (size_t)resp->content_length + 1 : HTTP_MAX_PREALLOC;
+    if (cap <= body->cap) return 0;
+    char *data = realloc(body->data, cap);
+    if (!data) return -1;
+    body->data = data;
+    body->cap = cap;
+    return 0;
+}
+
+int http_body_append(const char *data, size_t len, void *user) {
+    http_body *body = user;
+    if (body->len + len + 1 > body->cap) {
+        size_t cap = body->cap ? body->cap : 8192;
+        while (body->len + len + 1 > cap) cap *= 2;
+        char *grown = realloc(body->data, cap);
+        if (!grown) return -1;
+        body->data = grown;
+        body->cap = cap;
+    }
+    memcpy(body->data + body->len, data, len);
+    body->len += len;
+    body->data[body->len] = '\0';
+    return 0;
+}
+
+void http_body_free(http_body *body) {
+    if (body->data) free(body->data);
+    body->data = NULL;
+    body->len = body->cap = 0;
+}
@@ -0,0 +1,516 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include "imagepool.h"
+#include "fetcher.h"
+#include "preload.h"
+#include "archive.h"
+#include "dump.h"
+#include "resample.h"
+#include "progressive.h"
+#include "memstat.h"
+#include "trace.h"
+
+#define PROGRESSIVE_FRAME_MS 100
+
+typedef enum {
+    JOB_QUEUED,
+    JOB_DECODING,
+    JOB_DONE
+} job_state;
+
+typedef struct image_job {
+    dom_node *root;
+    dom_node *node;
+    parsed_url target;
+    char url[URL_MAX];
+    image_fit fit;
+    int download_assets;
+    job_state state;
+    int cancelled;
+    SDL_Surface *surface;
+    SDL_Surface *partial;
+    int sized;
+    int updated;
+    int img_w, img_h;
+    int box_w, box_h;
+    int nat_w, nat_h;
+    struct image_job *next;
+} image_job;
+
+typedef struct {
+    image_job *job;
+    http_body *body;
+    progressive_decoder *decoder;
+    uint64_t last_frame;
+} image_stream;
+
+typedef struct image_variant {
+    char *url;
+    SDL_Surface *surface;
+    int nat_w, nat_h;
+    int users;
+    unsigned long last_used;
+    struct image_variant *next;
+} image_variant;
+
+static image_job *jobs_head = NULL;
+static image_job *jobs_tail = NULL;
+static int job_count = 0;
+static int stopping = 0;
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_queued = PTHREAD_COND_INITIALIZER;
+static pthread_once_t workers_once = PTHREAD_ONCE_INIT;
+static pthread_t workers[IMAGE_MAX_WORKERS];
+static int worker_count = 0;
+
+static image_variant *variants = NULL;
+static size_t variant_bytes = 0;
+static unsigned long variant_clock = 0;
+
+static void unlink_job(image_job *job) {
+    image_job *prev = NULL;
+    for (image_job *j = jobs_head; j; prev = j, j = j->next) {
+        if (j != job) continue;
+        if (prev) prev->next = j->next;
+        else jobs_head = j->next;
+        if (jobs_tail == j) jobs_tail = prev;
+        job_count--;
+        return;
+    }
+}
+
+static void job_free(image_job *job) {
+    if (job->surface) SDL_FreeSurface(job->surface);
+    if (job->partial) SDL_FreeSurface(job->partial);
+    free(job);
+}
+
+static size_t surface_bytes(const SDL_Surface *surf) {
+    return (size_t)surf->pitch * surf->h;
+}
+
+static size_t variant_budget() {
+    const char *val = getenv("BROWSER_IMAGE_CACHE_MB");
+    long mb = val ? atol(val) : 32;
+    return (size_t)(mb > 0 ? mb : 0) * 1024 * 1024;
+}
+
+static void fit_size(image_job *job, int nat_w, int nat_h) {
+    const image_fit *fit = &job->fit;
+    job->nat_w = nat_w;
+    job->nat_h = nat_h;
+    job->img_w = nat_w;
+    job->img_h = nat_h;
+    if (fit->attr_w > 0 && fit->attr_h > 0) {
+        job->img_w = fit->attr_w;
+        job->img_h = fit->attr_h;
+    } else if (fit->attr_w > 0) {
+        job->img_w = fit->attr_w;
+        job->img_h = (int)((long)nat_h * fit->attr_w / nat_w);
+    } else if (fit->attr_h > 0) {
+        job->img_w = (int)((long)nat_w * fit->attr_h / nat_h);
+        job->img_h = fit->attr_h;
+    }
+    if (job->img_w < 1) job->img_w = 1;
+    if (job->img_h < 1) job->img_h = 1;
+
+    job->box_w = job->img_w;
+    job->box_h = job->img_h;
+    if (fit->exact_w > 0 && fit->exact_h > 0) {
+        job->box_w = fit->exact_w;
+        job->box_h = fit->exact_h;
+    } else if (fit->max_w > 0 && job->box_w > fit->max_w) {
+        job->box_h = (int)((long)job->box_h * fit->max_w / job->box_w);
+        job->box_w = fit->max_w;
+        if (job->box_h < 1) job->box_h = 1;
+    }
+}
+
+static SDL_Surface* scale_to_box(SDL_Surface *src, const image_job *job) {
+    if (job->box_w >= src->w || job->box_h >= src->h) {
+        if (job->box_w == src->w && job->box_h == src->h) return SDL_ConvertSurfaceFormat(src, SDL_PIXELFORMAT_ARGB8888, 0);
+        if (src->w == job->nat_w && src->h == job->nat_h) return SDL_ConvertSurfaceFormat(src, SDL_PIXELFORMAT_ARGB8888, 0);
+        return NULL;
+    }
+    SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, job->box_w, job->box_h, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!dst) return NULL;
+    TRACE_BEGIN("image.resample");
+    resample_box((const uint32_t*)src->pixels, src->w, src->h, src->pitch, (uint32_t*)dst->pixels, dst->w, dst->h, dst->pitch);
+    TRACE_END("image.resample");
+    return dst;
+}
+
+static image_variant* acquire_variant(image_job *job) {
+    pthread_mutex_lock(&pool_lock);
+    image_variant *best = NULL;
+    for (image_variant *v = variants; v; v = v->next) {
+        if (strcmp(v->url, job->url) != 0) continue;
+        if (!best) fit_size(job, v->nat_w, v->nat_h);
+        int covers = (v->surface->w >= job->box_w && v->surface->h >= job->box_h) || (v->surface->w == v->nat_w && v->surface->h == v->nat_h);
+        if (covers && (!best || v->surface->w < best->surface->w)) best = v;
+    }
+    if (best) {
+        best->users++;
+        best->last_used = ++variant_clock;
+    }
+    pthread_mutex_unlock(&pool_lock);
+    return best;
+}
+
+static void release_variant(image_variant *v) {
+    pthread_mutex_lock(&pool_lock);
+    v->users--;
+    pthread_mutex_unlock(&pool_lock);
+}
+
+static SDL_Surface* from_variant(image_job *job) {
+    image_variant *v = acquire_variant(job);
+    if (!v) return NULL;
+    SDL_Surface *surf = scale_to_box(v->surface, job);
+    release_variant(v);
+    return surf;
+}
+
+static void fit_locked(image_job *job, int nat_w, int nat_h) {
+    pthread_mutex_lock(&pool_lock);
+    fit_size(job, nat_w, nat_h);
+    pthread_mutex_unlock(&pool_lock);
+}
+
+static SDL_Surface* decoder_view(progressive_decoder *decoder) {
+    int w, h, pitch;
+    const uint32_t *pixels = progressive_pixels(decoder, &pitch);
+    if (!pixels || progressive_size(decoder, &w, &h) != 0) return NULL;
+    return SDL_CreateRGBSurfaceWithFormatFrom((void*)pixels, w, h, 32, pitch, SDL_PIXELFORMAT_ARGB8888);
+}
+
+static void publish_progress(image_stream *stream) {
+    image_job *job = stream->job;
+    int w, h;
+    if (!job->sized && progressive_size(stream->decoder, &w, &h) == 0) {
+        if ((size_t)w * h * 4 > memstat_budget()->image_bytes) return;
+        pthread_mutex_lock(&pool_lock);
+        fit_size(job, w, h);
+        job->sized = 1;
+        job->updated = 1;
+        pthread_mutex_unlock(&pool_lock);
+    }
+
+    uint64_t now = trace_now_ns();
+    if (!job->sized || (now - stream->last_frame) / 1000000 < PROGRESSIVE_FRAME_MS) return;
+    if (!progressive_updated(stream->decoder)) return;
+    stream->last_frame = now;
+
+    SDL_Surface *view = decoder_view(stream->decoder);
+    if (!view) return;
+    TRACE_BEGIN("image.progressive");
+    SDL_Surface *frame = scale_to_box(view, job);
+    TRACE_END("image.progressive");
+    SDL_FreeSurface(view);
+    if (!frame) return;
+
+    pthread_mutex_lock(&pool_lock);
+    if (job->partial) SDL_FreeSurface(job->partial);
+    job->partial = frame;
+    job->updated = 1;
+    pthread_mutex_unlock(&pool_lock);
+}
+
+static int stream_headers(const http_response *resp, void *user) {
+    image_stream *stream = user;
+    return http_body_headers(resp, stream->body);
+}
+
+static int stream_data(const char *data, size_t len, void *user) {
+    image_stream *stream = user;
+    if (http_body_append(data, len, stream->body) != 0) return -1;
+    if (stream->decoder && progressive_feed(stream->decoder, data, len) == 0) publish_progress(stream);
+
+    pthread_mutex_lock(&pool_lock);
+    int cancelled = stream->job->cancelled;
+    pthread_mutex_unlock(&pool_lock);
+    return cancelled ? -1 : 0;
+}
+
+static SDL_Surface* fetch_and_decode(image_job *job) {
+    const char *url = job->url;
+    http_response resp = {0};
+    http_body img = {0};
+    image_stream stream = { job, &img, progressive_new(memstat_budget()->image_bytes), trace_now_ns() };
+    http_sink sink = { stream_headers, stream_data, &stream };
+
+    offline_resource local;
+    int offline = offline_open(&job->target, &local) == 0;
+    int fetched = offline || preload_take(&job->target, &resp, &img) == 0 || http_fetch_url(&job->target, &resp, &sink, NULL) == 0;
+    const char *body = offline ? local.data : img.data;
+    size_t body_len = offline ? local.len : img.len;
+
+    SDL_Surface *surf = NULL;
+    if (fetched && body_len > 0) {
+        memstat_add(MEM_RESPONSE, img.cap);
+        if (job->download_assets) dump_submit(url, "image", body, body_len);
+
+        TRACE_BEGIN("image.decode");
+        if (stream.decoder && progressive_complete(stream.decoder)) {
+            SDL_Surface *view = decoder_view(stream.decoder);
+            if (view) {
+                surf = SDL_ConvertSurfaceFormat(view, SDL_PIXELFORMAT_ARGB8888, 0);
+                SDL_FreeSurface(view);
+            }
+        }
+        if (!surf) {
+            SDL_RWops *rw = SDL_RWFromConstMem(body, body_len);
+            surf = IMG_Load_RW(rw, 1);
+        }
+        if (surf && (size_t)surf->w * surf->h * 4 > memstat_budget()->image_bytes) {
+            printf("refusing oversized image %dx%d: %s\n", surf->w, surf->h, url);
+            SDL_FreeSurface(surf);
+            surf = NULL;
+        }
+        if (surf && surf->format->format != SDL_PIXELFORMAT_ARGB8888) {
+            SDL_Surface *converted = SDL_ConvertSurfaceFormat(surf, SDL_PIXELFORMAT_ARGB8888, 0);
+            if (converted) {
+                SDL_FreeSurface(surf);
+                surf = converted;
+            }
+        }
+        TRACE_END("image.decode");
+        memstat_sub(MEM_RESPONSE, img.cap);
+    }
+
+    if (offline) offline_release(&local);
+    progressive_free(stream.decoder);
+    http_response_free(&resp);
+    http_body_free(&img);
+
+    if (surf) {
+        fit_locked(job, surf->w, surf->h);
+        if (job->box_w < surf->w && job->box_h < surf->h) {
+            SDL_Surface *scaled = scale_to_box(surf, job);
+            if (scaled) {
+                SDL_FreeSurface(surf);
+                surf = scaled;
+            }
+        }
+    }
+    return surf;
+}
+
+static image_job* next_queued() {
+    for (image_job *j = jobs_head; j; j = j->next) {
+        if (j->state == JOB_QUEUED) return j;
+    }
+    return NULL;
+}
+
+static void* worker_main(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&pool_lock);
+    while (!stopping) {
+        image_job *job = next_queued();
+        if (!job) {
+            pthread_cond_wait(&pool_queued, &pool_lock);
+            continue;
+        }
+        job->state = JOB_DECODING;
+        pthread_mutex_unlock(&pool_lock);
+
+        SDL_Surface *surf = from_variant(job);
+        if (!surf) surf = fetch_and_decode(job);
+
+        pthread_mutex_lock(&pool_lock);
+        job->surface = surf;
+        job->state = JOB_DONE;
+        if (job->cancelled || !surf) {
+            unlink_job(job);
+            job_free(job);
+        }
+    }
+    pthread_mutex_unlock(&pool_lock);
+    return NULL;
+}
+
+static void start_workers() {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int wanted = cores < 2 ? 2 : cores > IMAGE_MAX_WORKERS ? IMAGE_MAX_WORKERS : (int)cores;
+    for (int i = 0; i < wanted; i++) {
+        if (pthread_create(&workers[worker_count], NULL, worker_main, NULL) == 0) worker_count++;
+    }
+}
+
+void image_pool_request(dom_node *root, dom_node *node, const parsed_url *target, const image_fit *fit, int download_assets) {
+    pthread_once(&workers_once, start_workers);
+
+    image_job *job = calloc(1, sizeof(image_job));
+    job->root = root;
+    job->node = node;
+    job->target = *target;
+    url_format(target, job->url, sizeof(job->url));
+    job->fit = *fit;
+    job->download_assets = download_assets;
+    job->state = JOB_QUEUED;
+
+    pthread_mutex_lock(&pool_lock);
+    int duplicate = stopping;
+    for (image_job *j = jobs_head; j && !duplicate; j = j->next) duplicate = j->node == node && !j->cancelled;
+    if (duplicate) {
+        pthread_mutex_unlock(&pool_lock);
+        free(job);
+        return;
+    }
+    if (jobs_tail) jobs_tail->next = job;
+    else jobs_head = job;
+    jobs_tail = job;
+    job_count++;
+    pthread_cond_signal(&pool_queued);
+    pthread_mutex_unlock(&pool_lock);
+}
+
+int image_pool_take(image_result *out) {
+    pthread_mutex_lock(&pool_lock);
+    image_job *found = NULL;
+    for (image_job *j = jobs_head; j && !found; j = j->next) {
+        if (!j->cancelled && (j->state == JOB_DONE || j->updated)) found = j;
+    }
+    int partial = found && found->state != JOB_DONE;
+    if (found) {
+        if (!partial) unlink_job(found);
+        out->root = found->root;
+        out->node = found->node;
+        out->surface = partial ? found->partial : found->surface;
+        out->partial = partial;
+        out->url = strdup(found->url);
+        out->img_w = found->img_w;
+        out->img_h = found->img_h;
+        out->box_w = found->box_w;
+        out->box_h = found->box_h;
+        out->nat_w = found->nat_w;
+        out->nat_h = found->nat_h;
+        found->surface = NULL;
+        found->partial = NULL;
+        found->updated = 0;
+    }
+    pthread_mutex_unlock(&pool_lock);
+
+    if (!found) return -1;
+    if (!partial) job_free(found);
+    return 0;
+}
+
+static void evict_variants(size_t budget) {
+    while (variant_bytes > budget) {
+        image_variant **victim = NULL;
+        for (image_variant **pv = &variants; *pv; pv = &(*pv)->next) {
+            if ((*pv)->users == 0 && (!victim || (*pv)->last_used < (*victim)->last_used)) victim = pv;
+        }
+        if (!victim) return;
+        image_variant *v = *victim;
+        *victim = v->next;
+        variant_bytes -= surface_bytes(v->surface);
+        SDL_FreeSurface(v->surface);
+        free(v->url);
+        free(v);
+    }
+}
+
+void image_pool_release(image_result *result) {
+    SDL_Surface *surf = result->surface;
+    size_t budget = variant_budget();
+    int keep = surf && !result->partial && surface_bytes(surf) <= budget;
+
+    pthread_mutex_lock(&pool_lock);
+    for (image_variant *v = variants; v && keep; v = v->next) {
+        keep = strcmp(v->url, result->url) != 0 || v->surface->w != surf->w || v->surface->h != surf->h;
+    }
+    if (keep) {
+        image_variant *v = calloc(1, sizeof(image_variant));
+        v->url = result->url;
+        v->surface = surf;
+        v->nat_w = result->nat_w;
+        v->nat_h = result->nat_h;
+        v->last_used = ++variant_clock;
+        v->next = variants;
+        variants = v;
+        variant_bytes += surface_bytes(surf);
+        evict_variants(budget);
+    }
+    pthread_mutex_unlock(&pool_lock);
+
+    if (!keep) {
+        if (surf) SDL_FreeSurface(surf);
+        free(result->url);
+    }
+    result->surface = NULL;
+    result->url = NULL;
+}
+
+int image_pool_pending(dom_node *root) {
+    pthread_mutex_lock(&pool_lock);
+    int pending = root ? 0 : job_count;
+    for (image_job *j = jobs_head; root && j; j = j->next) {
+        if (j->root == root && !j->cancelled) pending++;
+    }
+    pthread_mutex_unlock(&pool_lock);
+    return pending;
+}
+
+int image_pool_cancel(dom_node *root) {
+    int cancelled = 0;
+    image_job *dropped = NULL;
+
+    pthread_mutex_lock(&pool_lock);
+    image_job *j = jobs_head;
+    while (j) {
+        image_job *next = j->next;
+        if ((!root || j->root == root) && !j->cancelled) {
+            cancelled++;
+            if (j->state == JOB_DECODING) {
+                j->cancelled = 1;
+            } else {
+                unlink_job(j);
+                j->next = dropped;
+                dropped = j;
+            }
+        }
+        j = next;
+    }
+    pthread_mutex_unlock(&pool_lock);
+
+    while (dropped) {
+        image_job *next = dropped->next;
+        job_free(dropped);
+        dropped = next;
+    }
+    return cancelled;
+}
+
+double image_upload_budget_ms() {
+    const char *val = getenv("BROWSER_UPLOAD_BUDGET_MS");
+    double ms = val ? atof(val) : 0;
+    return ms > 0 ? ms : 4.0;
+}
+
+void image_pool_shutdown() {
+    image_pool_cancel(NULL);
+    pthread_mutex_lock(&pool_lock);
+    stopping = 1;
+    pthread_cond_broadcast(&pool_queued);
+    pthread_mutex_unlock(&pool_lock);
+    for (int i = 0; i < worker_count; i++) pthread_join(workers[i], NULL);
+    worker_count = 0;
+
+    while (jobs_head) {
+        image_job *next = jobs_head->next;
+        job_free(jobs_head);
+        jobs_head = next;
+    }
+    jobs_tail = NULL;
+    job_count = 0;
+    evict_variants(0);
+}
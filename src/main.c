@@ -1,14 +1,39 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <malloc.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
 #include <SDL2/SDL.h>
 #include "fetcher.h"
+#include "dns.h"
+#include "preload.h"
+#include "prerender.h"
+#include "history.h"
+#include "snapshot.h"
+#include "archive.h"
+#include "dump.h"
+#include "imagepool.h"
+#include "treepool.h"
 #include "processor.h"
 #include "renderer.h"
 #include "css.h"
+#include "trace.h"
+#include "memstat.h"
 
 #define MAX_URL 8192
 
+static int history_traversing = 0;
+static char current_url[MAX_URL];
+static long long current_expires = 0;
+static int current_cacheable = 0;
+
+static const char *archive_pending_path = NULL;
+static char archive_pending_url[MAX_URL];
+static dom_node *archive_pending_tree = NULL;
+static page_archive *document_archive = NULL;
+
 void load_url(char *url_buffer, dom_node **tree, int make_temp, int *scroll_y, dom_node **focused_node, int download_assets);
 
 dom_node* find_text_input(dom_node *node) {
@@ -93,6 +118,175 @@ void submit_form(dom_node *node, char *url_buffer, dom_node **tree, int make_tem
     load_url(url_buffer, tree, make_temp, scroll_y, focused_node, download_assets);
 }
 
+static int is_followable_link(dom_node *node) {
+    return node->tag && strcasecmp(node->tag, "a") == 0 && node->href && node->href[0] != '#' &&
+        strncmp(node->href, "javascript:", 11) != 0 && strncmp(node->href, "mailto:", 7) != 0;
+}
+
+dom_node* find_link_at(dom_node *node, int mx, int absolute_y) {
+    if (!node) return NULL;
+    if (is_followable_link(node) && node->layout.w > 0 && node->layout.h > 0 &&
+        mx >= node->layout.x && mx <= node->layout.x + node->layout.w &&
+        absolute_y >= node->layout.y && absolute_y <= node->layout.y + node->layout.h) {
+        return node;
+    }
+    for (int i = 0; i < node->child_count; i++) {
+        dom_node *res = find_link_at(node->children[i], mx, absolute_y);
+        if (res) return res;
+    }
+    return NULL;
+}
+
+void prefetch_link(dom_node *link, const char *url_buffer) {
+    parsed_url base, target;
+    if (url_parse(url_buffer, &base) != 0 || url_resolve(&base, link->href, &target) != 0) return;
+    if (memcmp(&base, &target, sizeof(parsed_url)) == 0) return;
+    prerender_request(&target);
+}
+
+static void finish_archive() {
+    if (!archive_pending_path) return;
+    if (archive_record_end(archive_pending_url, archive_pending_path) != 0) printf("could not write page archive %s\n", archive_pending_path);
+    archive_pending_path = NULL;
+    archive_pending_tree = NULL;
+}
+
+static void poll_archive(dom_node *tree) {
+    if (!archive_pending_path) return;
+    if (!tree || archive_pending_tree != tree || image_pool_pending(tree) == 0) finish_archive();
+}
+
+static void leave_document(dom_node *tree, int scroll_y) {
+    if (tree && current_cacheable && current_expires > time(NULL)) {
+        char path[1024];
+        snapshot_path(current_url, path, sizeof(path));
+        if (snapshot_save(path, tree, current_url, scroll_y, current_expires) != 0) printf("could not write snapshot for %s\n", current_url);
+    }
+    history_store(tree, scroll_y);
+    archive_release_mount(document_archive);
+    document_archive = NULL;
+}
+
+static void enter_document(const char *url, long lifetime) {
+    strncpy(current_url, url, MAX_URL - 1);
+    current_url[MAX_URL - 1] = '\0';
+    current_cacheable = lifetime >= 0;
+    current_expires = lifetime > 0 ? (long long)time(NULL) + lifetime : 0;
+}
+
+static void show_snapshot(snapshot_doc *snap, char *url_buffer, dom_node **tree, int download_assets) {
+    for (int i = 0; i < snap->asset_count; i++) {
+        parsed_url asset;
+        if (url_parse(snap->assets[i], &asset) == 0) preload_fetch(&asset);
+    }
+    *tree = snap->tree;
+    snap->tree = NULL;
+    strncpy(url_buffer, snap->url, MAX_URL - 1);
+    url_buffer[MAX_URL - 1] = '\0';
+
+    TRACE_BEGIN("images");
+    load_images(*tree, url_buffer, download_assets);
+    TRACE_END("images");
+    enforce_memory_budget(*tree, 0);
+    snapshot_doc_free(snap);
+}
+
+static int restore_session(char *url_buffer, dom_node **tree, int *scroll_y, int download_assets) {
+    char session[1024];
+    char url[MAX_URL] = {0};
+    snapshot_session_path(session, sizeof(session));
+    FILE *f = fopen(session, "r");
+    if (!f) return 0;
+    int got = fgets(url, sizeof(url), f) != NULL;
+    fclose(f);
+    if (!got) return 0;
+    url[strcspn(url, "\r\n")] = '\0';
+
+    char path[1024];
+    snapshot_doc snap;
+    snapshot_path(url, path, sizeof(path));
+    if (snapshot_load(path, &snap) != 0) return 0;
+
+    printf("restored session from snapshot of %s\n", snap.url);
+    TRACE_SCOPE("navigate.restore");
+    long long remaining = snap.expires - (long long)time(NULL);
+    enter_document(snap.url, remaining > 0 ? remaining : 0);
+    history_commit(snap.url, 0);
+    *scroll_y = snap.scroll_y;
+    show_snapshot(&snap, url_buffer, tree, download_assets);
+    return 1;
+}
+
+static void save_session(dom_node *tree, int scroll_y) {
+    char session[1024];
+    snapshot_session_path(session, sizeof(session));
+    if (!tree || !current_cacheable || !current_url[0]) {
+        unlink(session);
+        return;
+    }
+
+    char path[1024];
+    snapshot_path(current_url, path, sizeof(path));
+    if (snapshot_save(path, tree, current_url, scroll_y, current_expires) != 0) return;
+    FILE *f = fopen(session, "w");
+    if (f) {
+        fprintf(f, "%s\n", current_url);
+        fclose(f);
+    }
+}
+
+static int show_prerendered(const parsed_url *target, char *url_buffer, dom_node **tree, int *scroll_y, dom_node **focused_node, int download_assets) {
+    dom_node *ready = NULL;
+    parsed_url final_url;
+    if (!prerender_take(target, &ready, &final_url, download_assets)) return 0;
+
+    TRACE_SCOPE("navigate.prerendered");
+    printf("showing prerendered page\n");
+    leave_document(*tree, *scroll_y);
+    malloc_trim(0);
+    *tree = ready;
+    *scroll_y = 0;
+    *focused_node = NULL;
+    url_format(&final_url, url_buffer, MAX_URL);
+    history_commit(url_buffer, 0);
+    enter_document(url_buffer, 0);
+
+    TRACE_BEGIN("images");
+    load_images(*tree, url_buffer, download_assets);
+    TRACE_END("images");
+    enforce_memory_budget(*tree, 0);
+    return 1;
+}
+
+void go_history(int delta, char *url_buffer, dom_node **tree, int make_temp, int *scroll_y, dom_node **focused_node, int download_assets) {
+    if (!history_can_go(delta)) return;
+    TRACE_SCOPE("navigate.history");
+    leave_document(*tree, *scroll_y);
+    *tree = NULL;
+    *focused_node = NULL;
+
+    history_entry *entry = history_go(delta);
+    strncpy(url_buffer, entry->url, MAX_URL - 1);
+    url_buffer[MAX_URL - 1] = '\0';
+
+    if (entry->tree) {
+        printf("restored %s from back/forward cache\n", entry->url);
+        *tree = entry->tree;
+        *scroll_y = entry->scroll_y;
+        entry->tree = NULL;
+        enter_document(entry->url, 0);
+        load_images(*tree, url_buffer, download_assets);
+        entry->textures_dropped = 0;
+        return;
+    }
+
+    int restore_scroll = entry->scroll_y;
+    history_traversing = 1;
+    load_url(url_buffer, tree, make_temp, scroll_y, focused_node, download_assets);
+    history_traversing = 0;
+    *scroll_y = restore_scroll;
+}
+
 int check_click(dom_node *node, int mx, int my, char *url_buffer, dom_node **tree, int make_temp, int *scroll_y, dom_node **focused_node, int download_assets) {
     if (!node) return 0;
 
@@ -109,7 +303,8 @@ int check_click(dom_node *node, int mx, int my, char *url_buffer, dom_node **tre
                 printf("scrolling to fragment: %s\n", node->href);
                 dom_node *target = find_element_by_id(*tree, node->href + 1);
                 if (target) {
-                    *scroll_y = target->layout.y > 40 ? target->layout.y - 40 : 0;
+                    int target_y = layout_target_y(*tree, target);
+                    *scroll_y = target_y > 40 ? target_y - 40 : 0;
                 } else {
                     printf("fragment not found in dom\n");
                 }
@@ -121,52 +316,14 @@ int check_click(dom_node *node, int mx, int my, char *url_buffer, dom_node **tre
                 return 1;
             }
 
-            char *target_url = calloc(1, MAX_URL * 3);
-            if (strncmp(node->href, "http://", 7) == 0 || strncmp(node->href, "https://", 8) == 0) {
-                strncpy(target_url, node->href, (MAX_URL * 3) - 1);
-            } else if (strncmp(node->href, "//", 2) == 0) {
-                snprintf(target_url, MAX_URL * 3, "https:%s", node->href);
-            } else if (node->href[0] == '/') {
-                char *current_host = calloc(1, MAX_URL);
-                const char *start = url_buffer;
-                if (strncmp(start, "http://", 7) == 0) start += 7;
-                    else if (strncmp(start, "https://", 8) == 0) start += 8;
-
-                        char *p_delim = strpbrk(start, "/?");
-                if (p_delim) {
-                    size_t hlen = p_delim - url_buffer;
-                    if (hlen >= MAX_URL) hlen = MAX_URL - 1;
-                    strncpy(current_host, url_buffer, hlen);
-                } else {
-                    strncpy(current_host, url_buffer, MAX_URL - 1);
-                }
-                snprintf(target_url, MAX_URL * 3, "%s%s", current_host, node->href);
-                free(current_host);
-            } else {
-                char *base_url = calloc(1, MAX_URL);
-                strncpy(base_url, url_buffer, MAX_URL - 1);
-                char *p_delim = strpbrk(base_url + (strncmp(base_url, "http", 4) == 0 ? 8 : 0), "?");
-                if (p_delim) *p_delim = '\0';
-
-                char *last_slash = strrchr(base_url, '/');
-                char *colon = strchr(base_url, ':');
-
-                if (last_slash && colon && last_slash > colon + 2) {
-                    *(last_slash + 1) = '\0';
-                } else if (last_slash && !colon) {
-                    *(last_slash + 1) = '\0';
-                } else if (!last_slash) {
-                    strcat(base_url, "/");
-                }
-
-                snprintf(target_url, MAX_URL * 3, "%s%s", base_url, node->href);
-                free(base_url);
+            parsed_url base, target;
+            if (url_parse(url_buffer, &base) != 0 || url_resolve(&base, node->href, &target) != 0) {
+                printf("could not resolve link\n");
+                return 1;
             }
+            url_format(&target, url_buffer, MAX_URL);
 
-            strncpy(url_buffer, target_url, MAX_URL - 1);
-            url_buffer[MAX_URL - 1] = '\0';
-            free(target_url);
-
+            if (show_prerendered(&target, url_buffer, tree, scroll_y, focused_node, download_assets)) return 1;
             load_url(url_buffer, tree, make_temp, scroll_y, focused_node, download_assets);
             return 1;
         }
@@ -198,127 +355,139 @@ int check_click(dom_node *node, int mx, int my, char *url_buffer, dom_node **tre
     return 0;
 }
 
+typedef struct {
+    http_body body;
+    const parsed_url *url;
+    preload_scanner *scanner;
+} document_sink;
+
+static int document_headers(const http_response *resp, void *user) {
+    document_sink *doc = user;
+    if (!doc->scanner && resp->status < 300) doc->scanner = preload_scanner_new(doc->url);
+    return http_body_headers(resp, &doc->body);
+}
+
+static int document_data(const char *data, size_t len, void *user) {
+    document_sink *doc = user;
+    if (doc->scanner) preload_scanner_feed(doc->scanner, data, len);
+    return http_body_append(data, len, &doc->body);
+}
+
+static void show_document(const char *body, size_t length, const parsed_url *target, const parsed_url *final_url, long lifetime, char *url_buffer, dom_node **tree, int make_temp, int previous_scroll, int download_assets) {
+    if (memcmp(final_url, target, sizeof(parsed_url)) != 0) {
+        url_format(final_url, url_buffer, MAX_URL);
+    }
+
+    char document_url[MAX_URL] = {0};
+    url_format(final_url, document_url, sizeof(document_url));
+
+    leave_document(*tree, previous_scroll);
+    *tree = NULL;
+    malloc_trim(0);
+    *tree = process_document(body, length, document_url, make_temp);
+    history_commit(url_buffer, history_traversing);
+    enter_document(document_url, lifetime);
+    if (*tree) {
+        char base_url[MAX_URL] = {0};
+        url_origin(final_url, base_url, sizeof(base_url));
+        printf("applying css styles...\n");
+        TRACE_BEGIN("css");
+        process_css(*tree, base_url, download_assets);
+        TRACE_END("css");
+        printf("downloading inline images...\n");
+        TRACE_BEGIN("images");
+        load_images(*tree, document_url, download_assets);
+        TRACE_END("images");
+        enforce_memory_budget(*tree, 0);
+    }
+}
+
 void load_url(char *url_buffer, dom_node **tree, int make_temp, int *scroll_y, dom_node **focused_node, int download_assets) {
+    TRACE_SCOPE("navigate");
+    int previous_scroll = scroll_y ? *scroll_y : 0;
     if (scroll_y) *scroll_y = 0;
     if (focused_node) *focused_node = NULL;
+    finish_archive();
+    preload_clear();
 
-    int redirect_count = 0;
-    while (redirect_count < 5) {
-        char hostname[MAX_URL] = {0};
-        char path[MAX_URL] = {0};
-        const char *port = "80";
-
-        const char *url_start = url_buffer;
-        if (strncmp(url_start, "http://", 7) == 0) {
-            url_start += 7;
-        } else if (strncmp(url_start, "https://", 8) == 0) {
-            url_start += 8;
-            port = "443";
-        }
+    parsed_url target;
+    if (url_parse(url_buffer, &target) != 0) {
+        printf("could not parse url: %s\n", url_buffer);
+        return;
+    }
 
-        char *p_delim = strpbrk(url_start, "/?");
-        if (p_delim) {
-            size_t len = p_delim - url_start;
-            if (len >= MAX_URL) len = MAX_URL - 1;
-            strncpy(hostname, url_start, len);
-            hostname[len] = '\0';
-
-            if (*p_delim == '?') {
-                path[0] = '/';
-                strncpy(path + 1, p_delim, MAX_URL - 2);
-            } else {
-                strncpy(path, p_delim, MAX_URL - 1);
-            }
-            path[MAX_URL - 1] = '\0';
-        } else {
-            strncpy(hostname, url_start, MAX_URL - 1);
-            hostname[MAX_URL - 1] = '\0';
-            strcpy(path, "/");
-        }
+    char key[MAX_URL];
+    char snap_path[1024];
+    snapshot_header header;
+    snapshot_doc snap;
+    url_format(&target, key, sizeof(key));
+    snapshot_path(key, snap_path, sizeof(snap_path));
+    if (snapshot_read_header(snap_path, &header) == 0 && header.expires > time(NULL) && snapshot_load(snap_path, &snap) == 0) {
+        printf("warm reload of %s from snapshot\n", key);
+        leave_document(*tree, previous_scroll);
+        *tree = NULL;
+        history_commit(snap.url, history_traversing);
+        enter_document(snap.url, (long)(header.expires - time(NULL)));
+        show_snapshot(&snap, url_buffer, tree, download_assets);
+        return;
+    }
 
-        printf("fetching %s%s...\n", hostname, path);
-        size_t data_size = 0;
-        char *raw_data = fetch_html(hostname, port, path, &data_size);
-
-        if (raw_data != NULL) {
-            int is_redirect = 0;
-            if (strncmp(raw_data, "HTTP/", 5) == 0) {
-                char *space = strchr(raw_data, ' ');
-                if (space) {
-                    int status = atoi(space + 1);
-                    if (status >= 300 && status < 400) {
-                        char *loc = strstr(raw_data, "\r\nLocation: ");
-                        if (!loc) loc = strstr(raw_data, "\r\nlocation: ");
-                        if (!loc) loc = strstr(raw_data, "\nLocation: ");
-                        if (loc) {
-                            loc = strchr(loc, ':') + 1;
-                            while (*loc == ' ') loc++;
-                            char *end = strstr(loc, "\r\n");
-                            if (!end) end = strchr(loc, '\n');
-
-                            if (end) {
-                                char new_target[MAX_URL] = {0};
-                                size_t cplen = end - loc;
-                                if (cplen >= MAX_URL) cplen = MAX_URL - 1;
-                                strncpy(new_target, loc, cplen);
-
-                                printf("redirected to: %s\n", new_target);
-                                free(raw_data);
-                                redirect_count++;
-                                is_redirect = 1;
-
-                                char *new_url = calloc(1, MAX_URL * 3);
-                                if (new_target[0] == '/') {
-                                    snprintf(new_url, MAX_URL * 3, "%s://%s%s", strcmp(port, "443") == 0 ? "https" : "http", hostname, new_target);
-                                } else if (strncmp(new_target, "//", 2) == 0) {
-                                    snprintf(new_url, MAX_URL * 3, "https:%s", new_target);
-                                } else {
-                                    strncpy(new_url, new_target, (MAX_URL * 3) - 1);
-                                }
-
-                                strncpy(url_buffer, new_url, MAX_URL - 1);
-                                url_buffer[MAX_URL - 1] = '\0';
-                                free(new_url);
-                            }
-                        }
-                    }
-                }
-            }
+    offline_resource local;
+    if (offline_open(&target, &local) == 0) {
+        printf("loading %s from disk...\n", key);
+        show_document(local.data, local.len, &target, &local.url, -1, url_buffer, tree, make_temp, previous_scroll, download_assets);
+        document_archive = offline_keep_mount(&local);
+        offline_release(&local);
+        return;
+    }
+    if (url_is_file(&target)) {
+        printf("could not open %s\n", key);
+        return;
+    }
 
-            if (!is_redirect) {
-                if (*tree) {
-                    free_textures(*tree);
-                    free_tree(*tree);
-                    *tree = NULL;
-                }
-                *tree = process_response(raw_data, data_size, make_temp);
-                if (*tree) {
-                    char base_url[MAX_URL] = {0};
-                    snprintf(base_url, sizeof(base_url), "%s://%s", strcmp(port, "443") == 0 ? "https" : "http", hostname);
-                    printf("applying css styles...\n");
-                    process_css(*tree, base_url, download_assets);
-                    printf("downloading inline images...\n");
-                    load_images(*tree, base_url, download_assets);
-                }
-                free(raw_data);
-                break;
-            }
-        } else {
-            printf("failed to fetch website data\n");
-            break;
+    printf("fetching %s%s...\n", target.host, target.path);
+    const char *archive_path = archive_record_path();
+    if (archive_path) archive_record_begin();
+    http_response resp;
+    parsed_url final_url;
+    document_sink doc = { {0}, &final_url, NULL };
+    http_sink sink = { document_headers, document_data, &doc };
+
+    if (http_fetch_url(&target, &resp, &sink, &final_url) == 0) {
+        memstat_add(MEM_RESPONSE, doc.body.cap);
+        if (doc.scanner) printf("preload scanner found %d subresources\n", preload_scanner_found(doc.scanner));
+        show_document(doc.body.data ? doc.body.data : "", doc.body.len, &target, &final_url, http_freshness_lifetime(&resp), url_buffer, tree, make_temp, previous_scroll, download_assets);
+        memstat_sub(MEM_RESPONSE, doc.body.cap);
+        if (archive_path) {
+            url_format(&final_url, archive_pending_url, sizeof(archive_pending_url));
+            archive_pending_path = archive_path;
+            archive_pending_tree = *tree;
+            poll_archive(*tree);
         }
+    } else {
+        printf("failed to fetch website data\n");
+        if (archive_path) archive_record_end("", archive_path);
     }
+    if (doc.scanner) preload_scanner_free(doc.scanner);
+    http_response_free(&resp);
+    http_body_free(&doc.body);
 }
 
-int main() {
+int main(int argc, char **argv) {
     int make_temp = 1;
     int download_assets = 1;
 
     char url_buffer[MAX_URL] = "en.wikipedia.org/wiki/Donkey_Kong_(character)";
+    if (argc > 1) {
+        strncpy(url_buffer, argv[1], MAX_URL - 1);
+        url_buffer[MAX_URL - 1] = '\0';
+    }
     dom_node *tree = NULL;
     int scroll_y = 0;
     dom_node *focused_node = NULL;
 
+    signal(SIGPIPE, SIG_IGN);
+    set_url_attribute_hook(dns_prefetch_url);
     printf("starting browser process...\n");
     if (init_renderer() != 0) {
         printf("fatal error: could not spin up the visual engine. exiting.\n");
@@ -326,20 +495,42 @@ int main() {
     }
 
     SDL_PumpEvents();
-    render_tree(NULL, "loading...", 0, NULL);
+    render_tree(NULL, "loading...", NULL, NULL);
 
-    load_url(url_buffer, &tree, make_temp, &scroll_y, &focused_node, download_assets);
+    if (argc > 1 || !restore_session(url_buffer, &tree, &scroll_y, download_assets)) {
+        load_url(url_buffer, &tree, make_temp, &scroll_y, &focused_node, download_assets);
+    }
 
     int running = 1;
     SDL_Event event;
     SDL_StartTextInput();
 
+    int prerender_enabled = prerender_get_mode() != PRERENDER_OFF;
+    double upload_budget = image_upload_budget_ms();
+    dom_node *hovered_link = NULL;
+    Uint32 hover_start = 0;
+    int hover_requested = 0;
+
     while (running) {
+        uint64_t frame_start = trace_now_ns();
+        TRACE_BEGIN("frame");
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT) {
                 running = 0;
+            } else if (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                set_viewport(event.window.data1, event.window.data2);
+            } else if (event.type == SDL_MOUSEMOTION && prerender_enabled) {
+                dom_node *link = event.motion.y > 40 ? find_link_at(tree, event.motion.x, event.motion.y + scroll_y) : NULL;
+                if (link != hovered_link) {
+                    hovered_link = link;
+                    hover_start = SDL_GetTicks();
+                    hover_requested = 0;
+                }
             } else if (event.type == SDL_MOUSEBUTTONDOWN) {
-                if (event.button.button == SDL_BUTTON_LEFT) {
+                hovered_link = NULL;
+                if (event.button.button == SDL_BUTTON_X1 || event.button.button == SDL_BUTTON_X2) {
+                    go_history(event.button.button == SDL_BUTTON_X1 ? -1 : 1, url_buffer, &tree, make_temp, &scroll_y, &focused_node, download_assets);
+                } else if (event.button.button == SDL_BUTTON_LEFT) {
                     if (event.button.y > 40) {
                         focused_node = NULL;
                         check_click(tree, event.button.x, event.button.y, url_buffer, &tree, make_temp, &scroll_y, &focused_node, download_assets);
@@ -353,12 +544,8 @@ int main() {
             } else if (event.type == SDL_TEXTINPUT) {
                 if (focused_node) {
                     const char *val = get_attribute(focused_node, "value");
-                    char new_val[MAX_URL] = {0};
-                    if (val) strncpy(new_val, val, sizeof(new_val) - 2);
-                    if (strlen(new_val) + strlen(event.text.text) < sizeof(new_val) - 1) {
-                        strcat(new_val, event.text.text);
-                        set_attribute(focused_node, "value", new_val);
-                    }
+                    size_t len = val ? strlen(val) : 0;
+                    if (len + strlen(event.text.text) < MAX_URL - 1) edit_attribute(focused_node, "value", len, event.text.text);
                 } else {
                     if (strlen(url_buffer) + strlen(event.text.text) < sizeof(url_buffer) - 1) {
                         strcat(url_buffer, event.text.text);
@@ -368,21 +555,22 @@ int main() {
                 if (event.key.keysym.sym == SDLK_BACKSPACE) {
                     if (focused_node) {
                         const char *val = get_attribute(focused_node, "value");
-                        if (val && strlen(val) > 0) {
-                            char new_val[MAX_URL] = {0};
-                            strncpy(new_val, val, MAX_URL - 1);
-                            new_val[strlen(new_val) - 1] = '\0';
-                            set_attribute(focused_node, "value", new_val);
-                        }
+                        if (val && strlen(val) > 0) edit_attribute(focused_node, "value", strlen(val) - 1, NULL);
                     } else if (strlen(url_buffer) > 0) {
                         url_buffer[strlen(url_buffer) - 1] = '\0';
                     }
                 } else if (event.key.keysym.sym == SDLK_RETURN) {
+                    hovered_link = NULL;
                     if (focused_node) {
                         submit_form(focused_node, url_buffer, &tree, make_temp, &scroll_y, &focused_node, download_assets);
                     } else {
                         load_url(url_buffer, &tree, make_temp, &scroll_y, &focused_node, download_assets);
                     }
+                } else if ((event.key.keysym.mod & KMOD_ALT) && (event.key.keysym.sym == SDLK_LEFT || event.key.keysym.sym == SDLK_RIGHT)) {
+                    hovered_link = NULL;
+                    go_history(event.key.keysym.sym == SDLK_LEFT ? -1 : 1, url_buffer, &tree, make_temp, &scroll_y, &focused_node, download_assets);
+                } else if (event.key.keysym.sym == SDLK_F12) {
+                    set_hud_visible(!is_hud_visible());
                 } else if (event.key.keysym.sym == SDLK_DOWN) {
                     scroll_y += 30;
                 } else if (event.key.keysym.sym == SDLK_UP) {
@@ -392,16 +580,44 @@ int main() {
             }
         }
 
-        render_tree(tree, url_buffer, scroll_y, focused_node);
+        if (hovered_link && !hover_requested && SDL_GetTicks() - hover_start >= (Uint32)prerender_dwell_ms()) {
+            prefetch_link(hovered_link, url_buffer);
+            hover_requested = 1;
+        }
+        if (prerender_enabled) prerender_poll(download_assets);
+        if (upload_images(tree, upload_budget) > 0) enforce_memory_budget(tree, scroll_y);
+        poll_archive(tree);
+
+        render_tree(tree, url_buffer, &scroll_y, focused_node);
+        TRACE_END("frame");
+        frame_stats_add((trace_now_ns() - frame_start) / 1e6);
         SDL_Delay(16);
     }
 
     printf("cleaning up and exiting...\n");
+    const char *trace_path = getenv("BROWSER_TRACE");
+    if (trace_path) {
+        if (trace_export(trace_path) == 0) printf("wrote trace to %s\n", trace_path);
+        else printf("could not write trace to %s\n", trace_path);
+    }
+    save_session(tree, scroll_y);
+    finish_archive();
+    image_pool_cancel(tree);
     if (tree) {
         free_textures(tree);
         free_tree(tree);
     }
+    history_clear();
     SDL_StopTextInput();
+    prerender_shutdown();
+    image_pool_shutdown();
+    tree_pool_shutdown();
+    preload_shutdown();
+    archive_release_mount(document_archive);
+    archive_unmount_all();
+    dump_shutdown();
+    http_close_idle();
+    dns_shutdown();
     cleanup_renderer();
 
     return 0;
@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "memstat.h"
+#include "styledecl.h"
+
+static size_t live_bytes[MEM_CATEGORY_COUNT];
+static mem_budget budget;
+static int budget_loaded = 0;
+
+static const char *category_names[MEM_CATEGORY_COUNT] = {
+    "mem.dom_nodes", "mem.attributes", "mem.styles", "mem.text",
+    "mem.response", "mem.textures"
+};
+
+void memstat_add(mem_category cat, size_t bytes) {
+    __atomic_fetch_add(&live_bytes[cat], bytes, __ATOMIC_RELAXED);
+}
+
+void memstat_sub(mem_category cat, size_t bytes) {
+    __atomic_fetch_sub(&live_bytes[cat], bytes, __ATOMIC_RELAXED);
+}
+
+static size_t str_bytes(const char *s) {
+    return s ? strlen(s) + 1 : 0;
+}
+
+static void measure_node(dom_node *node, mem_stats *out) {
+    out->bytes[MEM_DOM_NODES] += sizeof(dom_node) + sizeof(dom_node*) * node->child_capacity;
+    out->bytes[MEM_TEXT] += str_bytes(node->tag) + str_bytes(node->text);
+
+    out->bytes[MEM_ATTRIBUTES] += sizeof(dom_attr) * node->attr_capacity;
+    out->bytes[MEM_ATTRIBUTES] += str_bytes(node->href) + str_bytes(node->src);
+    for (int i = 0; i < node->attr_count; i++) {
+        out->bytes[MEM_ATTRIBUTES] += str_bytes(node->attributes[i].name) + str_bytes(node->attributes[i].value);
+    }
+
+    out->bytes[MEM_STYLES] += sizeof(css_prop) * node->style_capacity;
+    for (int i = 0; i < node->style_count; i++) {
+        out->bytes[MEM_STYLES] += str_bytes(node->styles[i].name) + str_bytes(node->styles[i].value);
+    }
+    if (node->inline_style) {
+        int refs = __atomic_load_n(&node->inline_style->refs, __ATOMIC_RELAXED);
+        out->bytes[MEM_STYLES] += style_decls_bytes(node->inline_style) / (refs > 0 ? refs : 1);
+    }
+
+    if (node->texture) {
+        out->bytes[MEM_TEXTURES] += (size_t)node->tex_w * node->tex_h * 4;
+    }
+
+    for (int i = 0; i < node->child_count; i++) {
+        measure_node(node->children[i], out);
+    }
+}
+
+void memstat_measure_tree(dom_node *root, mem_stats *out) {
+    memset(out, 0, sizeof(*out));
+    if (root) measure_node(root, out);
+    out->bytes[MEM_RESPONSE] = __atomic_load_n(&live_bytes[MEM_RESPONSE], __ATOMIC_RELAXED);
+}
+
+size_t memstat_total(const mem_stats *stats) {
+    size_t total = 0;
+    for (int i = 0; i < MEM_CATEGORY_COUNT; i++) total += stats->bytes[i];
+    return total;
+}
+
+size_t memstat_rss() {
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+    unsigned long pages_total = 0, pages_resident = 0;
+    int got = fscanf(f, "%lu %lu", &pages_total, &pages_resident);
+    fclose(f);
+    if (got != 2) return 0;
+    return (size_t)pages_resident * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+const char* memstat_category_name(mem_category cat) {
+    if (cat < 0 || cat >= MEM_CATEGORY_COUNT) return "mem.unknown";
+    return category_names[cat];
+}
+
+static size_t env_megabytes(const char *name, size_t def) {
+    const char *val = getenv(name);
+    if (!val || atol(val) <= 0) return def;
+    return (size_t)atol(val) * 1024 * 1024;
+}
+
+const mem_budget* memstat_budget() {
+    if (!budget_loaded) {
+        budget.document_bytes = env_megabytes("BROWSER_DOC_BUDGET_MB", (size_t)512 * 1024 * 1024);
+        budget.texture_bytes = env_megabytes("BROWSER_TEXTURE_BUDGET_MB", (size_t)256 * 1024 * 1024);
+        budget.image_bytes = env_megabytes("BROWSER_IMAGE_LIMIT_MB", (size_t)64 * 1024 * 1024);
+        budget.bfcache_bytes = env_megabytes("BROWSER_BFCACHE_MB", (size_t)128 * 1024 * 1024);
+        budget_loaded = 1;
+    }
+    return &budget;
+}
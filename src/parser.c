@@ -3,37 +3,195 @@
 #include <string.h>
 #include <ctype.h>
 #include "dom.h"
+#include "scan.h"
+#include "entities.h"
+#include "styledecl.h"
+
+#define DECODED_CAP(len) ((len) + (len) / 4 + 1)
+
+static void (*url_attribute_hook)(const char *url) = NULL;
+
+static const unsigned short windows_1252[32] = {
+    0x20AC, 0x81, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x8D, 0x017D, 0x8F,
+    0x90, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x9D, 0x017E, 0x0178
+};
+
+static size_t encode_utf8(unsigned long cp, char *out) {
+    if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) cp = 0xFFFD;
+    if (cp >= 0x80 && cp <= 0x9F) cp = windows_1252[cp - 0x80];
+
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+static size_t decode_numeric(const char **pp, const char *end, char *out) {
+    const char *p = *pp + 2;
+    int hex = (p < end && (*p == 'x' || *p == 'X'));
+    if (hex) p++;
+
+    const char *digits = p;
+    unsigned long cp = 0;
+    while (p < end && (hex ? isxdigit((unsigned char)*p) : isdigit((unsigned char)*p))) {
+        int d = isdigit((unsigned char)*p) ? *p - '0' : (tolower((unsigned char)*p) - 'a' + 10);
+        if (cp <= 0x10FFFF) cp = cp * (hex ? 16 : 10) + d;
+        p++;
+    }
+    if (p == digits) {
+        out[0] = '&';
+        *pp += 1;
+        return 1;
+    }
+    if (p < end && *p == ';') p++;
+    *pp = p;
+    return encode_utf8(cp, out);
+}
+
+static size_t decode_entity(const char **pp, const char *end, char *out, int in_attribute) {
+    const char *p = *pp;
+    if (p + 1 < end && p[1] == '#') return decode_numeric(pp, end, out);
+
+    const char *name = p + 1;
+    const char *q = name;
+    while (q < end && q - name < ENTITY_MAX_NAME && isalnum((unsigned char)*q)) q++;
+    size_t len = q - name;
+    size_t value_len = 0;
+    const char *value = NULL;
+
+    if (len > 0 && q < end && *q == ';') {
+        if (len == 4 && memcmp(name, "nbsp", 4) == 0) {
+            out[0] = ' ';
+            *pp = q + 1;
+            return 1;
+        }
+        value = entity_lookup(name, len + 1, &value_len);
+        if (value) {
+            memcpy(out, value, value_len);
+            *pp = q + 1;
+            return value_len;
+        }
+    }
+
+    for (size_t n = len < ENTITY_MAX_LEGACY ? len : ENTITY_MAX_LEGACY; n >= 2; n--) {
+        value = entity_lookup(name, n, &value_len);
+        if (!value) continue;
+        const char *after = name + n;
+        if (in_attribute && after < end && (*after == '=' || isalnum((unsigned char)*after))) break;
+        if (n == 4 && memcmp(name, "nbsp", 4) == 0) {
+            out[0] = ' ';
+            value_len = 1;
+        } else {
+            memcpy(out, value, value_len);
+        }
+        *pp = after;
+        return value_len;
+    }
+
+    out[0] = '&';
+    *pp += 1;
+    return 1;
+}
 
 void decode_html_entities(char *str) {
-    char *read = str;
     char *write = str;
-    while (*read) {
-        if (*read == '&') {
-            if (strncmp(read, "&nbsp;", 6) == 0) { *write++ = ' '; read += 6; }
-            else if (strncmp(read, "&amp;", 5) == 0) { *write++ = '&'; read += 5; }
-            else if (strncmp(read, "&lt;", 4) == 0) { *write++ = '<'; read += 4; }
-            else if (strncmp(read, "&gt;", 4) == 0) { *write++ = '>'; read += 4; }
-            else if (strncmp(read, "&quot;", 6) == 0) { *write++ = '"'; read += 6; }
-            else if (strncmp(read, "&copy;", 6) == 0) { *write++ = '\xC2'; *write++ = '\xA9'; read += 6; }
-            else if (strncmp(read, "&raquo;", 7) == 0) { *write++ = '\xC2'; *write++ = '\xBB'; read += 7; }
-            else if (strncmp(read, "&laquo;", 7) == 0) { *write++ = '\xC2'; *write++ = '\xAB'; read += 7; }
-            else if (strncmp(read, "&#39;", 5) == 0) { *write++ = '\''; read += 5; }
-            else { *write++ = *read++; }
-        } else {
-            *write++ = *read++;
+    const char *read = str;
+    const char *end = str + strlen(str);
+    char ent[8];
+    while (read < end) {
+        const char *amp = memchr(read, '&', end - read);
+        if (!amp) amp = end;
+        if (write != read) memmove(write, read, amp - read);
+        write += amp - read;
+        read = amp;
+        if (read < end) {
+            const char *start = read;
+            size_t n = decode_entity(&read, end, ent, 0);
+            if (n > (size_t)(read - start)) {
+                n = read - start;
+                memcpy(ent, start, n);
+            }
+            memcpy(write, ent, n);
+            write += n;
         }
     }
     *write = '\0';
 }
 
-dom_node* create_element(const char *tag, dom_node *parent) {
+static size_t collapse_text(const char *p, const char *end, char *out, int *out_blank) {
+    size_t w = 0;
+    int in_space = 0;
+    int blank = 1;
+
+    while (p < end) {
+        const char *q = scan_text_special(p, end);
+        if (q > p) {
+            size_t run = q - p;
+            memcpy(out + w, p, run);
+            w += run;
+            if (run > 1 || *p != ' ') blank = 0;
+            in_space = (q[-1] == ' ');
+            p = q;
+        }
+        if (p >= end) break;
+
+        if (*p == '&') {
+            w += decode_entity(&p, end, out + w, 0);
+            blank = 0;
+            in_space = 0;
+        } else {
+            while (p < end && scan_is_space((unsigned char)*p)) p++;
+            if (!in_space) {
+                out[w++] = ' ';
+                in_space = 1;
+            }
+        }
+    }
+    out[w] = '\0';
+    *out_blank = blank;
+    return w;
+}
+
+static char* decode_slice(const char *p, const char *end) {
+    char *out = malloc(DECODED_CAP(end - p));
+    size_t w = 0;
+    while (p < end) {
+        const char *amp = memchr(p, '&', end - p);
+        if (!amp) amp = end;
+        memcpy(out + w, p, amp - p);
+        w += amp - p;
+        p = amp;
+        if (p < end) w += decode_entity(&p, end, out + w, 1);
+    }
+    out[w] = '\0';
+    return out;
+}
+
+dom_node* create_element_n(const char *tag, size_t len, dom_node *parent) {
     dom_node *node = calloc(1, sizeof(dom_node));
     node->type = NODE_ELEMENT;
 
-    char *tag_lower = strdup(tag);
-    for(int i = 0; tag_lower[i]; i++) {
-        tag_lower[i] = tolower((unsigned char)tag_lower[i]);
+    char *tag_lower = malloc(len + 1);
+    for (size_t i = 0; i < len; i++) {
+        tag_lower[i] = tolower((unsigned char)tag[i]);
     }
+    tag_lower[len] = '\0';
     node->tag = tag_lower;
 
     node->parent = parent;
@@ -46,52 +204,118 @@ dom_node* create_element(const char *tag, dom_node *parent) {
     return node;
 }
 
-dom_node* create_text_node(const char *text, dom_node *parent) {
+dom_node* create_element(const char *tag, dom_node *parent) {
+    return create_element_n(tag, strlen(tag), parent);
+}
+
+static dom_node* new_text_node(char *text, dom_node *parent) {
     dom_node *node = calloc(1, sizeof(dom_node));
     node->type = NODE_TEXT;
-    node->text = strdup(text);
+    node->text = text;
     node->parent = parent;
     return node;
 }
 
+dom_node* create_text_node(const char *text, dom_node *parent) {
+    return new_text_node(strdup(text), parent);
+}
+
 void add_child(dom_node *parent, dom_node *child) {
     if (parent->child_count >= parent->child_capacity) {
         parent->child_capacity *= 2;
         parent->children = realloc(parent->children, sizeof(dom_node*) * parent->child_capacity);
     }
     parent->children[parent->child_count++] = child;
+    mark_dirty(parent, DIRTY_CHILD);
 }
 
-void add_attribute(dom_node *node, const char *name, const char *value) {
+void mark_dirty(dom_node *node, unsigned flags) {
+    if (!node) return;
+    node->dirty |= flags;
+    if (!(flags & (DIRTY_STYLE | DIRTY_LAYOUT | DIRTY_CHILD))) return;
+    for (dom_node *p = node->parent; p && !(__atomic_load_n(&p->dirty, __ATOMIC_RELAXED) & DIRTY_CHILD); p = p->parent) {
+        __atomic_fetch_or(&p->dirty, DIRTY_CHILD, __ATOMIC_RELAXED);
+    }
+}
+
+static unsigned attribute_dirt(const char *name) {
+    if (strcasecmp(name, "class") == 0 || strcasecmp(name, "id") == 0 || strcasecmp(name, "style") == 0) return DIRTY_STYLE | DIRTY_LAYOUT;
+    return DIRTY_LAYOUT;
+}
+
+static void drop_inline_style(dom_node *node, const char *name) {
+    if (!node->inline_style || strcasecmp(name, "style") != 0) return;
+    style_decls_release(node->inline_style);
+    node->inline_style = NULL;
+}
+
+static unsigned style_dirt(const char *name) {
+    if (strcasecmp(name, "color") == 0 || strcasecmp(name, "background") == 0 || strcasecmp(name, "background-color") == 0 || strcasecmp(name, "border") == 0) return DIRTY_PAINT;
+    return DIRTY_LAYOUT;
+}
+
+static void append_attribute(dom_node *node, char *name, char *value) {
     if (node->attr_count >= node->attr_capacity) {
         node->attr_capacity *= 2;
         node->attributes = realloc(node->attributes, sizeof(dom_attr) * node->attr_capacity);
     }
-    node->attributes[node->attr_count].name = strdup(name);
-    node->attributes[node->attr_count].value = value ? strdup(value) : NULL;
+    node->attributes[node->attr_count].name = name;
+    node->attributes[node->attr_count].value = value;
 
     if (strcasecmp(name, "href") == 0 && value) {
         node->href = strdup(value);
+        if (url_attribute_hook) url_attribute_hook(value);
     }
     if (strcasecmp(name, "src") == 0 && value) {
         node->src = strdup(value);
+        if (url_attribute_hook) url_attribute_hook(value);
     }
 
     node->attr_count++;
 }
 
+void set_url_attribute_hook(void (*hook)(const char *url)) {
+    url_attribute_hook = hook;
+}
+
+void add_attribute(dom_node *node, const char *name, const char *value) {
+    append_attribute(node, strdup(name), value ? strdup(value) : NULL);
+}
+
 void set_attribute(dom_node *node, const char *name, const char *value) {
     if (!node || !name) return;
+    mark_dirty(node, attribute_dirt(name));
     for (int i = 0; i < node->attr_count; i++) {
         if (node->attributes[i].name && strcasecmp(node->attributes[i].name, name) == 0) {
             if (node->attributes[i].value) free(node->attributes[i].value);
             node->attributes[i].value = value ? strdup(value) : NULL;
+            drop_inline_style(node, name);
             return;
         }
     }
     add_attribute(node, name, value);
 }
 
+void edit_attribute(dom_node *node, const char *name, size_t keep, const char *append) {
+    if (!node || !name) return;
+    size_t extra = append ? strlen(append) : 0;
+    for (int i = 0; i < node->attr_count; i++) {
+        dom_attr *attr = &node->attributes[i];
+        if (!attr->name || strcasecmp(attr->name, name) != 0) continue;
+        size_t len = attr->value ? strlen(attr->value) : 0;
+        if (keep > len) keep = len;
+        char *value = realloc(attr->value, keep + extra + 1);
+        if (!value) return;
+        memcpy(value + keep, append ? append : "", extra);
+        value[keep + extra] = '\0';
+        attr->value = value;
+        drop_inline_style(node, name);
+        mark_dirty(node, attribute_dirt(name));
+        return;
+    }
+    set_attribute(node, name, append ? append : "");
+}
+
 const char* get_attribute(dom_node *node, const char *name) {
     if (!node || !node->attributes) return NULL;
     for (int i = 0; i < node->attr_count; i++) {
@@ -104,6 +328,7 @@ const char* get_attribute(dom_node *node, const char *name) {
 
 void set_style(dom_node *node, const char *name, const char *value) {
     if (!node || !name || !value) return;
+    mark_dirty(node, style_dirt(name));
     for (int i = 0; i < node->style_count; i++) {
         if (strcasecmp(node->styles[i].name, name) == 0) {
             free(node->styles[i].value);
@@ -130,155 +355,156 @@ const char* get_style(dom_node *node, const char *name) {
     return NULL;
 }
 
-void parse_attributes(dom_node *node, char *str) {
-    while (*str) {
-        while (*str && isspace((unsigned char)*str)) str++;
-        if (!*str) break;
-
-        char *name_start = str;
-        while (*str && *str != '=' && !isspace((unsigned char)*str) && *str != '>') str++;
-
-        char *name_end = str;
-        char *val_start = NULL;
-
-        if (*str == '=') {
-            *name_end = '\0';
-            str++;
-            char quote = *str;
-            if (quote == '"' || quote == '\'') {
-                str++;
-                val_start = str;
-                while (*str && *str != quote) str++;
-                if (*str) {
-                    *str = '\0';
-                    str++;
-                }
+void clear_styles(dom_node *node) {
+    if (!node) return;
+    if (node->style_count > 0) mark_dirty(node, DIRTY_STYLE | DIRTY_LAYOUT);
+    for (int i = 0; i < node->style_count; i++) {
+        if (node->styles[i].name) free(node->styles[i].name);
+        if (node->styles[i].value) free(node->styles[i].value);
+    }
+    node->style_count = 0;
+}
+
+void copy_styles(dom_node *node, const dom_node *from) {
+    if (!node || !from || node == from) return;
+    clear_styles(node);
+    if (from->style_count == 0) return;
+    if (node->style_capacity < from->style_count) {
+        node->style_capacity = from->style_count;
+        node->styles = realloc(node->styles, sizeof(css_prop) * node->style_capacity);
+    }
+    for (int i = 0; i < from->style_count; i++) {
+        node->styles[i].name = from->styles[i].name ? strdup(from->styles[i].name) : NULL;
+        node->styles[i].value = from->styles[i].value ? strdup(from->styles[i].value) : NULL;
+    }
+    node->style_count = from->style_count;
+    mark_dirty(node, DIRTY_STYLE | DIRTY_LAYOUT);
+}
+
+static void parse_attributes(dom_node *node, const char *p, const char *end) {
+    while (p < end) {
+        while (p < end && isspace((unsigned char)*p)) p++;
+        if (p >= end) break;
+
+        const char *name_start = p;
+        while (p < end && *p != '=' && !isspace((unsigned char)*p) && *p != '>') p++;
+
+        const char *name_end = p;
+        const char *val_start = NULL;
+        const char *val_end = NULL;
+
+        if (p < end && *p == '=') {
+            p++;
+            if (p < end && (*p == '"' || *p == '\'')) {
+                char quote = *p++;
+                val_start = p;
+                const char *close = memchr(p, quote, end - p);
+                val_end = close ? close : end;
+                p = close ? close + 1 : end;
             } else {
-                val_start = str;
-                while (*str && !isspace((unsigned char)*str) && *str != '>') str++;
-                if (*str) {
-                    *str = '\0';
-                    str++;
-                }
+                val_start = p;
+                while (p < end && !isspace((unsigned char)*p) && *p != '>') p++;
+                val_end = p;
+                if (p < end) p++;
             }
-        } else if (*str) {
-            *name_end = '\0';
-            str++;
-        } else {
-            *name_end = '\0';
+        } else if (p < end) {
+            p++;
         }
 
-        if (strlen(name_start) > 0) {
-            if (val_start) {
-                decode_html_entities(val_start);
-            }
-            add_attribute(node, name_start, val_start);
+        if (name_end > name_start) {
+            char *name = strndup(name_start, name_end - name_start);
+            char *value = val_start ? decode_slice(val_start, val_end) : NULL;
+            append_attribute(node, name, value);
         }
     }
 }
 
-dom_node* parse_html(const char *html) {
+static int is_raw_text(dom_node *node) {
+    return node && node->tag && (strcasecmp(node->tag, "style") == 0 || strcasecmp(node->tag, "script") == 0);
+}
+
+static void emit_text(dom_node *current, const char *p, const char *end) {
+    size_t cap = DECODED_CAP(end - p);
+    char *text = malloc(cap);
+    int blank = 1;
+    size_t len = collapse_text(p, end, text, &blank);
+    if (blank) {
+        free(text);
+        return;
+    }
+    if (len + 1 < cap) text = realloc(text, len + 1);
+    add_child(current, new_text_node(text, current));
+}
+
+static dom_node* handle_tag(dom_node *current, const char *p, const char *end) {
+    int is_self_closing = 0;
+    if (end > p && end[-1] == '/') {
+        is_self_closing = 1;
+        end--;
+    }
+
+    if (p < end && *p == '/') {
+        if (current->parent != NULL) {
+            current = current->parent;
+        }
+    } else if (p < end && (*p == '!' || *p == '?')) {
+    } else {
+        while (p < end && isspace((unsigned char)*p)) p++;
+
+        const char *name_end = p;
+        while (name_end < end && !isspace((unsigned char)*name_end)) name_end++;
+
+        dom_node *new_node = create_element_n(p, name_end - p, current);
+
+        if (name_end < end) {
+            parse_attributes(new_node, name_end + 1, end);
+        }
+
+        add_child(current, new_node);
+
+        const char *tag = new_node->tag;
+        if (!is_self_closing &&
+            strcmp(tag, "meta") != 0 && strcmp(tag, "link") != 0 &&
+            strcmp(tag, "img") != 0 && strcmp(tag, "br") != 0 &&
+            strcmp(tag, "input") != 0 && strcmp(tag, "hr") != 0) {
+            current = new_node;
+        }
+    }
+    return current;
+}
+
+dom_node* parse_html_len(const char *html, size_t len) {
     dom_node *root = create_element("document", NULL);
     dom_node *current = root;
 
-    int in_tag = 0;
-    int buf_cap = 4194304;
-    char *buffer = malloc(buf_cap);
-    int buf_idx = 0;
-
-    for (int i = 0; html[i] != '\0'; i++) {
-        char c = html[i];
-
-        if (c == '<') {
-            if (current && current->tag &&
-                (strcasecmp(current->tag, "style") == 0 || strcasecmp(current->tag, "script") == 0)) {
-                if (strncmp(&html[i], "</style>", 8) != 0 && strncmp(&html[i], "</script>", 9) != 0 &&
-                    strncmp(&html[i], "</STYLE>", 8) != 0 && strncmp(&html[i], "</SCRIPT>", 9) != 0) {
-                    if (buf_idx < buf_cap - 1) buffer[buf_idx++] = c;
-                    continue;
-                    }
-                }
-
-                if (!in_tag && buf_idx > 0) {
-                    buffer[buf_idx] = '\0';
-
-                    char *r = buffer;
-                    char *w = buffer;
-                    int in_space = 0;
-                    while (*r) {
-                        if (isspace((unsigned char)*r)) {
-                            if (!in_space) { *w++ = ' '; in_space = 1; }
-                        } else {
-                            *w++ = *r;
-                            in_space = 0;
-                        }
-                        r++;
-                    }
-                    *w = '\0';
-
-                    if (buffer[0] != '\0' && strcmp(buffer, " ") != 0) {
-                        decode_html_entities(buffer);
-                        dom_node *text_node = create_text_node(buffer, current);
-                        add_child(current, text_node);
-                    }
-                    buf_idx = 0;
-                }
-                in_tag = 1;
-        } else if (c == '>') {
-            if (in_tag) {
-                in_tag = 0;
-
-                int is_self_closing = 0;
-                if (buf_idx > 0 && buffer[buf_idx - 1] == '/') {
-                    is_self_closing = 1;
-                    buffer[buf_idx - 1] = '\0';
-                } else {
-                    buffer[buf_idx] = '\0';
-                }
-
-                if (buffer[0] == '/') {
-                    if (current->parent != NULL) {
-                        current = current->parent;
-                    }
-                } else if (buffer[0] == '!' || buffer[0] == '?') {
-                } else {
-                    char *tag_start = buffer;
-                    while (*tag_start && isspace((unsigned char)*tag_start)) tag_start++;
-
-                    char *space = strchr(tag_start, ' ');
-                    if (space) {
-                        *space = '\0';
-                    }
-
-                    dom_node *new_node = create_element(tag_start, current);
-
-                    if (space) {
-                        parse_attributes(new_node, space + 1);
-                    }
-
-                    add_child(current, new_node);
-
-                    if (!is_self_closing &&
-                        strcasecmp(tag_start, "meta") != 0 && strcasecmp(tag_start, "link") != 0 &&
-                        strcasecmp(tag_start, "img") != 0 && strcasecmp(tag_start, "br") != 0 &&
-                        strcasecmp(tag_start, "input") != 0 && strcasecmp(tag_start, "hr") != 0) {
-                        current = new_node;
-                        }
-                }
-                buf_idx = 0;
-            } else {
-                if (buf_idx < buf_cap - 1) buffer[buf_idx++] = c;
-            }
+    const char *p = html;
+    const char *end = html + len;
+
+    while (p < end) {
+        const char *text_end;
+        if (is_raw_text(current)) {
+            text_end = scan_end_tag(p, end, current->tag);
         } else {
-            if (buf_idx < buf_cap - 1) {
-                buffer[buf_idx++] = c;
-            }
+            text_end = memchr(p, '<', end - p);
+            if (!text_end) text_end = end;
         }
+        if (text_end > p) emit_text(current, p, text_end);
+        p = text_end;
+        if (p >= end) break;
+
+        const char *gt = memchr(p + 1, '>', end - p - 1);
+        if (!gt) break;
+        current = handle_tag(current, p + 1, gt);
+        p = gt + 1;
     }
-    free(buffer);
+
     return root;
 }
 
+dom_node* parse_html(const char *html) {
+    return parse_html_len(html, strlen(html));
+}
+
 void print_tree(dom_node *root, int depth) {
     if (!root) return;
     for (int i = 0; i < depth; i++) printf("  ");
@@ -308,9 +534,11 @@ void free_tree(dom_node *root) {
         if (root->styles[i].value) free(root->styles[i].value);
     }
     if (root->styles) free(root->styles);
+    style_decls_release(root->inline_style);
     for (int i = 0; i < root->child_count; i++) {
         free_tree(root->children[i]);
     }
     if (root->children) free(root->children);
+    free(root->layout_memo);
     free(root);
 }
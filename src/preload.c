@@ -0,0 +1,371 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <pthread.h>
+#include "preload.h"
+#include "fetcher.h"
+#include "dns.h"
+#include "dom.h"
+#include "memstat.h"
+#include "trace.h"
+
+#define CARRY_CAP 8192
+#define PRELOAD_MAX_ENTRIES 128
+#define PRELOAD_WORKERS 4
+
+struct preload_scanner {
+    parsed_url base;
+    char carry[CARRY_CAP];
+    size_t carry_len;
+    int in_comment;
+    char raw_tag[8];
+    int found;
+};
+
+typedef enum {
+    PRELOAD_QUEUED,
+    PRELOAD_FETCHING,
+    PRELOAD_READY,
+    PRELOAD_FAILED
+} preload_state;
+
+typedef struct preload_entry {
+    char *key;
+    parsed_url target;
+    preload_state state;
+    int abandoned;
+    http_response resp;
+    http_body body;
+    struct preload_entry *next;
+} preload_entry;
+
+static preload_entry *entries = NULL;
+static int entry_count = 0;
+static int stopping = 0;
+
+static pthread_mutex_t preload_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t preload_done = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t preload_queued = PTHREAD_COND_INITIALIZER;
+static pthread_once_t workers_once = PTHREAD_ONCE_INIT;
+static pthread_t workers[PRELOAD_WORKERS];
+static int worker_count = 0;
+
+static void entry_free(preload_entry *e) {
+    if (e->state == PRELOAD_READY) memstat_sub(MEM_RESPONSE, e->body.cap);
+    http_response_free(&e->resp);
+    http_body_free(&e->body);
+    free(e->key);
+    free(e);
+}
+
+static void unlink_entry(preload_entry *e) {
+    for (preload_entry **pp = &entries; *pp; pp = &(*pp)->next) {
+        if (*pp == e) {
+            *pp = e->next;
+            entry_count--;
+            return;
+        }
+    }
+}
+
+static preload_entry* find_entry(const char *key) {
+    for (preload_entry *e = entries; e; e = e->next) {
+        if (!e->abandoned && strcmp(e->key, key) == 0) return e;
+    }
+    return NULL;
+}
+
+static preload_entry* next_queued() {
+    preload_entry *found = NULL;
+    for (preload_entry *e = entries; e; e = e->next) {
+        if (e->state == PRELOAD_QUEUED) found = e;
+    }
+    return found;
+}
+
+static void* worker_main(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&preload_lock);
+    while (!stopping) {
+        preload_entry *e = next_queued();
+        if (!e) {
+            pthread_cond_wait(&preload_queued, &preload_lock);
+            continue;
+        }
+        e->state = PRELOAD_FETCHING;
+        pthread_mutex_unlock(&preload_lock);
+
+        TRACE_BEGIN("preload.fetch");
+        http_sink sink = { http_body_headers, http_body_append, &e->body };
+        int ok = http_fetch_url(&e->target, &e->resp, &sink, NULL) == 0 && e->resp.status < 400;
+        TRACE_END("preload.fetch");
+
+        pthread_mutex_lock(&preload_lock);
+        e->state = ok ? PRELOAD_READY : PRELOAD_FAILED;
+        if (ok) memstat_add(MEM_RESPONSE, e->body.cap);
+        if (e->abandoned) {
+            unlink_entry(e);
+            entry_free(e);
+        }
+        pthread_cond_broadcast(&preload_done);
+    }
+    pthread_mutex_unlock(&preload_lock);
+    return NULL;
+}
+
+static void start_workers() {
+    for (int i = 0; i < PRELOAD_WORKERS; i++) {
+        if (pthread_create(&workers[worker_count], NULL, worker_main, NULL) == 0) worker_count++;
+    }
+}
+
+void preload_fetch(const parsed_url *target) {
+    char key[URL_MAX];
+    url_format(target, key, sizeof(key));
+
+    pthread_once(&workers_once, start_workers);
+    pthread_mutex_lock(&preload_lock);
+    if (!stopping && entry_count < PRELOAD_MAX_ENTRIES && !find_entry(key)) {
+        preload_entry *e = calloc(1, sizeof(preload_entry));
+        e->key = strdup(key);
+        e->target = *target;
+        e->state = PRELOAD_QUEUED;
+        e->next = entries;
+        entries = e;
+        entry_count++;
+        pthread_cond_signal(&preload_queued);
+    }
+    pthread_mutex_unlock(&preload_lock);
+}
+
+int preload_take(const parsed_url *target, http_response *resp, http_body *body) {
+    char key[URL_MAX];
+    url_format(target, key, sizeof(key));
+
+    pthread_mutex_lock(&preload_lock);
+    preload_entry *e = find_entry(key);
+    while (e && e->state == PRELOAD_FETCHING) {
+        pthread_cond_wait(&preload_done, &preload_lock);
+        e = find_entry(key);
+    }
+    if (!e) {
+        pthread_mutex_unlock(&preload_lock);
+        return -1;
+    }
+
+    unlink_entry(e);
+    pthread_mutex_unlock(&preload_lock);
+
+    int ok = e->state == PRELOAD_READY;
+    if (ok) {
+        memstat_sub(MEM_RESPONSE, e->body.cap);
+        *resp = e->resp;
+        *body = e->body;
+        e->state = PRELOAD_QUEUED;
+        memset(&e->resp, 0, sizeof(e->resp));
+        memset(&e->body, 0, sizeof(e->body));
+    }
+    entry_free(e);
+    return ok ? 0 : -1;
+}
+
+void preload_clear() {
+    pthread_mutex_lock(&preload_lock);
+    preload_entry **pp = &entries;
+    while (*pp) {
+        preload_entry *e = *pp;
+        if (e->state == PRELOAD_FETCHING) {
+            e->abandoned = 1;
+            pp = &e->next;
+            continue;
+        }
+        *pp = e->next;
+        entry_count--;
+        entry_free(e);
+    }
+    pthread_mutex_unlock(&preload_lock);
+}
+
+void preload_shutdown() {
+    pthread_mutex_lock(&preload_lock);
+    stopping = 1;
+    pthread_cond_broadcast(&preload_queued);
+    pthread_mutex_unlock(&preload_lock);
+    for (int i = 0; i < worker_count; i++) pthread_join(workers[i], NULL);
+    worker_count = 0;
+    preload_clear();
+}
+
+preload_scanner* preload_scanner_new(const parsed_url *base) {
+    preload_scanner *s = calloc(1, sizeof(preload_scanner));
+    s->base = *base;
+    return s;
+}
+
+int preload_scanner_found(const preload_scanner *s) {
+    return s->found;
+}
+
+void preload_scanner_free(preload_scanner *s) {
+    free(s);
+}
+
+static const char* find_tag_end(const char *p, const char *end) {
+    char quote = 0;
+    for (; p < end; p++) {
+        if (quote) {
+            if (*p == quote) quote = 0;
+        } else if (*p == '"' || *p == '\'') {
+            quote = *p;
+        } else if (*p == '>') {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+static int tag_attribute(const char *p, const char *end, const char *name, char *out, size_t size) {
+    size_t name_len = strlen(name);
+    while (p < end) {
+        while (p < end && (isspace((unsigned char)*p) || *p == '/')) p++;
+        const char *attr = p;
+        while (p < end && !isspace((unsigned char)*p) && *p != '=' && *p != '>' && *p != '/') p++;
+        size_t attr_len = p - attr;
+        while (p < end && isspace((unsigned char)*p)) p++;
+
+        const char *val = NULL;
+        size_t val_len = 0;
+        if (p < end && *p == '=') {
+            p++;
+            while (p < end && isspace((unsigned char)*p)) p++;
+            if (p < end && (*p == '"' || *p == '\'')) {
+                char quote = *p++;
+                val = p;
+                while (p < end && *p != quote) p++;
+                val_len = p - val;
+                if (p < end) p++;
+            } else {
+                val = p;
+                while (p < end && !isspace((unsigned char)*p) && *p != '>') p++;
+                val_len = p - val;
+            }
+        }
+
+        if (attr_len == name_len && strncasecmp(attr, name, name_len) == 0) {
+            if (!val || val_len >= size) return 0;
+            memcpy(out, val, val_len);
+            out[val_len] = '\0';
+            decode_html_entities(out);
+            return 1;
+        }
+        if (attr_len == 0 && !val) p++;
+    }
+    return 0;
+}
+
+static void found_url(preload_scanner *s, const char *ref, int fetch) {
+    parsed_url target;
+    if (ref[0] == '\0' || url_resolve(&s->base, ref, &target) != 0) return;
+    s->found++;
+    if (fetch) preload_fetch(&target);
+    else dns_prefetch(target.host);
+}
+
+static void process_tag(preload_scanner *s, const char *p, const char *end) {
+    const char *name = p;
+    while (p < end && isalnum((unsigned char)*p)) p++;
+    size_t name_len = p - name;
+    char value[URL_MAX];
+
+    if (name_len == 3 && strncasecmp(name, "img", 3) == 0) {
+        if (tag_attribute(p, end, "src", value, sizeof(value))) found_url(s, value, 1);
+    } else if (name_len == 4 && strncasecmp(name, "link", 4) == 0) {
+        char rel[64];
+        if (tag_attribute(p, end, "rel", rel, sizeof(rel)) && strcasestr(rel, "stylesheet") &&
+            tag_attribute(p, end, "href", value, sizeof(value))) found_url(s, value, 1);
+    } else if (name_len == 6 && strncasecmp(name, "script", 6) == 0) {
+        if (tag_attribute(p, end, "src", value, sizeof(value))) found_url(s, value, 0);
+        strcpy(s->raw_tag, "script");
+    } else if (name_len == 5 && strncasecmp(name, "style", 5) == 0) {
+        strcpy(s->raw_tag, "style");
+    }
+}
+
+static size_t scan_block(preload_scanner *s, const char *buf, size_t len) {
+    const char *p = buf;
+    const char *end = buf + len;
+
+    while (p < end) {
+        if (s->in_comment) {
+            const char *close = memmem(p, end - p, "-->", 3);
+            if (!close) return end - p > 2 ? (size_t)(end - 2 - buf) : (size_t)(p - buf);
+            p = close + 3;
+            s->in_comment = 0;
+            continue;
+        }
+
+        const char *lt = memchr(p, '<', end - p);
+        if (!lt) return len;
+
+        if (s->raw_tag[0]) {
+            size_t tag_len = strlen(s->raw_tag);
+            if ((size_t)(end - lt) < tag_len + 3) return lt - buf;
+            if (lt[1] == '/' && strncasecmp(lt + 2, s->raw_tag, tag_len) == 0 && !isalnum((unsigned char)lt[2 + tag_len])) {
+                s->raw_tag[0] = '\0';
+            }
+            p = lt + 1;
+            continue;
+        }
+
+        if (end - lt < 4) return lt - buf;
+        if (memcmp(lt, "<!--", 4) == 0) {
+            s->in_comment = 1;
+            p = lt + 4;
+            continue;
+        }
+        if (!isalpha((unsigned char)lt[1])) {
+            p = lt + 1;
+            continue;
+        }
+
+        const char *gt = find_tag_end(lt + 1, end);
+        if (!gt) return lt - buf;
+        process_tag(s, lt + 1, gt);
+        p = gt + 1;
+    }
+    return len;
+}
+
+void preload_scanner_feed(preload_scanner *s, const char *data, size_t len) {
+    TRACE_SCOPE("preload.scan");
+    if (s->carry_len > 0) {
+        size_t old_len = s->carry_len;
+        size_t n = len < CARRY_CAP - old_len ? len : CARRY_CAP - old_len;
+        memcpy(s->carry + old_len, data, n);
+        s->carry_len += n;
+
+        size_t used = scan_block(s, s->carry, s->carry_len);
+        if (used >= old_len) {
+            data += used - old_len;
+            len -= used - old_len;
+        } else if (n == len) {
+            memmove(s->carry, s->carry + used, s->carry_len - used);
+            s->carry_len -= used;
+            return;
+        } else {
+            data += n;
+            len -= n;
+        }
+        s->carry_len = 0;
+    }
+    if (len == 0) return;
+
+    size_t used = scan_block(s, data, len);
+    size_t rest = len - used;
+    if (rest > CARRY_CAP) rest = 0;
+    memcpy(s->carry, data + used, rest);
+    s->carry_len = rest;
+}
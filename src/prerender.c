@@ -0,0 +1,242 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <pthread.h>
+#include "prerender.h"
+#include "fetcher.h"
+#include "css.h"
+#include "memstat.h"
+#include "trace.h"
+
+#define PRERENDER_MAX 4
+#define PRERENDER_TTL 30.0
+
+typedef enum {
+    ENTRY_QUEUED,
+    ENTRY_FETCHING,
+    ENTRY_FETCHED,
+    ENTRY_STYLED,
+    ENTRY_FAILED
+} entry_state;
+
+typedef struct {
+    int used;
+    char key[URL_MAX];
+    parsed_url target;
+    parsed_url final_url;
+    entry_state state;
+    double created;
+    http_body body;
+    dom_node *tree;
+} prerender_entry;
+
+static prerender_entry entries[PRERENDER_MAX];
+static int mode_loaded = 0;
+static prerender_mode mode = PRERENDER_OFF;
+static int dwell = 300;
+static int stopping = 0;
+static int style_assets = 1;
+
+static pthread_mutex_t prerender_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t prerender_queued = PTHREAD_COND_INITIALIZER;
+static pthread_once_t worker_once = PTHREAD_ONCE_INIT;
+static pthread_t worker;
+static int worker_started = 0;
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+prerender_mode prerender_get_mode() {
+    if (!mode_loaded) {
+        const char *val = getenv("BROWSER_PRERENDER");
+        if (val && strcasecmp(val, "fetch") == 0) mode = PRERENDER_FETCH;
+        else if (val && (strcasecmp(val, "full") == 0 || strcmp(val, "1") == 0)) mode = PRERENDER_FULL;
+        const char *ms = getenv("BROWSER_PRERENDER_DWELL_MS");
+        if (ms && atoi(ms) >= 0) dwell = atoi(ms);
+        mode_loaded = 1;
+    }
+    return mode;
+}
+
+int prerender_dwell_ms() {
+    prerender_get_mode();
+    return dwell;
+}
+
+static void entry_release(prerender_entry *e) {
+    if (e->body.cap) memstat_sub(MEM_RESPONSE, e->body.cap);
+    http_body_free(&e->body);
+    if (e->tree) free_tree(e->tree);
+    memset(e, 0, sizeof(*e));
+}
+
+static prerender_entry* find_entry(const char *key) {
+    for (int i = 0; i < PRERENDER_MAX; i++) {
+        if (entries[i].used && strcmp(entries[i].key, key) == 0) return &entries[i];
+    }
+    return NULL;
+}
+
+static prerender_entry* claim_entry() {
+    prerender_entry *victim = NULL;
+    for (int i = 0; i < PRERENDER_MAX; i++) {
+        prerender_entry *e = &entries[i];
+        if (!e->used) return e;
+        if (e->state == ENTRY_FETCHING) continue;
+        if (!victim || e->created < victim->created) victim = e;
+    }
+    if (victim) entry_release(victim);
+    return victim;
+}
+
+static prerender_entry* next_queued() {
+    prerender_entry *found = NULL;
+    for (int i = 0; i < PRERENDER_MAX; i++) {
+        prerender_entry *e = &entries[i];
+        if (e->used && e->state == ENTRY_QUEUED && (!found || e->created < found->created)) found = e;
+    }
+    return found;
+}
+
+static void style_tree(dom_node *tree, const parsed_url *final_url, int download_assets) {
+    char base_url[URL_MAX];
+    url_origin(final_url, base_url, sizeof(base_url));
+    TRACE_SCOPE("prerender.css");
+    process_css(tree, base_url, download_assets);
+}
+
+static void* worker_main(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&prerender_lock);
+    while (!stopping) {
+        prerender_entry *e = next_queued();
+        if (!e) {
+            pthread_cond_wait(&prerender_queued, &prerender_lock);
+            continue;
+        }
+        e->state = ENTRY_FETCHING;
+        parsed_url target = e->target;
+        pthread_mutex_unlock(&prerender_lock);
+
+        TRACE_BEGIN("prerender.fetch");
+        http_response resp;
+        http_body body = {0};
+        parsed_url final_url;
+        http_sink sink = { http_body_headers, http_body_append, &body };
+        int ok = http_fetch_url(&target, &resp, &sink, &final_url) == 0 && resp.status < 400;
+        http_response_free(&resp);
+        TRACE_END("prerender.fetch");
+
+        dom_node *tree = NULL;
+        if (ok && mode == PRERENDER_FULL) {
+            TRACE_BEGIN("prerender.parse");
+            tree = parse_html_len(body.data ? body.data : "", body.len);
+            TRACE_END("prerender.parse");
+            http_body_free(&body);
+            if (tree) style_tree(tree, &final_url, __atomic_load_n(&style_assets, __ATOMIC_RELAXED));
+        }
+
+        pthread_mutex_lock(&prerender_lock);
+        if (!ok) {
+            http_body_free(&body);
+            e->state = ENTRY_FAILED;
+        } else {
+            e->final_url = final_url;
+            e->tree = tree;
+            e->body = body;
+            if (body.cap) memstat_add(MEM_RESPONSE, body.cap);
+            e->state = tree ? ENTRY_STYLED : ENTRY_FETCHED;
+        }
+    }
+    pthread_mutex_unlock(&prerender_lock);
+    return NULL;
+}
+
+static void start_worker() {
+    if (pthread_create(&worker, NULL, worker_main, NULL) == 0) worker_started = 1;
+}
+
+void prerender_request(const parsed_url *target) {
+    if (prerender_get_mode() == PRERENDER_OFF) return;
+    char key[URL_MAX];
+    url_format(target, key, sizeof(key));
+
+    pthread_once(&worker_once, start_worker);
+    pthread_mutex_lock(&prerender_lock);
+    prerender_entry *e = find_entry(key);
+    if (e && now_seconds() - e->created > PRERENDER_TTL && e->state != ENTRY_FETCHING) {
+        entry_release(e);
+        e = NULL;
+    }
+    if (!e && !stopping) {
+        e = claim_entry();
+        if (e) {
+            printf("prerendering %s\n", key);
+            e->used = 1;
+            strcpy(e->key, key);
+            e->target = *target;
+            e->state = ENTRY_QUEUED;
+            e->created = now_seconds();
+            pthread_cond_signal(&prerender_queued);
+        }
+    }
+    pthread_mutex_unlock(&prerender_lock);
+}
+
+void prerender_poll(int download_assets) {
+    if (mode == PRERENDER_OFF) return;
+    __atomic_store_n(&style_assets, download_assets, __ATOMIC_RELAXED);
+}
+
+int prerender_take(const parsed_url *target, dom_node **tree, parsed_url *final_url, int download_assets) {
+    if (mode == PRERENDER_OFF) return 0;
+    char key[URL_MAX];
+    url_format(target, key, sizeof(key));
+
+    pthread_mutex_lock(&prerender_lock);
+    prerender_entry *e = find_entry(key);
+    if (!e || e->state == ENTRY_FETCHING) {
+        pthread_mutex_unlock(&prerender_lock);
+        return 0;
+    }
+    prerender_entry taken = *e;
+    memset(e, 0, sizeof(*e));
+    pthread_mutex_unlock(&prerender_lock);
+
+    int fresh = now_seconds() - taken.created <= PRERENDER_TTL;
+    if (fresh && taken.state == ENTRY_FETCHED) {
+        TRACE_BEGIN("prerender.parse");
+        taken.tree = parse_html_len(taken.body.data ? taken.body.data : "", taken.body.len);
+        TRACE_END("prerender.parse");
+        if (taken.tree) {
+            style_tree(taken.tree, &taken.final_url, download_assets);
+            taken.state = ENTRY_STYLED;
+        }
+    }
+
+    int ok = fresh && taken.state == ENTRY_STYLED;
+    if (ok) {
+        *tree = taken.tree;
+        *final_url = taken.final_url;
+        taken.tree = NULL;
+    }
+    entry_release(&taken);
+    return ok;
+}
+
+void prerender_shutdown() {
+    pthread_mutex_lock(&prerender_lock);
+    stopping = 1;
+    pthread_cond_broadcast(&prerender_queued);
+    pthread_mutex_unlock(&prerender_lock);
+    if (worker_started) pthread_join(worker, NULL);
+    worker_started = 0;
+    for (int i = 0; i < PRERENDER_MAX; i++) {
+        if (entries[i].used) entry_release(&entries[i]);
+    }
+}
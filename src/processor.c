@@ -3,26 +3,23 @@
 #include <string.h>
 #include "processor.h"
 #include "dom.h"
+#include "trace.h"
+#include "dump.h"
+
+dom_node* process_document(const char *body, size_t length, const char *url, int make_temp) {
+    if (make_temp) dump_submit(url, "document", body, length);
+
+    printf("parsing html tree...\n");
+    TRACE_SCOPE("parse");
+    return parse_html_len(body, length);
+}
 
 dom_node* process_response(const char *raw_data, size_t length, int make_temp) {
     const char *body_start = strstr(raw_data, "\r\n\r\n");
 
     if (body_start != NULL) {
         body_start += 4;
-
-        if (make_temp) {
-            size_t header_len = body_start - raw_data;
-            size_t body_len = length - header_len;
-            FILE *file = fopen("temp_page.html", "w");
-            if (file != NULL) {
-                fwrite(body_start, 1, body_len, file);
-                fclose(file);
-                printf("saved pure html to temp_page.html\n");
-            }
-        }
-
-        printf("parsing html tree...\n");
-        return parse_html(body_start);
+        return process_document(body_start, length - (body_start - raw_data), NULL, make_temp);
     } else {
         printf("could not find http headers\n");
         return NULL;
@@ -0,0 +1,373 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <png.h>
+#include <jpeglib.h>
+#include "progressive.h"
+
+#define SNIFF_BYTES 64
+
+typedef enum {
+    JPEG_HEADER,
+    JPEG_START,
+    JPEG_ROWS,
+    JPEG_SCANS,
+    JPEG_FINISH,
+    JPEG_DONE
+} jpeg_phase;
+
+struct progressive_decoder {
+    progressive_format kind;
+    size_t max_bytes;
+    unsigned char head[SNIFF_BYTES];
+    size_t head_len;
+    int width, height;
+    uint32_t *pixels;
+    int updated;
+    int complete;
+    int failed;
+
+    png_structp png;
+    png_infop info;
+    int passes;
+
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    struct jpeg_source_mgr src;
+    jmp_buf jpeg_jump;
+    int jpeg_ready;
+    jpeg_phase phase;
+    unsigned char *buf;
+    size_t buf_len;
+    size_t buf_cap;
+    size_t skip;
+    int completed_scan;
+    int shown_scan;
+    int output_scan;
+    int output_started;
+};
+
+static const int adam7_x0[7] = { 0, 4, 0, 2, 0, 1, 0 };
+static const int adam7_dx[7] = { 8, 8, 4, 4, 2, 2, 1 };
+static const int adam7_block_w[7] = { 8, 4, 4, 2, 2, 1, 1 };
+
+static int read_le16(const unsigned char *p) { return p[0] | p[1] << 8; }
+static int read_le24(const unsigned char *p) { return p[0] | p[1] << 8 | p[2] << 16; }
+
+static int probe_size(const unsigned char *data, size_t len, int *width, int *height) {
+    if (len >= 10 && memcmp(data, "GIF8", 4) == 0) {
+        *width = read_le16(data + 6);
+        *height = read_le16(data + 8);
+    } else if (len >= 30 && memcmp(data, "RIFF", 4) == 0 && memcmp(data + 8, "WEBP", 4) == 0) {
+        if (memcmp(data + 12, "VP8X", 4) == 0) {
+            *width = read_le24(data + 24) + 1;
+            *height = read_le24(data + 27) + 1;
+        } else if (memcmp(data + 12, "VP8 ", 4) == 0) {
+            *width = read_le16(data + 26) & 0x3fff;
+            *height = read_le16(data + 28) & 0x3fff;
+        } else if (memcmp(data + 12, "VP8L", 4) == 0 && data[20] == 0x2f) {
+            unsigned long bits = data[21] | (unsigned long)data[22] << 8 | (unsigned long)data[23] << 16 | (unsigned long)data[24] << 24;
+            *width = (int)(bits & 0x3fff) + 1;
+            *height = (int)((bits >> 14) & 0x3fff) + 1;
+        } else {
+            return -1;
+        }
+    } else {
+        return -1;
+    }
+    return *width > 0 && *height > 0 ? 0 : -1;
+}
+
+static progressive_format sniff(const unsigned char *data, size_t len) {
+    if (len >= 3 && data[0] == 0xff && data[1] == 0xd8 && data[2] == 0xff) return PROGRESSIVE_JPEG;
+    if (len < 8) return PROGRESSIVE_UNKNOWN;
+    if (png_sig_cmp((png_const_bytep)data, 0, 8) == 0) return PROGRESSIVE_PNG;
+    return PROGRESSIVE_OTHER;
+}
+
+static int allocate_pixels(progressive_decoder *dec, int width, int height) {
+    dec->width = width;
+    dec->height = height;
+    if (width <= 0 || height <= 0 || (size_t)width * height * 4 > dec->max_bytes) return -1;
+    dec->pixels = calloc((size_t)width * height, 4);
+    return dec->pixels ? 0 : -1;
+}
+
+static void png_fail(png_structp png, png_const_charp msg) {
+    (void)msg;
+    png_longjmp(png, 1);
+}
+
+static void png_warn(png_structp png, png_const_charp msg) {
+    (void)png;
+    (void)msg;
+}
+
+static void png_on_info(png_structp png, png_infop info) {
+    progressive_decoder *dec = png_get_progressive_ptr(png);
+    png_uint_32 width, height;
+    int depth, color, interlace;
+    png_get_IHDR(png, info, &width, &height, &depth, &color, &interlace, NULL, NULL);
+    if (allocate_pixels(dec, (int)width, (int)height) != 0) png_error(png, "image too large");
+
+    png_set_expand(png);
+    png_set_strip_16(png);
+    if (color == PNG_COLOR_TYPE_GRAY || color == PNG_COLOR_TYPE_GRAY_ALPHA) png_set_gray_to_rgb(png);
+    png_set_bgr(png);
+    png_set_filler(png, 0xff, PNG_FILLER_AFTER);
+    dec->passes = png_set_interlace_handling(png);
+    png_read_update_info(png, info);
+}
+
+static void png_on_row(png_structp png, png_bytep new_row, png_uint_32 row_num, int pass) {
+    progressive_decoder *dec = png_get_progressive_ptr(png);
+    if (!new_row || (int)row_num >= dec->height) return;
+    uint32_t *row = dec->pixels + (size_t)row_num * dec->width;
+    const uint32_t *src = (const uint32_t*)new_row;
+
+    if (dec->passes == 1) {
+        memcpy(row, src, (size_t)dec->width * 4);
+    } else {
+        for (int x = adam7_x0[pass]; x < dec->width; x += adam7_dx[pass]) {
+            for (int i = 0; i < adam7_block_w[pass] && x + i < dec->width; i++) row[x + i] = src[x];
+        }
+    }
+    dec->updated = 1;
+}
+
+static void png_on_end(png_structp png, png_infop info) {
+    (void)info;
+    progressive_decoder *dec = png_get_progressive_ptr(png);
+    dec->complete = 1;
+}
+
+static int feed_png(progressive_decoder *dec, const unsigned char *data, size_t len) {
+    if (!dec->png) {
+        dec->png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, png_fail, png_warn);
+        if (!dec->png) return -1;
+        dec->info = png_create_info_struct(dec->png);
+        if (!dec->info) return -1;
+        png_set_progressive_read_fn(dec->png, dec, png_on_info, png_on_row, png_on_end);
+    }
+    if (setjmp(png_jmpbuf(dec->png))) return -1;
+    png_process_data(dec->png, dec->info, (png_bytep)data, len);
+    return 0;
+}
+
+static void jpeg_fail(j_common_ptr cinfo) {
+    progressive_decoder *dec = cinfo->client_data;
+    longjmp(dec->jpeg_jump, 1);
+}
+
+static void jpeg_quiet(j_common_ptr cinfo) {
+    (void)cinfo;
+}
+
+static void source_init(j_decompress_ptr cinfo) {
+    (void)cinfo;
+}
+
+static boolean source_fill(j_decompress_ptr cinfo) {
+    (void)cinfo;
+    return FALSE;
+}
+
+static void source_skip(j_decompress_ptr cinfo, long count) {
+    progressive_decoder *dec = cinfo->client_data;
+    if (count <= 0) return;
+    if ((size_t)count <= dec->src.bytes_in_buffer) {
+        dec->src.next_input_byte += count;
+        dec->src.bytes_in_buffer -= count;
+        return;
+    }
+    dec->skip += count - dec->src.bytes_in_buffer;
+    dec->src.next_input_byte += dec->src.bytes_in_buffer;
+    dec->src.bytes_in_buffer = 0;
+}
+
+static void source_term(j_decompress_ptr cinfo) {
+    (void)cinfo;
+}
+
+static int jpeg_show_scan(progressive_decoder *dec) {
+    j_decompress_ptr cinfo = &dec->cinfo;
+    if (!dec->output_started) {
+        if (!jpeg_start_output(cinfo, dec->output_scan)) return 0;
+        dec->output_started = 1;
+    }
+    while (cinfo->output_scanline < cinfo->output_height) {
+        JSAMPROW row = (JSAMPROW)(dec->pixels + (size_t)cinfo->output_scanline * dec->width);
+        if (jpeg_read_scanlines(cinfo, &row, 1) != 1) return 0;
+    }
+    if (!jpeg_finish_output(cinfo)) return 0;
+    dec->shown_scan = dec->output_scan;
+    dec->output_scan = 0;
+    dec->output_started = 0;
+    dec->updated = 1;
+    return 1;
+}
+
+static int jpeg_step(progressive_decoder *dec) {
+    j_decompress_ptr cinfo = &dec->cinfo;
+
+    if (dec->phase == JPEG_HEADER) {
+        if (jpeg_read_header(cinfo, TRUE) == JPEG_SUSPENDED) return 0;
+        if (allocate_pixels(dec, (int)cinfo->image_width, (int)cinfo->image_height) != 0) return -1;
+        cinfo->out_color_space = JCS_EXT_BGRA;
+        cinfo->buffered_image = jpeg_has_multiple_scans(cinfo);
+        dec->phase = JPEG_START;
+    }
+    if (dec->phase == JPEG_START) {
+        if (!jpeg_start_decompress(cinfo)) return 0;
+        dec->phase = cinfo->buffered_image ? JPEG_SCANS : JPEG_ROWS;
+    }
+    if (dec->phase == JPEG_ROWS) {
+        while (cinfo->output_scanline < cinfo->output_height) {
+            JSAMPROW row = (JSAMPROW)(dec->pixels + (size_t)cinfo->output_scanline * dec->width);
+            if (jpeg_read_scanlines(cinfo, &row, 1) != 1) return 0;
+            dec->updated = 1;
+        }
+        dec->phase = JPEG_FINISH;
+    }
+    while (dec->phase == JPEG_SCANS) {
+        if (dec->output_scan) {
+            if (!jpeg_show_scan(dec)) return 0;
+            continue;
+        }
+        int status = jpeg_consume_input(cinfo);
+        if (status == JPEG_SCAN_COMPLETED || status == JPEG_REACHED_EOI) dec->completed_scan = cinfo->input_scan_number;
+        if ((status == JPEG_SUSPENDED || status == JPEG_REACHED_EOI) && dec->completed_scan > dec->shown_scan) {
+            dec->output_scan = dec->completed_scan;
+            continue;
+        }
+        if (status == JPEG_SUSPENDED) return 0;
+        if (status == JPEG_REACHED_EOI) dec->phase = JPEG_FINISH;
+    }
+    if (dec->phase == JPEG_FINISH) {
+        if (!jpeg_finish_decompress(cinfo)) return 0;
+        dec->phase = JPEG_DONE;
+        dec->complete = 1;
+    }
+    return 0;
+}
+
+static int jpeg_start(progressive_decoder *dec) {
+    dec->cinfo.err = jpeg_std_error(&dec->jerr);
+    dec->jerr.error_exit = jpeg_fail;
+    dec->jerr.output_message = jpeg_quiet;
+    dec->cinfo.client_data = dec;
+    if (setjmp(dec->jpeg_jump)) return -1;
+    jpeg_create_decompress(&dec->cinfo);
+    dec->src.init_source = source_init;
+    dec->src.fill_input_buffer = source_fill;
+    dec->src.skip_input_data = source_skip;
+    dec->src.resync_to_restart = jpeg_resync_to_restart;
+    dec->src.term_source = source_term;
+    dec->cinfo.src = &dec->src;
+    dec->jpeg_ready = 1;
+    return 0;
+}
+
+static int jpeg_buffer(progressive_decoder *dec, const unsigned char *data, size_t len) {
+    size_t dropped = dec->skip < len ? dec->skip : len;
+    dec->skip -= dropped;
+    data += dropped;
+    len -= dropped;
+
+    size_t pending = dec->src.bytes_in_buffer;
+    if (pending && dec->src.next_input_byte != dec->buf) memmove(dec->buf, dec->src.next_input_byte, pending);
+    dec->buf_len = pending;
+    if (dec->buf_len + len > dec->buf_cap) {
+        size_t cap = dec->buf_cap ? dec->buf_cap : 16384;
+        while (dec->buf_len + len > cap) cap *= 2;
+        unsigned char *grown = realloc(dec->buf, cap);
+        if (!grown) return -1;
+        dec->buf = grown;
+        dec->buf_cap = cap;
+    }
+    if (len) memcpy(dec->buf + dec->buf_len, data, len);
+    dec->buf_len += len;
+    dec->src.next_input_byte = dec->buf;
+    dec->src.bytes_in_buffer = dec->buf_len;
+    return 0;
+}
+
+static int feed_jpeg(progressive_decoder *dec, const unsigned char *data, size_t len) {
+    if (!dec->jpeg_ready && jpeg_start(dec) != 0) return -1;
+    if (dec->phase == JPEG_DONE) return 0;
+    if (jpeg_buffer(dec, data, len) != 0) return -1;
+    if (setjmp(dec->jpeg_jump)) return -1;
+    return jpeg_step(dec);
+}
+
+static int feed_decoder(progressive_decoder *dec, const unsigned char *data, size_t len) {
+    int rc = dec->kind == PROGRESSIVE_PNG ? feed_png(dec, data, len) : feed_jpeg(dec, data, len);
+    if (rc != 0) dec->failed = 1;
+    return rc;
+}
+
+progressive_decoder* progressive_new(size_t max_bytes) {
+    progressive_decoder *dec = calloc(1, sizeof(progressive_decoder));
+    if (dec) dec->max_bytes = max_bytes;
+    return dec;
+}
+
+int progressive_feed(progressive_decoder *dec, const char *data, size_t len) {
+    if (dec->failed) return -1;
+    const unsigned char *bytes = (const unsigned char*)data;
+
+    if (dec->kind == PROGRESSIVE_UNKNOWN || dec->kind == PROGRESSIVE_OTHER) {
+        size_t take = sizeof(dec->head) - dec->head_len;
+        if (take > len) take = len;
+        memcpy(dec->head + dec->head_len, bytes, take);
+        dec->head_len += take;
+
+        if (dec->kind == PROGRESSIVE_UNKNOWN) {
+            dec->kind = sniff(dec->head, dec->head_len);
+            if (dec->kind == PROGRESSIVE_PNG || dec->kind == PROGRESSIVE_JPEG) {
+                if (feed_decoder(dec, dec->head, dec->head_len) != 0) return -1;
+                return take < len ? feed_decoder(dec, bytes + take, len - take) : 0;
+            }
+        }
+        if (dec->kind == PROGRESSIVE_OTHER && !dec->width) probe_size(dec->head, dec->head_len, &dec->width, &dec->height);
+        return 0;
+    }
+    return feed_decoder(dec, bytes, len);
+}
+
+progressive_format progressive_kind(const progressive_decoder *dec) {
+    return dec->kind;
+}
+
+int progressive_size(const progressive_decoder *dec, int *width, int *height) {
+    if (dec->width <= 0 || dec->height <= 0) return -1;
+    *width = dec->width;
+    *height = dec->height;
+    return 0;
+}
+
+int progressive_updated(progressive_decoder *dec) {
+    int updated = dec->updated && !dec->failed;
+    dec->updated = 0;
+    return updated;
+}
+
+int progressive_complete(const progressive_decoder *dec) {
+    return dec->complete && !dec->failed && dec->pixels;
+}
+
+const uint32_t* progressive_pixels(const progressive_decoder *dec, int *pitch) {
+    if (!dec->pixels || dec->failed) return NULL;
+    *pitch = dec->width * 4;
+    return dec->pixels;
+}
+
+void progressive_free(progressive_decoder *dec) {
+    if (!dec) return;
+    if (dec->png) png_destroy_read_struct(&dec->png, dec->info ? &dec->info : NULL, NULL);
+    if (dec->jpeg_ready) jpeg_destroy_decompress(&dec->cinfo);
+    free(dec->buf);
+    free(dec->pixels);
+    free(dec);
+}
@@ -2,17 +2,25 @@
 #include <ctype.h>
 #include <string.h>
 #include <stdlib.h>
-#include <sys/stat.h>
+#include <limits.h>
 #include <sys/types.h>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_image.h>
 #include "renderer.h"
 #include "css.h"
-#include "fetcher.h"
+#include "imagepool.h"
+#include "trace.h"
+#include "memstat.h"
+#include "history.h"
+#include "fontcache.h"
 
 #define WIN_W 1280
 #define WIN_H 720
+#define MIN_WIN_W 320
+#define MIN_WIN_H 200
+#define EST_CHAR_W (FONT_DEFAULT_PX / 2)
+#define EST_LINE_H (FONT_DEFAULT_PX * 5 / 4 + 4)
 
 #define WRAP_NEWLINE(c, h_val) \
 do { \
@@ -29,8 +37,9 @@ do { \
 static SDL_Window *window = NULL;
 static SDL_Renderer *sdl_renderer = NULL;
 
-static TTF_Font *fonts[7] = {NULL};
-static int font_sizes[7] = {12, 14, 16, 20, 24, 28, 32};
+static int hud_visible = 0;
+static int view_w = WIN_W;
+static int view_h = WIN_H;
 
 typedef struct {
     int x;
@@ -48,8 +57,46 @@ typedef struct {
     int float_l_bottom;
     dom_node *focused;
     int is_dry_run;
+    int force_layout;
+    int floats_l;
+    int floats_r;
+    int width_lo;
+    int width_hi;
+    int estimates;
+    dom_node *virtual_parent;
+    int view_top;
+    int view_bottom;
+    uint64_t deadline;
+    dom_node *target;
+    dom_node *target_block;
+    rect ink;
 } render_ctx;
 
+typedef struct {
+    int x, y, line_h;
+    int left_edge, base_left;
+    int float_r_x, float_r_y, float_r_bottom;
+    int float_l_right, float_l_y, float_l_bottom;
+} flow_state;
+
+#define MEMO_FLOAT_L 1
+#define MEMO_FLOAT_R 2
+
+typedef struct {
+    flow_state entry;
+    flow_state exit;
+    rect ink;
+    int floats;
+    int width_lo, width_hi;
+    int estimated, partial;
+    long est_chars;
+    int est_blocks, est_fixed, est_float;
+    int font_key;
+    int space_w, space_h;
+    int words;
+    int sizes[];
+} layout_memo;
+
 int init_renderer() {
     if (SDL_Init(SDL_INIT_VIDEO) < 0) return -1;
     if (TTF_Init() == -1) return -1;
@@ -57,21 +104,22 @@ int init_renderer() {
         printf("sdl_image init failed: %s\n", IMG_GetError());
     }
 
-    window = SDL_CreateWindow("c browser", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, WIN_W, WIN_H, SDL_WINDOW_SHOWN);
+    window = SDL_CreateWindow("c browser", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, view_w, view_h, SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE);
     if (!window) return -1;
 
     sdl_renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
     if (!sdl_renderer) return -1;
 
     SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_BLEND);
-
-    for (int i = 0; i < 7; i++) {
-        fonts[i] = TTF_OpenFont("font.ttf", font_sizes[i]);
-    }
-
+    SDL_SetWindowMinimumSize(window, MIN_WIN_W, MIN_WIN_H);
     return 0;
 }
 
+void set_viewport(int width, int height) {
+    view_w = width < MIN_WIN_W ? MIN_WIN_W : width;
+    view_h = height < MIN_WIN_H ? MIN_WIN_H : height;
+}
+
 static int is_block(const char *tag) {
     if (!tag) return 0;
     const char *blocks[] = {"div", "p", "h1", "h2", "h3", "h4", "h5", "h6", "ul", "ol", "li", "br", "hr", "table", "tr", "tbody", "thead", "body", "html", "form", "header", "footer", "nav", "section", "main", "aside", "figure", "dt", "dd", "dl", "center", NULL};
@@ -98,118 +146,146 @@ static void expand_rect(dom_node *node, int ex, int ey, int ew, int eh) {
     }
 }
 
-static int get_css_len(dom_node *node, const char *prop, int def, int parent_ref) {
+static void union_rect(rect *r, int x, int y, int w, int h) {
+    if (!w && !h) return;
+    if (!r->w && !r->h) {
+        r->x = x; r->y = y; r->w = w; r->h = h;
+        return;
+    }
+    int right = x + w > r->x + r->w ? x + w : r->x + r->w;
+    int bottom = y + h > r->y + r->h ? y + h : r->y + r->h;
+    if (x < r->x) r->x = x;
+    if (y < r->y) r->y = y;
+    r->w = right - r->x;
+    r->h = bottom - r->y;
+}
+
+static void pin_width(render_ctx *ctx) {
+    ctx->width_lo = ctx->max_w;
+    ctx->width_hi = ctx->max_w;
+}
+
+static int fits_line(render_ctx *ctx, int right) {
+    if (ctx->y >= ctx->float_r_y && ctx->y < ctx->float_r_bottom) return right <= ctx->float_r_x - 20;
+    int fits = right <= ctx->max_w - 20;
+    if (fits && right + 20 > ctx->width_lo) ctx->width_lo = right + 20;
+    if (!fits && right + 19 < ctx->width_hi) ctx->width_hi = right + 19;
+    return fits;
+}
+
+static int line_right(const render_ctx *ctx) {
+    if (ctx->y >= ctx->float_r_y && ctx->y < ctx->float_r_bottom) return ctx->float_r_x - 20;
+    return ctx->max_w - 20;
+}
+
+static int get_css_len(render_ctx *ctx, dom_node *node, const char *prop, int def) {
     const char *val = get_style(node, prop);
     if (!val) return def;
     int num = atoi(val);
     if (strstr(val, "px")) return num;
     if (strstr(val, "em") || strstr(val, "rem")) return num * 16;
-    if (strstr(val, "%")) return (num * parent_ref) / 100;
+    if (strstr(val, "%")) {
+        pin_width(ctx);
+        return (num * ctx->max_w) / 100;
+    }
     return num;
 }
 
-void load_images(dom_node *node, const char *base_url, int download_assets) {
-    if (!node) return;
+static dom_node *image_root = NULL;
+static parsed_url image_base;
+static int image_download_assets = 0;
+static int resize_images = 0;
+
+static void request_image(dom_node *node, int exact_w, int exact_h) {
+    parsed_url target;
+    if (url_resolve(&image_base, node->src, &target) != 0) return;
+    const char *width = get_attribute(node, "width");
+    const char *height = get_attribute(node, "height");
+    image_fit fit = { width ? atoi(width) : 0, height ? atoi(height) : 0, view_w - 30, exact_w, exact_h };
+    image_pool_request(image_root, node, &target, &fit, image_download_assets);
+}
 
-    if (node->tag && strcasecmp(node->tag, "img") == 0 && node->src) {
-        char target_url[8192] = {0};
-
-        if (strncmp(node->src, "http", 4) == 0) {
-            strncpy(target_url, node->src, 8191);
-        } else if (strncmp(node->src, "//", 2) == 0) {
-            snprintf(target_url, sizeof(target_url), "https:%s", node->src);
-        } else if (node->src[0] == '/') {
-            char host[8192] = {0};
-            char *slash = strchr(base_url + 8, '/');
-            if (slash) strncpy(host, base_url, slash - base_url);
-            else strcpy(host, base_url);
-            snprintf(target_url, sizeof(target_url), "%s%s", host, node->src);
-        } else {
-            char base_copy[8192];
-            strncpy(base_copy, base_url, 8191);
-            char *slash = strrchr(base_copy, '/');
-            if (slash && slash > strchr(base_copy, ':') + 2) *(slash+1) = '\0';
-            else strcat(base_copy, "/");
-            snprintf(target_url, 8192, "%s%s", base_copy, node->src);
-        }
-
-        char hostname[8192] = {0};
-        char path[8192] = {0};
-        const char *port = "80";
-        const char *url_start = target_url;
-
-        if (strncmp(url_start, "http://", 7) == 0) url_start += 7;
-            else if (strncmp(url_start, "https://", 8) == 0) { url_start += 8; port = "443"; }
-
-                char *slash = strchr(url_start, '/');
-                if (slash) {
-                    strncpy(hostname, url_start, slash - url_start);
-                    strcpy(path, slash);
-                } else {
-                    strcpy(hostname, url_start);
-                    strcpy(path, "/");
-                }
+static void request_images(dom_node *node) {
+    if (node->tag && strcasecmp(node->tag, "img") == 0 && node->src && !node->texture) request_image(node, 0, 0);
 
-                size_t img_size = 0;
-                char *img_data = fetch_html(hostname, port, path, &img_size);
-
-                if (img_data) {
-                    char *body = strstr(img_data, "\r\n\r\n");
-                    if (body) {
-                        body += 4;
-                        size_t body_len = img_size - (body - img_data);
-
-                        if (download_assets) {
-                            struct stat st = {0};
-                            if (stat("temp_assets", &st) == -1) mkdir("temp_assets", 0700);
-
-                            char filepath[1024];
-                            const char *filename = strrchr(path, '/');
-                            if (!filename || strlen(filename) <= 1) filename = "/img_fallback.png";
-
-                            char clean_filename[256];
-                            strncpy(clean_filename, filename, 255);
-                            clean_filename[255] = '\0';
-                            char *q = strchr(clean_filename, '?');
-                            if (q) *q = '\0';
-
-                            snprintf(filepath, sizeof(filepath), "temp_assets%s", clean_filename);
-                            FILE *f = fopen(filepath, "wb");
-                            if (f) {
-                                fwrite(body, 1, body_len, f);
-                                fclose(f);
-                            }
-                        }
+    for (int i = 0; i < node->child_count; i++) {
+        request_images(node->children[i]);
+    }
+}
 
-                        SDL_RWops *rw = SDL_RWFromMem(body, body_len);
-                        node->texture = IMG_LoadTexture_RW(sdl_renderer, rw, 1);
-                        if (node->texture) {
-                            SDL_QueryTexture((SDL_Texture*)node->texture, NULL, NULL, &node->img_w, &node->img_h);
-                        }
-                    }
-                    free(img_data);
-                }
+void load_images(dom_node *node, const char *base_url, int download_assets) {
+    if (!node || url_parse(base_url, &image_base) != 0) return;
+    image_root = node;
+    image_download_assets = download_assets;
+    request_images(node);
+}
+
+int upload_images(dom_node *root, double budget_ms) {
+    uint64_t start = trace_now_ns();
+    int uploaded = 0;
+    image_result result;
+    while ((trace_now_ns() - start) / 1e6 < budget_ms && image_pool_take(&result) == 0) {
+        dom_node *node = result.node;
+        if (result.root == root && !result.surface) {
+            if (!node->texture && (node->img_w != result.img_w || node->img_h != result.img_h)) {
+                node->img_w = result.img_w;
+                node->img_h = result.img_h;
+                mark_dirty(node, DIRTY_LAYOUT);
+            }
+        } else if (result.root == root) {
+            TRACE_BEGIN("image.upload");
+            SDL_Texture *texture = SDL_CreateTextureFromSurface(sdl_renderer, (SDL_Surface*)result.surface);
+            TRACE_END("image.upload");
+            if (texture) {
+                int resized = !node->texture || node->img_w != result.img_w || node->img_h != result.img_h;
+                if (node->texture) SDL_DestroyTexture((SDL_Texture*)node->texture);
+                node->texture = texture;
+                mark_dirty(node, resized ? DIRTY_LAYOUT : DIRTY_PAINT);
+                node->img_w = result.img_w;
+                node->img_h = result.img_h;
+                node->tex_w = result.box_w;
+                node->tex_h = result.box_h;
+                uploaded++;
+            }
+        }
+        image_pool_release(&result);
     }
+    return uploaded;
+}
 
-    for (int i = 0; i < node->child_count; i++) {
-        load_images(node->children[i], base_url, download_assets);
+static int count_words(const char *text) {
+    int words = 0, i = 0;
+    while (text[i]) {
+        while (text[i] && isspace((unsigned char)text[i])) i++;
+        if (!text[i]) break;
+        int j = 0;
+        while (text[i] && !isspace((unsigned char)text[i]) && j < 1023) { i++; j++; }
+        words++;
     }
+    return words;
 }
 
-static void draw_text(SDL_Renderer *rend, TTF_Font *font, const char *text, SDL_Color color, render_ctx *ctx, dom_node *parent) {
+static void draw_text(SDL_Renderer *rend, TTF_Font *font, int font_key, dom_node *node, SDL_Color color, render_ctx *ctx) {
+    const char *text = node->text;
+    dom_node *parent = node->parent;
+    layout_memo *memo = font ? node->layout_memo : NULL;
+    int cached = memo && memo->font_key == font_key;
     char word[1024];
-    int i = 0, j = 0;
+    int i = 0, j = 0, k = 0;
     int space_w = 0, space_h = 0;
 
-    if (font) TTF_SizeUTF8(font, " ", &space_w, &space_h);
+    if (cached) {
+        space_w = memo->space_w; space_h = memo->space_h;
+    } else if (font) {
+        TTF_SizeUTF8(font, " ", &space_w, &space_h);
+        if (memo) {
+            memo->font_key = font_key;
+            memo->space_w = space_w; memo->space_h = space_h;
+        }
+    }
     if (ctx->line_h < space_h) ctx->line_h = space_h;
 
     while (text[i]) {
-        int right_bound = ctx->max_w - 20;
-        if (ctx->y >= ctx->float_r_y && ctx->y < ctx->float_r_bottom) {
-            right_bound = ctx->float_r_x - 20;
-        }
-
         int has_space = 0;
         while (text[i] && isspace((unsigned char)text[i])) {
             has_space = 1; i++;
@@ -217,13 +293,8 @@ static void draw_text(SDL_Renderer *rend, TTF_Font *font, const char *text, SDL_
 
         if (ctx->x > ctx->left_edge && has_space) {
             ctx->x += space_w;
-            if (ctx->x > right_bound) {
+            if (!fits_line(ctx, ctx->x)) {
                 WRAP_NEWLINE(ctx, space_h);
-                if (ctx->y >= ctx->float_r_y && ctx->y < ctx->float_r_bottom) {
-                    right_bound = ctx->float_r_x - 20;
-                } else {
-                    right_bound = ctx->max_w - 20;
-                }
             }
         }
 
@@ -234,15 +305,17 @@ static void draw_text(SDL_Renderer *rend, TTF_Font *font, const char *text, SDL_
         word[j] = '\0';
 
         int w = 0, h = 0;
-        if (font) TTF_SizeUTF8(font, word, &w, &h);
-
-        if (ctx->y >= ctx->float_r_y && ctx->y < ctx->float_r_bottom) {
-            right_bound = ctx->float_r_x - 20;
-        } else {
-            right_bound = ctx->max_w - 20;
+        if (cached && k < memo->words) {
+            w = memo->sizes[k * 2]; h = memo->sizes[k * 2 + 1];
+        } else if (font) {
+            TTF_SizeUTF8(font, word, &w, &h);
+            if (memo && k < memo->words) {
+                memo->sizes[k * 2] = w; memo->sizes[k * 2 + 1] = h;
+            }
         }
+        k++;
 
-        if (ctx->x + w > right_bound) {
+        if (!fits_line(ctx, ctx->x + w)) {
             WRAP_NEWLINE(ctx, h);
         } else if (h > ctx->line_h) {
             ctx->line_h = h;
@@ -251,7 +324,7 @@ static void draw_text(SDL_Renderer *rend, TTF_Font *font, const char *text, SDL_
         if (font) {
             if (!ctx->is_dry_run) {
                 int draw_y = ctx->y - ctx->scroll_y;
-                if (draw_y + h > 40 && draw_y < WIN_H) {
+                if (draw_y + h > 40 && draw_y < view_h) {
                     SDL_Surface *surf = TTF_RenderUTF8_Blended(font, word, color);
                     if (surf) {
                         SDL_Texture *tex = SDL_CreateTextureFromSurface(rend, surf);
@@ -262,30 +335,84 @@ static void draw_text(SDL_Renderer *rend, TTF_Font *font, const char *text, SDL_
                     }
                 }
             }
-            if (ctx->is_dry_run && parent) expand_rect(parent, ctx->x, ctx->y, w, h);
+            if (ctx->is_dry_run && parent) {
+                expand_rect(parent, ctx->x, ctx->y, w, h);
+                union_rect(&ctx->ink, ctx->x, ctx->y, w, h);
+            }
         }
         ctx->x += w;
     }
 }
 
-static void draw_node(dom_node *node, render_ctx *ctx) {
+static void layout_node(dom_node *node, render_ctx *ctx);
+static void layout_virtual(dom_node *node, render_ctx *ctx);
+static void paint_node(dom_node *node, render_ctx *ctx);
+
+static void clear_dirty(dom_node *node) {
+    unsigned dirty = node->dirty;
+    node->dirty &= ~(DIRTY_STYLE | DIRTY_LAYOUT | DIRTY_CHILD);
+    if (!(dirty & DIRTY_CHILD)) return;
+    for (int i = 0; i < node->child_count; i++) {
+        clear_dirty(node->children[i]);
+    }
+}
+
+static void reset_layouts(dom_node *node) {
     if (!node) return;
+    node->layout.x = 0; node->layout.y = 0;
+    node->layout.w = 0; node->layout.h = 0;
+    node->dirty &= ~(DIRTY_STYLE | DIRTY_LAYOUT | DIRTY_CHILD);
+    for (int i = 0; i < node->child_count; i++) {
+        reset_layouts(node->children[i]);
+    }
+}
 
-    if (node->type == NODE_ELEMENT && node->tag) {
-        const char *display = get_style(node, "display");
-        if (display && strstr(display, "none") != NULL) return;
+static int is_hidden(dom_node *node) {
+    const char *display = get_style(node, "display");
+    if (display && strstr(display, "none") != NULL) return 1;
+
+    if (strcasecmp(node->tag, "input") == 0) {
+        const char *type = get_attribute(node, "type");
+        if (type && strcasecmp(type, "hidden") == 0) return 1;
+    }
+    return strcasecmp(node->tag, "head") == 0 || strcasecmp(node->tag, "style") == 0 || strcasecmp(node->tag, "script") == 0 || strcasecmp(node->tag, "title") == 0;
+}
+
+static int float_side(dom_node *node) {
+    const char *flt = get_style(node, "float");
+    int side = 0;
+    if (flt && strstr(flt, "right") != NULL) side |= MEMO_FLOAT_R;
+    if (flt && strstr(flt, "left") != NULL) side |= MEMO_FLOAT_L;
 
-        if (strcasecmp(node->tag, "input") == 0) {
-            const char *type = get_attribute(node, "type");
-            if (type && strcasecmp(type, "hidden") == 0) return;
+    if (node->tag && strcasecmp(node->tag, "table") == 0) {
+        const char *cls = get_attribute(node, "class");
+        if (cls && strstr(cls, "infobox")) side |= MEMO_FLOAT_R;
+    }
+    if (node->tag) {
+        const char *id = get_attribute(node, "id");
+        const char *cls = get_attribute(node, "class");
+        if (id && (strcmp(id, "vector-main-menu") == 0 || strcmp(id, "mw-panel") == 0 || strcmp(id, "vector-toc") == 0 || strcmp(id, "p-lang") == 0)) {
+            side |= MEMO_FLOAT_L;
         }
-        if (strcasecmp(node->tag, "head") == 0 || strcasecmp(node->tag, "style") == 0 || strcasecmp(node->tag, "script") == 0 || strcasecmp(node->tag, "title") == 0) {
+        if (cls && (strstr(cls, "vector-column-start") || strstr(cls, "vector-toc"))) {
+            side |= MEMO_FLOAT_L;
+        }
+    }
+    return side;
+}
+
+static void draw_node(dom_node *node, render_ctx *ctx) {
+    if (!node) return;
+
+    if (node->type == NODE_ELEMENT && node->tag) {
+        if (is_hidden(node)) {
+            if (ctx->is_dry_run) reset_layouts(node);
             return;
         }
 
         if (!ctx->is_dry_run && node->layout.w > 0 && node->layout.h > 0) {
             SDL_Rect r = { node->layout.x, node->layout.y - ctx->scroll_y, node->layout.w, node->layout.h };
-            if (r.y + r.h > 40 && r.y < WIN_H) {
+            if (r.y + r.h > 40 && r.y < view_h) {
                 const char *bg = get_style(node, "background-color");
                 if (!bg) bg = get_style(node, "background");
                 if (bg && !strstr(bg, "transparent") && !strstr(bg, "none")) {
@@ -304,7 +431,7 @@ static void draw_node(dom_node *node, render_ctx *ctx) {
 
             if (has_border) {
                 SDL_Rect r = { node->layout.x, node->layout.y - ctx->scroll_y, node->layout.w, node->layout.h };
-                if (r.y + r.h > 40 && r.y < WIN_H) {
+                if (r.y + r.h > 40 && r.y < view_h) {
                     SDL_SetRenderDrawColor(sdl_renderer, 200, 200, 200, 255);
                     SDL_RenderDrawRect(sdl_renderer, &r);
                 }
@@ -312,32 +439,17 @@ static void draw_node(dom_node *node, render_ctx *ctx) {
         }
     }
 
-    int mt = get_css_len(node, "margin-top", 0, ctx->max_w);
-    int mb = get_css_len(node, "margin-bottom", 0, ctx->max_w);
-    int ml = get_css_len(node, "margin-left", 0, ctx->max_w);
-    int mr = get_css_len(node, "margin-right", 0, ctx->max_w);
-    int pt = get_css_len(node, "padding-top", 0, ctx->max_w);
-    int pb = get_css_len(node, "padding-bottom", 0, ctx->max_w);
-    int pl = get_css_len(node, "padding-left", 0, ctx->max_w);
+    int mt = get_css_len(ctx, node, "margin-top", 0);
+    int mb = get_css_len(ctx, node, "margin-bottom", 0);
+    int ml = get_css_len(ctx, node, "margin-left", 0);
+    int mr = get_css_len(ctx, node, "margin-right", 0);
+    int pt = get_css_len(ctx, node, "padding-top", 0);
+    int pb = get_css_len(ctx, node, "padding-bottom", 0);
+    int pl = get_css_len(ctx, node, "padding-left", 0);
 
-    const char *flt = get_style(node, "float");
-    int is_float_r = (flt && strstr(flt, "right") != NULL);
-    int is_float_l = (flt && strstr(flt, "left") != NULL);
-
-    if (node->tag && strcasecmp(node->tag, "table") == 0) {
-        const char *cls = get_attribute(node, "class");
-        if (cls && strstr(cls, "infobox")) is_float_r = 1;
-    }
-    if (node->tag) {
-        const char *id = get_attribute(node, "id");
-        const char *cls = get_attribute(node, "class");
-        if (id && (strcmp(id, "vector-main-menu") == 0 || strcmp(id, "mw-panel") == 0 || strcmp(id, "vector-toc") == 0 || strcmp(id, "p-lang") == 0)) {
-            is_float_l = 1;
-        }
-        if (cls && (strstr(cls, "vector-column-start") || strstr(cls, "vector-toc"))) {
-            is_float_l = 1;
-        }
-    }
+    int side = float_side(node);
+    int is_float_r = side & MEMO_FLOAT_R;
+    int is_float_l = side & MEMO_FLOAT_L;
 
     int is_blk = (node->type == NODE_ELEMENT && is_block(node->tag));
 
@@ -381,10 +493,12 @@ static void draw_node(dom_node *node, render_ctx *ctx) {
             ctx->y = ctx->float_r_bottom + 10;
         }
         ctx->float_r_y = ctx->y;
+        ctx->floats_r++;
 
-        int w = get_css_len(node, "width", 300, ctx->max_w);
+        int w = get_css_len(ctx, node, "width", 300);
         if (w == 0) w = 300;
         ctx->float_r_x = ctx->max_w - w - mr;
+        pin_width(ctx);
 
         ctx->base_left = ctx->float_r_x + pl;
         ctx->left_edge = ctx->base_left;
@@ -394,8 +508,9 @@ static void draw_node(dom_node *node, render_ctx *ctx) {
             ctx->y = ctx->float_l_bottom + 10;
         }
         ctx->float_l_y = ctx->y;
+        ctx->floats_l++;
 
-        int w = get_css_len(node, "width", 200, ctx->max_w);
+        int w = get_css_len(ctx, node, "width", 200);
         if (w == 0) w = 200;
         int nx = current_left + w + mr + 20;
         if (nx > ctx->float_l_right) ctx->float_l_right = nx;
@@ -415,11 +530,11 @@ static void draw_node(dom_node *node, render_ctx *ctx) {
 
     if (node->type == NODE_ELEMENT && node->tag) {
         int draw_y = ctx->y - ctx->scroll_y;
-        if (ctx->is_dry_run || (draw_y > -500 && draw_y < WIN_H + 500)) {
+        if (ctx->is_dry_run || (draw_y > -500 && draw_y < view_h + 500)) {
             if (strcasecmp(node->tag, "hr") == 0) {
                 if (!ctx->is_dry_run) {
                     SDL_SetRenderDrawColor(sdl_renderer, 200, 200, 200, 255);
-                    SDL_RenderDrawLine(sdl_renderer, current_left, draw_y + 10, WIN_W - 10, draw_y + 10);
+                    SDL_RenderDrawLine(sdl_renderer, current_left, draw_y + 10, view_w - 10, draw_y + 10);
                 }
                 ctx->y += 20;
             } else if (strcasecmp(node->tag, "input") == 0 || strcasecmp(node->tag, "button") == 0) {
@@ -429,12 +544,11 @@ static void draw_node(dom_node *node, render_ctx *ctx) {
                 if (!label) label = is_btn ? " Submit" : " ";
 
                 int text_w = 0, text_h = 0;
-                TTF_Font *btn_f = fonts[2] ? fonts[2] : fonts[0];
+                TTF_Font *btn_f = font_get(FONT_DEFAULT_PX, TTF_STYLE_NORMAL);
                 if (btn_f && label[0] != '\0') TTF_SizeUTF8(btn_f, label, &text_w, &text_h);
                 int box_w = text_w + 20 < (is_btn ? 80 : 150) ? (is_btn ? 80 : 150) : text_w + 20;
 
-                int right_bound = (ctx->y >= ctx->float_r_y && ctx->y < ctx->float_r_bottom) ? ctx->float_r_x - 20 : ctx->max_w - 20;
-                if (ctx->x + box_w > right_bound) {
+                if (!fits_line(ctx, ctx->x + box_w)) {
                     WRAP_NEWLINE(ctx, 0);
                     draw_y = ctx->y - ctx->scroll_y;
                 }
@@ -472,20 +586,29 @@ static void draw_node(dom_node *node, render_ctx *ctx) {
                 if (ctx->line_h < 28) ctx->line_h = 28;
             } else if (strcasecmp(node->tag, "img") == 0) {
                 int w = 50, h = 30;
-                if (node->texture) {
+                if (node->img_w > 0 && node->img_h > 0) {
                     w = node->img_w; h = node->img_h;
                 }
 
-                int right_bound = (ctx->y >= ctx->float_r_y && ctx->y < ctx->float_r_bottom) ? ctx->float_r_x - 20 : ctx->max_w - 20;
-                if (w > right_bound - ctx->left_edge) { h = h * (right_bound - ctx->left_edge) / w; w = right_bound - ctx->left_edge; }
-                if (ctx->x + w > right_bound) {
+                if (!fits_line(ctx, ctx->left_edge + w)) {
+                    int avail = line_right(ctx) - ctx->left_edge;
+                    h = h * avail / w;
+                    w = avail;
+                    pin_width(ctx);
+                }
+                if (!fits_line(ctx, ctx->x + w)) {
                     WRAP_NEWLINE(ctx, 0);
                     draw_y = ctx->y - ctx->scroll_y;
                 }
 
                 if (ctx->is_dry_run) {
                     expand_rect(node, ctx->x, ctx->y, w, h);
+                    if (resize_images && node->texture && node->src && (w * 4 < node->tex_w * 3 || w * 4 > node->tex_w * 5)) request_image(node, w, h);
                 } else {
+                    if (!node->texture && node->tex_w && node->src && resize_images) {
+                        node->tex_w = node->tex_h = 0;
+                        request_image(node, 0, 0);
+                    }
                     if (node->texture) {
                         SDL_Rect dest = { ctx->x, draw_y, w, h };
                         SDL_RenderCopy(sdl_renderer, (SDL_Texture*)node->texture, NULL, &dest);
@@ -510,38 +633,23 @@ static void draw_node(dom_node *node, render_ctx *ctx) {
     }
 
     if (node->type == NODE_TEXT && node->text) {
-        int font_idx = 2;
+        int font_px = 0;
         int is_bold = 0, is_italic = 0;
         SDL_Color current_color = {30, 30, 30, 255};
 
         dom_node *p = node->parent;
         while (p != NULL && p->tag != NULL) {
-            if (strcasecmp(p->tag, "h1") == 0) { font_idx = 6; is_bold = 1; }
-            else if (strcasecmp(p->tag, "h2") == 0) { font_idx = 5; is_bold = 1; }
-            else if (strcasecmp(p->tag, "h3") == 0) { font_idx = 4; is_bold = 1; }
-            else if (strcasecmp(p->tag, "h4") == 0) { font_idx = 3; is_bold = 1; }
-            else if (strcasecmp(p->tag, "small") == 0) { font_idx = 0; }
+            if (strcasecmp(p->tag, "h1") == 0) { font_px = 32; is_bold = 1; }
+            else if (strcasecmp(p->tag, "h2") == 0) { font_px = 28; is_bold = 1; }
+            else if (strcasecmp(p->tag, "h3") == 0) { font_px = 24; is_bold = 1; }
+            else if (strcasecmp(p->tag, "h4") == 0) { font_px = 20; is_bold = 1; }
+            else if (strcasecmp(p->tag, "small") == 0) { font_px = 12; }
 
             if (strcasecmp(p->tag, "b") == 0 || strcasecmp(p->tag, "strong") == 0 || strcasecmp(p->tag, "th") == 0) is_bold = 1;
             if (strcasecmp(p->tag, "i") == 0 || strcasecmp(p->tag, "em") == 0) is_italic = 1;
             if (strcasecmp(p->tag, "a") == 0) current_color = (SDL_Color){25, 100, 210, 255};
 
-            const char *fs = get_style(p, "font-size");
-            if (fs && font_idx == 2) {
-                float size = atof(fs);
-                if (strstr(fs, "em") || strstr(fs, "rem")) size *= 16.0f;
-                else if (strstr(fs, "%")) size = (size / 100.0f) * 16.0f;
-
-                if (size > 0) {
-                    if (size <= 12) font_idx = 0;
-                    else if (size <= 14) font_idx = 1;
-                    else if (size <= 18) font_idx = 2;
-                    else if (size <= 22) font_idx = 3;
-                    else if (size <= 26) font_idx = 4;
-                    else if (size <= 30) font_idx = 5;
-                    else font_idx = 6;
-                }
-            }
+            if (!font_px) font_px = font_px_from_css(get_style(p, "font-size"));
 
             const char *fw = get_style(p, "font-weight");
             if (fw && (strstr(fw, "bold") || atoi(fw) >= 600)) is_bold = 1;
@@ -554,22 +662,25 @@ static void draw_node(dom_node *node, render_ctx *ctx) {
             p = p->parent;
         }
 
-        TTF_Font *current_font = fonts[font_idx];
-        if (!current_font) current_font = fonts[2];
-        if (!current_font) current_font = fonts[0];
-
         int style = TTF_STYLE_NORMAL;
         if (is_bold) style |= TTF_STYLE_BOLD;
         if (is_italic) style |= TTF_STYLE_ITALIC;
-        if (current_font) TTF_SetFontStyle(current_font, style);
+        if (!font_px) font_px = FONT_DEFAULT_PX;
+        TTF_Font *current_font = font_get(font_px, style);
 
-        draw_text(sdl_renderer, current_font, node->text, current_color, ctx, node->parent);
-
-        if (current_font) TTF_SetFontStyle(current_font, TTF_STYLE_NORMAL);
+        draw_text(sdl_renderer, current_font, font_px << 4 | style, node, current_color, ctx);
     }
 
     for (int i = 0; i < node->child_count; i++) {
-        draw_node(node->children[i], ctx);
+        if (ctx->is_dry_run && node == ctx->virtual_parent) {
+            layout_virtual(node->children[i], ctx);
+            if (node->children[i] == ctx->target_block) {
+                ctx->view_top = ctx->target->layout.y - view_h;
+                ctx->view_bottom = ctx->target->layout.y + 2 * view_h;
+                ctx->target_block = NULL;
+            }
+        } else if (ctx->is_dry_run) layout_node(node->children[i], ctx);
+        else paint_node(node->children[i], ctx);
     }
 
     if (is_float_r) {
@@ -602,16 +713,353 @@ static void draw_node(dom_node *node, render_ctx *ctx) {
     }
 }
 
-static void reset_layouts(dom_node *node) {
-    if (!node) return;
-    node->layout.x = 0; node->layout.y = 0;
-    node->layout.w = 0; node->layout.h = 0;
+static void save_flow(const render_ctx *ctx, flow_state *flow) {
+    flow->x = ctx->x; flow->y = ctx->y; flow->line_h = ctx->line_h;
+    flow->left_edge = ctx->left_edge; flow->base_left = ctx->base_left;
+    flow->float_r_x = ctx->float_r_x; flow->float_r_y = ctx->float_r_y; flow->float_r_bottom = ctx->float_r_bottom;
+    flow->float_l_right = ctx->float_l_right; flow->float_l_y = ctx->float_l_y; flow->float_l_bottom = ctx->float_l_bottom;
+}
+
+static int float_matches(int memo_top, int memo_bottom, int memo_y, int top, int bottom, int y, int dy) {
+    if (memo_bottom <= memo_y && bottom <= y) return 1;
+    return top - memo_top == dy && bottom - memo_bottom == dy;
+}
+
+static int memo_matches(const layout_memo *memo, const render_ctx *ctx, int *dy) {
+    const flow_state *e = &memo->entry;
+    if (ctx->x != e->x || ctx->line_h != e->line_h || ctx->left_edge != e->left_edge || ctx->base_left != e->base_left) return 0;
+    if (ctx->max_w < memo->width_lo || ctx->max_w > memo->width_hi || ctx->float_l_right != e->float_l_right) return 0;
+
+    int d = ctx->y - e->y;
+    if (!float_matches(e->float_r_y, e->float_r_bottom, e->y, ctx->float_r_y, ctx->float_r_bottom, ctx->y, d)) return 0;
+    if (e->float_r_bottom > e->y && ctx->float_r_x != e->float_r_x) return 0;
+    if (!float_matches(e->float_l_y, e->float_l_bottom, e->y, ctx->float_l_y, ctx->float_l_bottom, ctx->y, d)) return 0;
+    *dy = d;
+    return 1;
+}
+
+static void shift_flow(flow_state *flow, int dy) {
+    flow->y += dy;
+    flow->float_r_y += dy; flow->float_r_bottom += dy;
+    flow->float_l_y += dy; flow->float_l_bottom += dy;
+}
+
+static void shift_subtree(dom_node *node, int dy) {
+    if (node->layout.w || node->layout.h) node->layout.y += dy;
+    layout_memo *memo = node->layout_memo;
+    if (memo) {
+        shift_flow(&memo->entry, dy);
+        shift_flow(&memo->exit, dy);
+        if (memo->ink.w || memo->ink.h) memo->ink.y += dy;
+    }
     for (int i = 0; i < node->child_count; i++) {
-        reset_layouts(node->children[i]);
+        shift_subtree(node->children[i], dy);
+    }
+}
+
+static void restore_exit(const layout_memo *memo, render_ctx *ctx) {
+    const flow_state *f = &memo->exit;
+    ctx->x = f->x; ctx->y = f->y; ctx->line_h = f->line_h;
+    ctx->left_edge = f->left_edge; ctx->base_left = f->base_left;
+    if (memo->floats & MEMO_FLOAT_R) {
+        ctx->float_r_x = f->float_r_x; ctx->float_r_y = f->float_r_y; ctx->float_r_bottom = f->float_r_bottom;
+        ctx->floats_r++;
+    }
+    if (memo->floats & MEMO_FLOAT_L) {
+        ctx->float_l_right = f->float_l_right; ctx->float_l_y = f->float_l_y; ctx->float_l_bottom = f->float_l_bottom;
+        ctx->floats_l++;
+    }
+}
+
+static const rect* memo_extent(dom_node *node, const layout_memo *memo) {
+    return node->type == NODE_TEXT ? &memo->ink : &node->layout;
+}
+
+static void layout_node(dom_node *node, render_ctx *ctx) {
+    layout_memo *memo = node->layout_memo;
+    int dy;
+    if (memo && !ctx->force_layout && !memo->estimated && !memo->partial && !(node->dirty & (DIRTY_STYLE | DIRTY_LAYOUT | DIRTY_CHILD)) && memo_matches(memo, ctx, &dy)) {
+        if (dy) shift_subtree(node, dy);
+        restore_exit(memo, ctx);
+        if (memo->width_lo > ctx->width_lo) ctx->width_lo = memo->width_lo;
+        if (memo->width_hi < ctx->width_hi) ctx->width_hi = memo->width_hi;
+        const rect *r = memo_extent(node, memo);
+        if (node->parent && (r->w || r->h)) expand_rect(node->parent, r->x, r->y, r->w, r->h);
+        return;
+    }
+    if (!memo) {
+        int words = node->type == NODE_TEXT && node->text ? count_words(node->text) : 0;
+        memo = node->layout_memo = calloc(1, sizeof(layout_memo) + sizeof(int) * 2 * words);
+        if (memo) memo->words = words;
+    }
+    if (!memo) {
+        draw_node(node, ctx);
+        return;
+    }
+
+    int old_force = ctx->force_layout;
+    int floats_l = ctx->floats_l, floats_r = ctx->floats_r;
+    int width_lo = ctx->width_lo, width_hi = ctx->width_hi;
+    int estimates = ctx->estimates;
+    ctx->width_lo = 0; ctx->width_hi = INT_MAX;
+    if (node->dirty & (DIRTY_STYLE | DIRTY_LAYOUT)) ctx->force_layout = 1;
+    node->dirty &= ~(DIRTY_STYLE | DIRTY_LAYOUT | DIRTY_CHILD);
+    memset(&node->layout, 0, sizeof(rect));
+    save_flow(ctx, &memo->entry);
+
+    memset(&ctx->ink, 0, sizeof(rect));
+    draw_node(node, ctx);
+    memo->ink = ctx->ink;
+
+    save_flow(ctx, &memo->exit);
+    memo->floats = (ctx->floats_l != floats_l ? MEMO_FLOAT_L : 0) | (ctx->floats_r != floats_r ? MEMO_FLOAT_R : 0);
+    memo->width_lo = ctx->width_lo; memo->width_hi = ctx->width_hi;
+    memo->estimated = 0;
+    memo->partial = ctx->estimates != estimates;
+    if (width_lo > ctx->width_lo) ctx->width_lo = width_lo;
+    if (width_hi < ctx->width_hi) ctx->width_hi = width_hi;
+    ctx->force_layout = old_force;
+}
+
+static void discard_layouts(dom_node *node) {
+    for (int i = 0; i < node->child_count; i++) {
+        dom_node *child = node->children[i];
+        memset(&child->layout, 0, sizeof(rect));
+        free(child->layout_memo);
+        child->layout_memo = NULL;
+        discard_layouts(child);
+    }
+}
+
+static void count_content(dom_node *node, layout_memo *memo) {
+    if (node->type == NODE_TEXT) {
+        if (node->text) memo->est_chars += strlen(node->text);
+        return;
+    }
+    if (node->tag) {
+        if (is_hidden(node)) return;
+        if (is_block(node->tag)) memo->est_blocks++;
+        if (strcasecmp(node->tag, "img") == 0) memo->est_fixed += node->img_h > 0 ? node->img_h : 30;
+        else if (strcasecmp(node->tag, "input") == 0 || strcasecmp(node->tag, "button") == 0) memo->est_fixed += 28;
+        else if (strcasecmp(node->tag, "hr") == 0) memo->est_fixed += 20;
+    }
+    for (int i = 0; i < node->child_count; i++) {
+        count_content(node->children[i], memo);
+    }
+}
+
+static int estimate_height(const layout_memo *memo, const render_ctx *ctx) {
+    int avail = line_right(ctx) - ctx->left_edge;
+    if (avail < 100) avail = 100;
+    long lines = memo->est_chars * EST_CHAR_W / avail + memo->est_blocks;
+    return (int)(lines * EST_LINE_H) + memo->est_fixed;
+}
+
+static void layout_virtual(dom_node *node, render_ctx *ctx) {
+    layout_memo *memo = node->layout_memo;
+    int dirty = ctx->force_layout || (node->dirty & (DIRTY_STYLE | DIRTY_LAYOUT | DIRTY_CHILD));
+    int known = memo && memo->estimated && !dirty;
+    if (ctx->deadline && trace_now_ns() >= ctx->deadline) ctx->deadline = 0;
+    if (ctx->deadline || (!known && (node->type != NODE_ELEMENT || !node->tag || !is_block(node->tag) || is_hidden(node)))) {
+        layout_node(node, ctx);
+        return;
+    }
+
+    int dy;
+    if (memo && !memo->estimated && !memo->partial && !dirty && memo_matches(memo, ctx, &dy)) {
+        layout_node(node, ctx);
+        return;
+    }
+    int was_exact = memo && !memo->estimated;
+    if (!memo) memo = node->layout_memo = calloc(1, sizeof(layout_memo));
+    if (!memo) {
+        layout_node(node, ctx);
+        return;
+    }
+
+    if (!known) {
+        memo->est_chars = 0; memo->est_blocks = 0; memo->est_fixed = 0;
+        memo->est_float = float_side(node) != 0;
+        count_content(node, memo);
+    }
+    int top = ctx->y + (ctx->x > ctx->left_edge ? ctx->line_h : 0);
+    int h = estimate_height(memo, ctx);
+    if (top < ctx->view_bottom && top + h > ctx->view_top) {
+        layout_node(node, ctx);
+        return;
+    }
+
+    if (was_exact) discard_layouts(node);
+    clear_dirty(node);
+    save_flow(ctx, &memo->entry);
+    ctx->x = ctx->left_edge;
+    ctx->y = top;
+    ctx->line_h = 0;
+    node->layout.x = ctx->left_edge; node->layout.y = top;
+    node->layout.w = line_right(ctx) > ctx->left_edge ? line_right(ctx) - ctx->left_edge : 1; node->layout.h = h;
+    if (!memo->est_float) ctx->y += h;
+    save_flow(ctx, &memo->exit);
+
+    memset(&memo->ink, 0, sizeof(rect));
+    memo->floats = 0;
+    memo->estimated = 1;
+    memo->partial = 0;
+    memo->width_lo = ctx->max_w; memo->width_hi = ctx->max_w;
+    pin_width(ctx);
+    ctx->estimates++;
+    if (node->parent && h > 0) expand_rect(node->parent, node->layout.x, node->layout.y, node->layout.w, h);
+}
+
+static void paint_node(dom_node *node, render_ctx *ctx) {
+    layout_memo *memo = node->layout_memo;
+    int dy;
+    if (memo && memo->estimated) {
+        restore_exit(memo, ctx);
+        return;
+    }
+    if (memo && memo_matches(memo, ctx, &dy) && dy == 0) {
+        const rect *r = memo_extent(node, memo);
+        int top = memo->entry.y;
+        int bottom = memo->exit.y + memo->exit.line_h;
+        if ((r->w || r->h) && r->y < top) top = r->y;
+        if ((r->w || r->h) && r->y + r->h > bottom) bottom = r->y + r->h;
+        if (bottom - ctx->scroll_y <= 40 || top - ctx->scroll_y >= view_h) {
+            restore_exit(memo, ctx);
+            return;
+        }
+    }
+    node->dirty &= ~DIRTY_PAINT;
+    draw_node(node, ctx);
+}
+
+static void draw_hud_line(TTF_Font *font, const char *line, int bottom) {
+    SDL_Color col = {255, 255, 255, 255};
+    SDL_Surface *surf = TTF_RenderUTF8_Blended(font, line, col);
+    if (!surf) return;
+
+    SDL_Rect box = { view_w - surf->w - 24, bottom - surf->h - 8, surf->w + 12, surf->h + 8 };
+    SDL_SetRenderDrawColor(sdl_renderer, 0, 0, 0, 180);
+    SDL_RenderFillRect(sdl_renderer, &box);
+
+    SDL_Texture *tex = SDL_CreateTextureFromSurface(sdl_renderer, surf);
+    SDL_Rect dest = { box.x + 6, box.y + 4, surf->w, surf->h };
+    SDL_RenderCopy(sdl_renderer, tex, NULL, &dest);
+    SDL_DestroyTexture(tex);
+    SDL_FreeSurface(surf);
+}
+
+static void draw_hud(dom_node *root) {
+    TTF_Font *hud_font = font_get(12, TTF_STYLE_NORMAL);
+    if (!hud_font) return;
+
+    double p50 = 0, p95 = 0, p99 = 0;
+    int samples = frame_stats_percentiles(&p50, &p95, &p99);
+
+    char line[256];
+    snprintf(line, sizeof(line), "frame p50 %.1f ms  p95 %.1f ms  p99 %.1f ms  (%d frames)", p50, p95, p99, samples);
+    draw_hud_line(hud_font, line, view_h - 8);
+
+    mem_stats stats;
+    memstat_measure_tree(root, &stats);
+    snprintf(line, sizeof(line), "mem dom %zu KB  attr %zu KB  style %zu KB  text %zu KB  tex %zu KB  total %zu KB  rss %zu KB",
+             stats.bytes[MEM_DOM_NODES] / 1024, stats.bytes[MEM_ATTRIBUTES] / 1024, stats.bytes[MEM_STYLES] / 1024,
+             stats.bytes[MEM_TEXT] / 1024, stats.bytes[MEM_TEXTURES] / 1024, memstat_total(&stats) / 1024, memstat_rss() / 1024);
+    draw_hud_line(hud_font, line, view_h - 34);
+
+    snprintf(line, sizeof(line), "bfcache %zu KB / %zu KB", history_cached_bytes() / 1024, memstat_budget()->bfcache_bytes / 1024);
+    draw_hud_line(hud_font, line, view_h - 60);
+}
+
+static void init_ctx(render_ctx *ctx, int scroll_y, dom_node *focused_node) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->x = 10; ctx->y = 50; ctx->line_h = 0;
+    ctx->left_edge = 10; ctx->base_left = 10; ctx->max_w = view_w;
+    ctx->scroll_y = scroll_y; ctx->focused = focused_node;
+    ctx->float_r_x = view_w; ctx->float_r_y = 0; ctx->float_r_bottom = 0;
+    ctx->float_l_right = 10; ctx->float_l_y = 0; ctx->float_l_bottom = 0;
+}
+
+static double layout_budget_ms() {
+    const char *val = getenv("BROWSER_LAYOUT_BUDGET_MS");
+    double ms = val ? atof(val) : 0;
+    return ms > 0 ? ms : 4.0;
+}
+
+static int only_whitespace(const char *text) {
+    while (*text && isspace((unsigned char)*text)) text++;
+    return *text == '\0';
+}
+
+static dom_node* flow_container(dom_node *root) {
+    dom_node *container = root;
+    for (int i = 0; i < root->child_count; i++) {
+        dom_node *child = root->children[i];
+        if (child->tag && strcasecmp(child->tag, "body") == 0) container = child;
+    }
+    for (;;) {
+        dom_node *only = NULL;
+        int others = 0;
+        for (int i = 0; i < container->child_count; i++) {
+            dom_node *child = container->children[i];
+            if (child->type == NODE_TEXT && (!child->text || only_whitespace(child->text))) continue;
+            if (child->type == NODE_ELEMENT && child->tag && is_block(child->tag) && !only) only = child;
+            else others++;
+            if (others) break;
+        }
+        if (!only || others) return container;
+        container = only;
+    }
+}
+
+static dom_node* find_anchor(dom_node *container, int scroll_y) {
+    for (int i = 0; i < container->child_count; i++) {
+        dom_node *child = container->children[i];
+        if (child->type == NODE_ELEMENT && child->layout.h > 0 && child->layout.y + child->layout.h > scroll_y + 40) return child;
+    }
+    return NULL;
+}
+
+static int layout_pass(dom_node *root, dom_node *container, int scroll_y, dom_node *target) {
+    resize_images = root == image_root;
+
+    render_ctx ctx;
+    init_ctx(&ctx, 0, NULL);
+    ctx.is_dry_run = 1;
+    if (container) {
+        ctx.virtual_parent = container;
+        ctx.view_top = scroll_y - view_h;
+        ctx.view_bottom = scroll_y + 2 * view_h;
+        ctx.deadline = trace_now_ns() + (uint64_t)(layout_budget_ms() * 1e6);
+        dom_node *block = target;
+        while (block && block->parent != container) block = block->parent;
+        if (block) {
+            ctx.target = target;
+            ctx.target_block = block;
+            ctx.view_top = INT_MIN / 2;
+            ctx.view_bottom = INT_MAX / 2;
+            ctx.deadline = 0;
+        }
     }
+    layout_node(root, &ctx);
+
+    return ctx.y + ctx.line_h;
+}
+
+int layout_tree(dom_node *root) {
+    if (!root) return 0;
+    TRACE_SCOPE("layout");
+    return layout_pass(root, NULL, 0, NULL);
 }
 
-void render_tree(dom_node *root, const char *url_text, int scroll_y, dom_node *focused_node) {
+int layout_target_y(dom_node *root, dom_node *target) {
+    if (!root || !target) return 0;
+    TRACE_SCOPE("layout.target");
+    layout_pass(root, flow_container(root), 0, target);
+    return target->layout.y;
+}
+
+void render_tree(dom_node *root, const char *url_text, int *scroll, dom_node *focused_node) {
+    int scroll_y = scroll ? *scroll : 0;
     SDL_Color bg_color = {250, 250, 250, 255};
     if (root && root->child_count > 0) {
         for (int i = 0; i < root->child_count; i++) {
@@ -628,50 +1076,49 @@ void render_tree(dom_node *root, const char *url_text, int scroll_y, dom_node *f
     SDL_RenderClear(sdl_renderer);
 
     if (root) {
-        reset_layouts(root);
-
-        render_ctx ctx = {0};
-        ctx.x = 10; ctx.y = 50; ctx.line_h = 0;
-        ctx.left_edge = 10; ctx.base_left = 10; ctx.max_w = WIN_W;
-        ctx.scroll_y = scroll_y; ctx.focused = focused_node;
-        ctx.float_r_x = WIN_W; ctx.float_r_y = 0; ctx.float_r_bottom = 0;
-        ctx.float_l_right = 10; ctx.float_l_y = 0; ctx.float_l_bottom = 0;
-
-        ctx.is_dry_run = 1;
-        draw_node(root, &ctx);
-
-        int total_height = ctx.y + ctx.line_h;
-
-        ctx.x = 10; ctx.y = 50; ctx.line_h = 0;
-        ctx.left_edge = 10; ctx.base_left = 10;
-        ctx.float_r_x = WIN_W; ctx.float_r_y = 0; ctx.float_r_bottom = 0;
-        ctx.float_l_right = 10; ctx.float_l_y = 0; ctx.float_l_bottom = 0;
-        ctx.is_dry_run = 0;
-        draw_node(root, &ctx);
-
-        if (total_height > WIN_H - 40) {
-            float ratio = (float)(WIN_H - 40) / total_height;
-            int sb_h = (int)((WIN_H - 40) * ratio);
+        dom_node *container = flow_container(root);
+        dom_node *anchor = scroll_y > 0 ? find_anchor(container, scroll_y) : NULL;
+        int anchor_y = anchor ? anchor->layout.y : 0;
+
+        TRACE_BEGIN("layout");
+        int total_height = layout_pass(root, container, scroll_y, NULL);
+        TRACE_END("layout");
+
+        if (anchor && anchor->layout.h > 0 && anchor->layout.y != anchor_y) {
+            scroll_y += anchor->layout.y - anchor_y;
+            if (scroll_y < 0) scroll_y = 0;
+            if (scroll) *scroll = scroll_y;
+        }
+
+        TRACE_BEGIN("paint");
+        render_ctx ctx;
+        init_ctx(&ctx, scroll_y, focused_node);
+        paint_node(root, &ctx);
+        TRACE_END("paint");
+
+        if (total_height > view_h - 40) {
+            float ratio = (float)(view_h - 40) / total_height;
+            int sb_h = (int)((view_h - 40) * ratio);
             if (sb_h < 20) sb_h = 20;
             int sb_y = 40 + (int)(scroll_y * ratio);
-            if (sb_y + sb_h > WIN_H) sb_y = WIN_H - sb_h;
-            SDL_Rect sb_rect = {WIN_W - 10, sb_y, 8, sb_h};
+            if (sb_y + sb_h > view_h) sb_y = view_h - sb_h;
+            SDL_Rect sb_rect = {view_w - 10, sb_y, 8, sb_h};
             SDL_SetRenderDrawColor(sdl_renderer, 180, 180, 180, 255);
             SDL_RenderFillRect(sdl_renderer, &sb_rect);
         }
     }
 
-    SDL_Rect top_bar = {0, 0, WIN_W, 40};
+    SDL_Rect top_bar = {0, 0, view_w, 40};
     SDL_SetRenderDrawColor(sdl_renderer, 235, 235, 235, 255);
     SDL_RenderFillRect(sdl_renderer, &top_bar);
 
-    SDL_Rect url_box = {10, 6, WIN_W - 20, 28};
+    SDL_Rect url_box = {10, 6, view_w - 20, 28};
     SDL_SetRenderDrawColor(sdl_renderer, 255, 255, 255, 255);
     SDL_RenderFillRect(sdl_renderer, &url_box);
     SDL_SetRenderDrawColor(sdl_renderer, 200, 200, 200, 255);
     SDL_RenderDrawRect(sdl_renderer, &url_box);
 
-    TTF_Font *ui_font = fonts[2] ? fonts[2] : fonts[0];
+    TTF_Font *ui_font = font_get(FONT_DEFAULT_PX, TTF_STYLE_NORMAL);
     if (ui_font && url_text) {
         int text_w = 0;
         if (url_text[0] != '\0') {
@@ -681,11 +1128,11 @@ void render_tree(dom_node *root, const char *url_text, int scroll_y, dom_node *f
                 SDL_Texture *texture = SDL_CreateTextureFromSurface(sdl_renderer, surface);
                 SDL_Rect dest = { 18, 11, surface->w, surface->h };
                 text_w = surface->w;
-                if (dest.w > WIN_W - 40) {
-                    SDL_Rect src = {surface->w - (WIN_W - 40), 0, WIN_W - 40, surface->h};
-                    dest.w = WIN_W - 40;
+                if (dest.w > view_w - 40) {
+                    SDL_Rect src = {surface->w - (view_w - 40), 0, view_w - 40, surface->h};
+                    dest.w = view_w - 40;
                     SDL_RenderCopy(sdl_renderer, texture, &src, &dest);
-                    text_w = WIN_W - 40;
+                    text_w = view_w - 40;
                 } else {
                     SDL_RenderCopy(sdl_renderer, texture, NULL, &dest);
                 }
@@ -699,9 +1146,20 @@ void render_tree(dom_node *root, const char *url_text, int scroll_y, dom_node *f
             SDL_RenderDrawLine(sdl_renderer, cx, 11, cx, 28);
         }
     }
+
+    if (hud_visible) draw_hud(root);
+
     SDL_RenderPresent(sdl_renderer);
 }
 
+void set_hud_visible(int visible) {
+    hud_visible = visible;
+}
+
+int is_hud_visible() {
+    return hud_visible;
+}
+
 void free_textures(dom_node *node) {
     if (!node) return;
     if (node->texture) {
@@ -713,10 +1171,83 @@ void free_textures(dom_node *node) {
     }
 }
 
-void cleanup_renderer() {
-    for (int i = 0; i < 7; i++) {
-        if (fonts[i]) TTF_CloseFont(fonts[i]);
+typedef struct {
+    dom_node *node;
+    int distance;
+} texture_ref;
+
+static void collect_textures(dom_node *node, texture_ref **refs, int *count, int *cap, int view_center) {
+    if (!node) return;
+    if (node->texture) {
+        if (*count >= *cap) {
+            *cap = *cap ? *cap * 2 : 64;
+            *refs = realloc(*refs, sizeof(texture_ref) * (*cap));
+        }
+        int mid = node->layout.y + node->layout.h / 2;
+        (*refs)[*count].node = node;
+        (*refs)[*count].distance = mid > view_center ? mid - view_center : view_center - mid;
+        (*count)++;
+    }
+    for (int i = 0; i < node->child_count; i++) {
+        collect_textures(node->children[i], refs, count, cap, view_center);
+    }
+}
+
+static int compare_distance_desc(const void *a, const void *b) {
+    return ((const texture_ref*)b)->distance - ((const texture_ref*)a)->distance;
+}
+
+static void drop_hidden_styles(dom_node *node, int hidden) {
+    if (!node) return;
+    if (hidden) {
+        clear_styles(node);
+    } else if (node->type == NODE_ELEMENT) {
+        const char *display = get_style(node, "display");
+        if (display && strstr(display, "none") != NULL) hidden = 1;
     }
+    for (int i = 0; i < node->child_count; i++) {
+        drop_hidden_styles(node->children[i], hidden);
+    }
+}
+
+void enforce_memory_budget(dom_node *root, int scroll_y) {
+    if (!root) return;
+    const mem_budget *budget = memstat_budget();
+
+    mem_stats stats;
+    memstat_measure_tree(root, &stats);
+    for (int i = 0; i < MEM_CATEGORY_COUNT; i++) {
+        TRACE_COUNTER(memstat_category_name(i), (long)stats.bytes[i]);
+    }
+
+    if (stats.bytes[MEM_TEXTURES] > budget->texture_bytes) {
+        texture_ref *refs = NULL;
+        int count = 0, cap = 0;
+        collect_textures(root, &refs, &count, &cap, scroll_y + view_h / 2);
+        qsort(refs, count, sizeof(texture_ref), compare_distance_desc);
+
+        size_t tex_bytes = stats.bytes[MEM_TEXTURES];
+        int evicted = 0;
+        for (int i = 0; i < count && tex_bytes > budget->texture_bytes; i++) {
+            dom_node *n = refs[i].node;
+            if (n->layout.y < scroll_y + view_h && n->layout.y + n->layout.h > scroll_y) continue;
+            tex_bytes -= (size_t)n->tex_w * n->tex_h * 4;
+            SDL_DestroyTexture((SDL_Texture*)n->texture);
+            n->texture = NULL;
+            evicted++;
+        }
+        free(refs);
+        printf("texture budget exceeded, evicted %d images\n", evicted);
+    }
+
+    if (memstat_total(&stats) > budget->document_bytes) {
+        printf("document budget exceeded, dropping styles of hidden subtrees\n");
+        drop_hidden_styles(root, 0);
+    }
+}
+
+void cleanup_renderer() {
+    font_cache_shutdown();
     if (sdl_renderer) SDL_DestroyRenderer(sdl_renderer);
     if (window) SDL_DestroyWindow(window);
     IMG_Quit();
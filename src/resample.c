@@ -0,0 +1,168 @@
+#include <stdlib.h>
+#include <string.h>
+#include "resample.h"
+
+#if !defined(RESAMPLE_SCALAR) && defined(__SSE2__)
+#define RESAMPLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+typedef struct {
+    int start;
+    int count;
+    const float *weights;
+} span;
+
+static span* build_spans(int src, int dst, float **weight_store) {
+    double scale = (double)src / dst;
+    int max_count = (int)scale + 2;
+    span *spans = malloc(sizeof(span) * dst);
+    float *weights = malloc(sizeof(float) * dst * max_count);
+
+    for (int d = 0; d < dst; d++) {
+        double lo = d * scale;
+        double hi = lo + scale;
+        int first = (int)lo;
+        int last = (int)hi;
+        if ((double)last == hi) last--;
+        if (last >= src) last = src - 1;
+        if (first > last) first = last;
+
+        float *w = weights + (size_t)d * max_count;
+        float total = 0;
+        for (int s = first; s <= last; s++) {
+            double a = s > lo ? s : lo;
+            double b = s + 1 < hi ? s + 1 : hi;
+            w[s - first] = (float)((b - a) / scale);
+            total += w[s - first];
+        }
+        for (int s = first; s <= last && total > 0; s++) w[s - first] /= total;
+
+        spans[d].start = first;
+        spans[d].count = last - first + 1;
+        spans[d].weights = w;
+    }
+    *weight_store = weights;
+    return spans;
+}
+
+#if defined(RESAMPLE_SSE2)
+static inline __m128 load_premultiplied(uint32_t px) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int)px), zero), zero);
+    __m128 f = _mm_cvtepi32_ps(v);
+    __m128 alpha = _mm_shuffle_ps(f, f, _MM_SHUFFLE(3, 3, 3, 3));
+    __m128 factor = _mm_add_ps(_mm_mul_ps(alpha, _mm_set_ps(0, 1.0f / 255, 1.0f / 255, 1.0f / 255)), _mm_set_ps(1, 0, 0, 0));
+    return _mm_mul_ps(f, factor);
+}
+
+static void resample_row(const uint32_t *src, const span *spans, int dw, float *out) {
+    for (int d = 0; d < dw; d++) {
+        const span *sp = &spans[d];
+        __m128 acc = _mm_setzero_ps();
+        for (int i = 0; i < sp->count; i++) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(load_premultiplied(src[sp->start + i]), _mm_set1_ps(sp->weights[i])));
+        }
+        _mm_storeu_ps(out + d * 4, acc);
+    }
+}
+
+static void accumulate_row(float *acc, const float *row, float weight, int floats) {
+    __m128 w = _mm_set1_ps(weight);
+    for (int i = 0; i < floats; i += 4) {
+        _mm_storeu_ps(acc + i, _mm_add_ps(_mm_loadu_ps(acc + i), _mm_mul_ps(_mm_loadu_ps(row + i), w)));
+    }
+}
+
+static void store_row(const float *acc, uint32_t *dst, int dw) {
+    __m128 zero = _mm_setzero_ps();
+    for (int d = 0; d < dw; d++) {
+        __m128 f = _mm_loadu_ps(acc + d * 4);
+        __m128 alpha = _mm_shuffle_ps(f, f, _MM_SHUFFLE(3, 3, 3, 3));
+        __m128 has_alpha = _mm_cmpgt_ps(alpha, zero);
+        __m128 factor = _mm_div_ps(_mm_set1_ps(255.0f), _mm_max_ps(alpha, _mm_set1_ps(1e-6f)));
+        factor = _mm_and_ps(factor, has_alpha);
+        factor = _mm_add_ps(_mm_mul_ps(factor, _mm_set_ps(0, 1, 1, 1)), _mm_set_ps(1, 0, 0, 0));
+        __m128i v = _mm_cvtps_epi32(_mm_mul_ps(f, factor));
+        v = _mm_packs_epi32(v, v);
+        v = _mm_packus_epi16(v, v);
+        dst[d] = (uint32_t)_mm_cvtsi128_si32(v);
+    }
+}
+#else
+static void resample_row(const uint32_t *src, const span *spans, int dw, float *out) {
+    for (int d = 0; d < dw; d++) {
+        const span *sp = &spans[d];
+        float acc[4] = {0, 0, 0, 0};
+        for (int i = 0; i < sp->count; i++) {
+            uint32_t px = src[sp->start + i];
+            float a = (float)(px >> 24);
+            float w = sp->weights[i];
+            float premul = w * a / 255.0f;
+            acc[0] += (float)(px & 0xff) * premul;
+            acc[1] += (float)((px >> 8) & 0xff) * premul;
+            acc[2] += (float)((px >> 16) & 0xff) * premul;
+            acc[3] += a * w;
+        }
+        memcpy(out + d * 4, acc, sizeof(acc));
+    }
+}
+
+static void accumulate_row(float *acc, const float *row, float weight, int floats) {
+    for (int i = 0; i < floats; i++) acc[i] += row[i] * weight;
+}
+
+static uint32_t clamp_channel(float v) {
+    int c = (int)(v + 0.5f);
+    return c < 0 ? 0 : c > 255 ? 255 : (uint32_t)c;
+}
+
+static void store_row(const float *acc, uint32_t *dst, int dw) {
+    for (int d = 0; d < dw; d++) {
+        const float *f = acc + d * 4;
+        float factor = f[3] > 0 ? 255.0f / f[3] : 0;
+        dst[d] = clamp_channel(f[0] * factor) | clamp_channel(f[1] * factor) << 8 | clamp_channel(f[2] * factor) << 16 | clamp_channel(f[3]) << 24;
+    }
+}
+#endif
+
+int resample_box(const uint32_t *src, int sw, int sh, int src_pitch, uint32_t *dst, int dw, int dh, int dst_pitch) {
+    if (sw <= 0 || sh <= 0 || dw <= 0 || dh <= 0) return -1;
+
+    float *h_weights, *v_weights;
+    span *h_spans = build_spans(sw, dw, &h_weights);
+    span *v_spans = build_spans(sh, dh, &v_weights);
+
+    int floats = dw * 4;
+    float *acc = malloc(sizeof(float) * floats);
+    float *last_row = malloc(sizeof(float) * floats);
+    float *scratch = malloc(sizeof(float) * floats);
+    int last_sy = -1;
+
+    for (int dy = 0; dy < dh; dy++) {
+        const span *sp = &v_spans[dy];
+        memset(acc, 0, sizeof(float) * floats);
+        for (int i = 0; i < sp->count; i++) {
+            int sy = sp->start + i;
+            const float *row = last_row;
+            if (sy != last_sy) {
+                int keep = i == sp->count - 1;
+                float *into = keep ? last_row : scratch;
+                resample_row((const uint32_t*)((const char*)src + (size_t)sy * src_pitch), h_spans, dw, into);
+                if (keep) last_sy = sy;
+                row = into;
+            }
+            accumulate_row(acc, row, sp->weights[i], floats);
+        }
+        store_row(acc, (uint32_t*)((char*)dst + (size_t)dy * dst_pitch), dw);
+    }
+
+    free(acc);
+    free(last_row);
+    free(scratch);
+    free(h_spans);
+    free(h_weights);
+    free(v_spans);
+    free(v_weights);
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <string.h>
+#include <strings.h>
+#include "scan.h"
+
+#if !defined(SCAN_SCALAR) && defined(__AVX2__)
+#define SCAN_AVX2 1
+#include <immintrin.h>
+#endif
+#if !defined(SCAN_SCALAR) && defined(__SSE2__)
+#define SCAN_SSE2 1
+#include <emmintrin.h>
+#endif
+
+static inline int is_special(const char *p, const char *end) {
+    unsigned char c = (unsigned char)*p;
+    if (c == '&') return 1;
+    if (!scan_is_space(c)) return 0;
+    return c != ' ' || (p + 1 < end && scan_is_space((unsigned char)p[1]));
+}
+
+#if defined(SCAN_AVX2)
+static inline __m256i space_mask_256(__m256i v) {
+    __m256i ctrl = _mm256_cmpeq_epi8(_mm256_subs_epu8(_mm256_sub_epi8(v, _mm256_set1_epi8(9)), _mm256_set1_epi8(4)), _mm256_setzero_si256());
+    return _mm256_or_si256(ctrl, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+}
+#endif
+
+#if defined(SCAN_SSE2)
+static inline __m128i space_mask_128(__m128i v) {
+    __m128i ctrl = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(v, _mm_set1_epi8(9)), _mm_set1_epi8(4)), _mm_setzero_si128());
+    return _mm_or_si128(ctrl, _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+}
+#endif
+
+const char* scan_text_special(const char *p, const char *end) {
+#if defined(SCAN_AVX2)
+    while (p + 33 <= end) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)p);
+        __m256i next = _mm256_loadu_si256((const __m256i*)(p + 1));
+        __m256i ws = space_mask_256(v);
+        __m256i ws_next = space_mask_256(next);
+        __m256i space = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+        __m256i hit = _mm256_or_si256(_mm256_andnot_si256(space, ws), _mm256_and_si256(ws, ws_next));
+        hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('&')));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(hit);
+        if (mask) return p + __builtin_ctz(mask);
+        p += 32;
+    }
+#endif
+#if defined(SCAN_SSE2)
+    while (p + 17 <= end) {
+        __m128i v = _mm_loadu_si128((const __m128i*)p);
+        __m128i next = _mm_loadu_si128((const __m128i*)(p + 1));
+        __m128i ws = space_mask_128(v);
+        __m128i ws_next = space_mask_128(next);
+        __m128i space = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+        __m128i hit = _mm_or_si128(_mm_andnot_si128(space, ws), _mm_and_si128(ws, ws_next));
+        hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('&')));
+        int mask = _mm_movemask_epi8(hit);
+        if (mask) return p + __builtin_ctz(mask);
+        p += 16;
+    }
+#endif
+    while (p < end && !is_special(p, end)) p++;
+    return p;
+}
+
+const char* scan_end_tag(const char *p, const char *end, const char *tag) {
+    size_t tag_len = strlen(tag);
+    while (p < end) {
+        const char *lt = memchr(p, '<', end - p);
+        if (!lt) return end;
+        const char *name = lt + 2;
+        if (name + tag_len <= end && lt[1] == '/' && strncasecmp(name, tag, tag_len) == 0) {
+            const char *after = name + tag_len;
+            if (after == end || *after == '>' || *after == '/' || scan_is_space((unsigned char)*after)) return lt;
+        }
+        p = lt + 1;
+    }
+    return end;
+}
@@ -0,0 +1,377 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "snapshot.h"
+#include "trace.h"
+
+typedef struct {
+    snapshot_node *nodes;
+    uint32_t node_count, node_cap;
+    snapshot_pair *attrs;
+    uint32_t attr_count, attr_cap;
+    snapshot_pair *styles;
+    uint32_t style_count, style_cap;
+    uint32_t *assets;
+    uint32_t asset_count, asset_cap;
+    char *pool;
+    uint32_t pool_size, pool_cap;
+    uint32_t *slots;
+    uint32_t slot_count, slot_used;
+    parsed_url base;
+    int has_base;
+} snapshot_builder;
+
+static uint64_t fnv1a(const char *s, size_t len) {
+    uint64_t h = 1469598103934665603ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)s[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static const char* snapshot_dir() {
+    const char *dir = getenv("BROWSER_SNAPSHOT_DIR");
+    return dir && *dir ? dir : "snapshots";
+}
+
+void snapshot_path(const char *url, char *out, size_t size) {
+    snprintf(out, size, "%s/%016llx.bdom", snapshot_dir(), (unsigned long long)fnv1a(url, strlen(url)));
+}
+
+void snapshot_session_path(char *out, size_t size) {
+    snprintf(out, size, "%s/session", snapshot_dir());
+}
+
+int snapshot_read_header(const char *path, snapshot_header *out) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return -1;
+    int ok = fread(out, sizeof(*out), 1, f) == 1;
+    fclose(f);
+    if (!ok || memcmp(out->magic, SNAPSHOT_MAGIC, 4) != 0 || out->version != SNAPSHOT_VERSION) return -1;
+    return 0;
+}
+
+static void* grow(void *data, uint32_t *cap, uint32_t need, size_t elem) {
+    if (need <= *cap) return data;
+    uint32_t next = *cap ? *cap : 64;
+    while (next < need) next *= 2;
+    *cap = next;
+    return realloc(data, (size_t)next * elem);
+}
+
+static void rehash(snapshot_builder *b) {
+    uint32_t old_count = b->slot_count;
+    uint32_t *old = b->slots;
+    b->slot_count = old_count ? old_count * 2 : 1024;
+    b->slots = malloc(sizeof(uint32_t) * b->slot_count);
+    memset(b->slots, 0xFF, sizeof(uint32_t) * b->slot_count);
+    for (uint32_t i = 0; i < old_count; i++) {
+        if (old[i] == SNAPSHOT_NONE) continue;
+        const char *s = b->pool + old[i];
+        uint32_t slot = (uint32_t)fnv1a(s, strlen(s)) & (b->slot_count - 1);
+        while (b->slots[slot] != SNAPSHOT_NONE) slot = (slot + 1) & (b->slot_count - 1);
+        b->slots[slot] = old[i];
+    }
+    free(old);
+}
+
+static uint32_t intern(snapshot_builder *b, const char *s) {
+    if (!s) return SNAPSHOT_NONE;
+    if (b->slot_used * 2 >= b->slot_count) rehash(b);
+
+    size_t len = strlen(s);
+    uint32_t slot = (uint32_t)fnv1a(s, len) & (b->slot_count - 1);
+    while (b->slots[slot] != SNAPSHOT_NONE) {
+        if (strcmp(b->pool + b->slots[slot], s) == 0) return b->slots[slot];
+        slot = (slot + 1) & (b->slot_count - 1);
+    }
+
+    uint32_t offset = b->pool_size;
+    b->pool = grow(b->pool, &b->pool_cap, b->pool_size + (uint32_t)len + 1, 1);
+    memcpy(b->pool + offset, s, len + 1);
+    b->pool_size += (uint32_t)len + 1;
+    b->slots[slot] = offset;
+    b->slot_used++;
+    return offset;
+}
+
+static void add_asset(snapshot_builder *b, const char *src) {
+    parsed_url target;
+    if (!b->has_base || url_resolve(&b->base, src, &target) != 0) return;
+    char resolved[URL_MAX];
+    url_format(&target, resolved, sizeof(resolved));
+
+    uint32_t offset = intern(b, resolved);
+    for (uint32_t i = 0; i < b->asset_count; i++) {
+        if (b->assets[i] == offset) return;
+    }
+    b->assets = grow(b->assets, &b->asset_cap, b->asset_count + 1, sizeof(uint32_t));
+    b->assets[b->asset_count++] = offset;
+}
+
+static void add_node(snapshot_builder *b, dom_node *node, uint32_t parent) {
+    uint32_t index = b->node_count;
+    b->nodes = grow(b->nodes, &b->node_cap, index + 1, sizeof(snapshot_node));
+    b->node_count++;
+
+    snapshot_node rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.type = node->type;
+    rec.parent = parent;
+    rec.tag = intern(b, node->tag);
+    rec.text = intern(b, node->text);
+    rec.href = intern(b, node->href);
+    rec.src = intern(b, node->src);
+    rec.img_w = node->img_w;
+    rec.img_h = node->img_h;
+    rec.x = node->layout.x;
+    rec.y = node->layout.y;
+    rec.w = node->layout.w;
+    rec.h = node->layout.h;
+    rec.child_count = node->child_count;
+
+    rec.first_attr = b->attr_count;
+    rec.attr_count = node->attr_count;
+    b->attrs = grow(b->attrs, &b->attr_cap, b->attr_count + node->attr_count, sizeof(snapshot_pair));
+    for (int i = 0; i < node->attr_count; i++) {
+        b->attrs[b->attr_count].name = intern(b, node->attributes[i].name);
+        b->attrs[b->attr_count].value = intern(b, node->attributes[i].value);
+        b->attr_count++;
+    }
+
+    rec.first_style = b->style_count;
+    rec.style_count = node->style_count;
+    b->styles = grow(b->styles, &b->style_cap, b->style_count + node->style_count, sizeof(snapshot_pair));
+    for (int i = 0; i < node->style_count; i++) {
+        b->styles[b->style_count].name = intern(b, node->styles[i].name);
+        b->styles[b->style_count].value = intern(b, node->styles[i].value);
+        b->style_count++;
+    }
+
+    if (node->src) add_asset(b, node->src);
+    b->nodes[index] = rec;
+
+    for (int i = 0; i < node->child_count; i++) {
+        add_node(b, node->children[i], index);
+    }
+}
+
+static void builder_free(snapshot_builder *b) {
+    free(b->nodes);
+    free(b->attrs);
+    free(b->styles);
+    free(b->assets);
+    free(b->pool);
+    free(b->slots);
+}
+
+int snapshot_save(const char *path, dom_node *root, const char *url, int scroll_y, int64_t expires) {
+    if (!root || !url) return -1;
+    TRACE_SCOPE("snapshot.save");
+
+    snapshot_builder b;
+    memset(&b, 0, sizeof(b));
+    b.has_base = url_parse(url, &b.base) == 0;
+
+    snapshot_header h;
+    memset(&h, 0, sizeof(h));
+    h.url = intern(&b, url);
+    add_node(&b, root, SNAPSHOT_NONE);
+
+    memcpy(h.magic, SNAPSHOT_MAGIC, 4);
+    h.version = SNAPSHOT_VERSION;
+    h.header_size = sizeof(snapshot_header);
+    h.node_count = b.node_count;
+    h.attr_count = b.attr_count;
+    h.style_count = b.style_count;
+    h.asset_count = b.asset_count;
+    h.pool_size = b.pool_size;
+    h.scroll_y = scroll_y;
+    h.saved_at = (int64_t)time(NULL);
+    h.expires = expires;
+    h.node_offset = sizeof(snapshot_header);
+    h.attr_offset = h.node_offset + b.node_count * sizeof(snapshot_node);
+    h.style_offset = h.attr_offset + b.attr_count * sizeof(snapshot_pair);
+    h.asset_offset = h.style_offset + b.style_count * sizeof(snapshot_pair);
+    h.pool_offset = h.asset_offset + b.asset_count * sizeof(uint32_t);
+
+    mkdir(snapshot_dir(), 0700);
+    char tmp_path[1024];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    FILE *f = fopen(tmp_path, "wb");
+    if (!f) {
+        builder_free(&b);
+        return -1;
+    }
+
+    int ok = fwrite(&h, sizeof(h), 1, f) == 1;
+    ok = ok && fwrite(b.nodes, sizeof(snapshot_node), b.node_count, f) == b.node_count;
+    ok = ok && fwrite(b.attrs, sizeof(snapshot_pair), b.attr_count, f) == b.attr_count;
+    ok = ok && fwrite(b.styles, sizeof(snapshot_pair), b.style_count, f) == b.style_count;
+    ok = ok && fwrite(b.assets, sizeof(uint32_t), b.asset_count, f) == b.asset_count;
+    ok = ok && fwrite(b.pool, 1, b.pool_size, f) == b.pool_size;
+    ok = (fclose(f) == 0) && ok;
+    builder_free(&b);
+
+    if (!ok || rename(tmp_path, path) != 0) {
+        unlink(tmp_path);
+        return -1;
+    }
+    return 0;
+}
+
+static int range_ok(uint64_t offset, uint64_t count, size_t elem, size_t file_size) {
+    return offset + count * elem <= file_size;
+}
+
+static int str_ok(const snapshot_header *h, uint32_t off) {
+    return off == SNAPSHOT_NONE || off < h->pool_size;
+}
+
+static char* pool_dup(const char *pool, uint32_t off) {
+    return off == SNAPSHOT_NONE ? NULL : strdup(pool + off);
+}
+
+static dom_node* build_tree(const snapshot_header *h, const unsigned char *base) {
+    const snapshot_node *nodes = (const snapshot_node*)(base + h->node_offset);
+    const snapshot_pair *attrs = (const snapshot_pair*)(base + h->attr_offset);
+    const snapshot_pair *styles = (const snapshot_pair*)(base + h->style_offset);
+    const char *pool = (const char*)(base + h->pool_offset);
+
+    dom_node **built = malloc(sizeof(dom_node*) * h->node_count);
+    dom_node *root = NULL;
+
+    for (uint32_t i = 0; i < h->node_count; i++) {
+        const snapshot_node *rec = &nodes[i];
+        int valid = (i == 0) == (rec->parent == SNAPSHOT_NONE) && (i == 0 || rec->parent < i);
+        valid = valid && (rec->type == NODE_ELEMENT || rec->type == NODE_TEXT);
+        valid = valid && str_ok(h, rec->tag) && str_ok(h, rec->text) && str_ok(h, rec->href) && str_ok(h, rec->src);
+        valid = valid && (uint64_t)rec->first_attr + rec->attr_count <= h->attr_count;
+        valid = valid && (uint64_t)rec->first_style + rec->style_count <= h->style_count;
+        valid = valid && rec->child_count < h->node_count;
+        if (valid && i > 0) {
+            dom_node *parent = built[rec->parent];
+            valid = parent->type == NODE_ELEMENT && parent->child_count < parent->child_capacity;
+        }
+        for (uint32_t a = 0; valid && a < rec->attr_count; a++) {
+            valid = attrs[rec->first_attr + a].name != SNAPSHOT_NONE && str_ok(h, attrs[rec->first_attr + a].name) && str_ok(h, attrs[rec->first_attr + a].value);
+        }
+        for (uint32_t s = 0; valid && s < rec->style_count; s++) {
+            valid = styles[rec->first_style + s].name != SNAPSHOT_NONE && styles[rec->first_style + s].value != SNAPSHOT_NONE &&
+                str_ok(h, styles[rec->first_style + s].name) && str_ok(h, styles[rec->first_style + s].value);
+        }
+        if (!valid) {
+            if (root) free_tree(root);
+            free(built);
+            return NULL;
+        }
+
+        dom_node *node = calloc(1, sizeof(dom_node));
+        node->type = rec->type;
+        node->tag = pool_dup(pool, rec->tag);
+        node->text = pool_dup(pool, rec->text);
+        node->href = pool_dup(pool, rec->href);
+        node->src = pool_dup(pool, rec->src);
+        node->img_w = rec->img_w;
+        node->img_h = rec->img_h;
+        node->layout.x = rec->x;
+        node->layout.y = rec->y;
+        node->layout.w = rec->w;
+        node->layout.h = rec->h;
+
+        if (node->type == NODE_ELEMENT) {
+            node->child_capacity = rec->child_count > 4 ? rec->child_count : 4;
+            node->children = malloc(sizeof(dom_node*) * node->child_capacity);
+            node->attr_capacity = rec->attr_count > 2 ? rec->attr_count : 2;
+            node->attributes = malloc(sizeof(dom_attr) * node->attr_capacity);
+            node->style_capacity = rec->style_count > 2 ? rec->style_count : 2;
+            node->styles = malloc(sizeof(css_prop) * node->style_capacity);
+        } else {
+            node->attr_capacity = rec->attr_count;
+            node->attributes = rec->attr_count ? malloc(sizeof(dom_attr) * rec->attr_count) : NULL;
+            node->style_capacity = rec->style_count;
+            node->styles = rec->style_count ? malloc(sizeof(css_prop) * rec->style_count) : NULL;
+        }
+        for (uint32_t a = 0; a < rec->attr_count; a++) {
+            node->attributes[a].name = pool_dup(pool, attrs[rec->first_attr + a].name);
+            node->attributes[a].value = pool_dup(pool, attrs[rec->first_attr + a].value);
+        }
+        node->attr_count = rec->attr_count;
+        for (uint32_t s = 0; s < rec->style_count; s++) {
+            node->styles[s].name = pool_dup(pool, styles[rec->first_style + s].name);
+            node->styles[s].value = pool_dup(pool, styles[rec->first_style + s].value);
+        }
+        node->style_count = rec->style_count;
+
+        built[i] = node;
+        if (i == 0) {
+            root = node;
+        } else {
+            node->parent = built[rec->parent];
+            node->parent->children[node->parent->child_count++] = node;
+        }
+    }
+
+    free(built);
+    return root;
+}
+
+int snapshot_load(const char *path, snapshot_doc *out) {
+    memset(out, 0, sizeof(*out));
+    TRACE_SCOPE("snapshot.load");
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(snapshot_header)) {
+        close(fd);
+        return -1;
+    }
+    size_t size = st.st_size;
+    const unsigned char *base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return -1;
+
+    const snapshot_header *h = (const snapshot_header*)base;
+    int valid = memcmp(h->magic, SNAPSHOT_MAGIC, 4) == 0 && h->version == SNAPSHOT_VERSION && h->header_size == sizeof(snapshot_header);
+    valid = valid && h->node_count > 0 && h->pool_size > 0;
+    valid = valid && range_ok(h->node_offset, h->node_count, sizeof(snapshot_node), size);
+    valid = valid && range_ok(h->attr_offset, h->attr_count, sizeof(snapshot_pair), size);
+    valid = valid && range_ok(h->style_offset, h->style_count, sizeof(snapshot_pair), size);
+    valid = valid && range_ok(h->asset_offset, h->asset_count, sizeof(uint32_t), size);
+    valid = valid && range_ok(h->pool_offset, h->pool_size, 1, size);
+    valid = valid && h->node_offset % 4 == 0 && h->attr_offset % 4 == 0 && h->style_offset % 4 == 0 && h->asset_offset % 4 == 0;
+    valid = valid && base[h->pool_offset + h->pool_size - 1] == '\0';
+    valid = valid && h->url != SNAPSHOT_NONE && str_ok(h, h->url);
+
+    const uint32_t *assets = (const uint32_t*)(base + h->asset_offset);
+    for (uint32_t i = 0; valid && i < h->asset_count; i++) valid = assets[i] != SNAPSHOT_NONE && str_ok(h, assets[i]);
+
+    if (valid) out->tree = build_tree(h, base);
+    if (out->tree) {
+        const char *pool = (const char*)(base + h->pool_offset);
+        strncpy(out->url, pool + h->url, URL_MAX - 1);
+        out->scroll_y = h->scroll_y;
+        out->saved_at = h->saved_at;
+        out->expires = h->expires;
+        out->asset_count = h->asset_count;
+        out->assets = calloc(h->asset_count + 1, sizeof(char*));
+        for (uint32_t i = 0; i < h->asset_count; i++) out->assets[i] = strdup(pool + assets[i]);
+    }
+
+    munmap((void*)base, size);
+    return out->tree ? 0 : -1;
+}
+
+void snapshot_doc_free(snapshot_doc *doc) {
+    if (doc->tree) free_tree(doc->tree);
+    for (int i = 0; i < doc->asset_count; i++) free(doc->assets[i]);
+    free(doc->assets);
+    memset(doc, 0, sizeof(*doc));
+}
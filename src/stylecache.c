@@ -0,0 +1,255 @@
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <stdint.h>
+#include "stylecache.h"
+
+typedef struct {
+    const char *cls;
+    const char *style;
+    int has_id;
+} share_attrs;
+
+typedef struct {
+    dom_node *node;
+    dom_node *parent_origin;
+    share_attrs attrs;
+    uint32_t key;
+} share_entry;
+
+typedef struct {
+    dom_node *node;
+    dom_node *origin;
+} origin_slot;
+
+struct style_share_cache {
+    share_entry entries[STYLE_SHARE_SLOTS];
+    int count;
+    share_entry last;
+    int disabled;
+    const char **attributes;
+    origin_slot *origins;
+    int origin_cap, origin_count;
+    long hits, misses;
+};
+
+static uint32_t fnv_bytes(uint32_t h, const char *s, size_t len, int fold) {
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = s[i];
+        if (fold && c >= 'A' && c <= 'Z') c += 'a' - 'A';
+        h ^= c;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint32_t fnv_str(uint32_t h, const char *s, int fold) {
+    return s ? fnv_bytes(h, s, strlen(s), fold) : h;
+}
+
+static uint32_t mix(uint32_t h, uint32_t v) {
+    return (h ^ v) * 16777619u;
+}
+
+static uint32_t hash_pointer(const void *p) {
+    uintptr_t v = (uintptr_t)p;
+    return mix(mix(2166136261u, (uint32_t)v), (uint32_t)(v >> 32));
+}
+
+static uint32_t class_set_hash(const char *cls) {
+    uint32_t sum = 0;
+    const char *p = cls;
+    while (p && *p) {
+        while (*p && isspace((unsigned char)*p)) p++;
+        const char *start = p;
+        while (*p && !isspace((unsigned char)*p)) p++;
+        if (p > start) sum += fnv_bytes(2166136261u, start, p - start, 0);
+    }
+    return sum;
+}
+
+static int has_class(const char *cls, const char *token, size_t len) {
+    const char *p = cls;
+    while (p && *p) {
+        while (*p && isspace((unsigned char)*p)) p++;
+        const char *start = p;
+        while (*p && !isspace((unsigned char)*p)) p++;
+        if ((size_t)(p - start) == len && memcmp(start, token, len) == 0) return 1;
+    }
+    return 0;
+}
+
+static int class_subset(const char *a, const char *b) {
+    const char *p = a;
+    while (p && *p) {
+        while (*p && isspace((unsigned char)*p)) p++;
+        const char *start = p;
+        while (*p && !isspace((unsigned char)*p)) p++;
+        if (p > start && !has_class(b, start, p - start)) return 0;
+    }
+    return 1;
+}
+
+static int same_classes(const char *a, const char *b) {
+    if (!a || !b) return class_set_hash(a ? a : b) == 0;
+    if (strcmp(a, b) == 0) return 1;
+    return class_subset(a, b) && class_subset(b, a);
+}
+
+static int same_string(const char *a, const char *b) {
+    if (!a || !b) return a == b;
+    return strcmp(a, b) == 0;
+}
+
+static const dom_attr* find_attribute(dom_node *node, const char *name) {
+    for (int i = 0; i < node->attr_count; i++) {
+        if (node->attributes[i].name && strcasecmp(node->attributes[i].name, name) == 0) return &node->attributes[i];
+    }
+    return NULL;
+}
+
+static int same_attribute(dom_node *a, dom_node *b, const char *name) {
+    const dom_attr *x = find_attribute(a, name);
+    const dom_attr *y = find_attribute(b, name);
+    if (!x || !y) return x == y;
+    if (strcasecmp(name, "class") == 0) return same_classes(x->value, y->value);
+    return same_string(x->value, y->value);
+}
+
+static int same_attributes(style_share_cache *cache, dom_node *a, dom_node *b) {
+    if (cache->attributes) {
+        for (const char **name = cache->attributes; *name; name++) {
+            if (!same_attribute(a, b, *name)) return 0;
+        }
+        return same_attribute(a, b, "type");
+    }
+    if (a->attr_count != b->attr_count) return 0;
+    for (int i = 0; i < a->attr_count; i++) {
+        if (a->attributes[i].name && !same_attribute(a, b, a->attributes[i].name)) return 0;
+    }
+    return 1;
+}
+
+static void scan_attributes(dom_node *node, share_attrs *out) {
+    memset(out, 0, sizeof(*out));
+    for (int i = 0; i < node->attr_count; i++) {
+        const char *name = node->attributes[i].name;
+        if (!name || !strchr("iIcCsS", name[0])) continue;
+        if (strcasecmp(name, "id") == 0) out->has_id = 1;
+        else if (strcasecmp(name, "class") == 0) out->cls = node->attributes[i].value;
+        else if (strcasecmp(name, "style") == 0) out->style = node->attributes[i].value;
+    }
+}
+
+static int shareable(dom_node *node, share_attrs *attrs) {
+    if (node->type != NODE_ELEMENT || !node->tag || !node->parent) return 0;
+    scan_attributes(node, attrs);
+    return !attrs->has_id;
+}
+
+static dom_node* origin_of(style_share_cache *cache, dom_node *node) {
+    if (!cache->origin_count) return node;
+    int slot = hash_pointer(node) & (cache->origin_cap - 1);
+    for (; cache->origins[slot].node; slot = (slot + 1) & (cache->origin_cap - 1)) {
+        if (cache->origins[slot].node == node) return cache->origins[slot].origin;
+    }
+    return node;
+}
+
+static void put_origin(origin_slot *slots, int cap, dom_node *node, dom_node *origin) {
+    int slot = hash_pointer(node) & (cap - 1);
+    while (slots[slot].node && slots[slot].node != node) slot = (slot + 1) & (cap - 1);
+    slots[slot].node = node;
+    slots[slot].origin = origin;
+}
+
+static void record_origin(style_share_cache *cache, dom_node *node, dom_node *origin) {
+    if ((cache->origin_count + 1) * 2 > cache->origin_cap) {
+        int cap = cache->origin_cap ? cache->origin_cap * 2 : 256;
+        origin_slot *slots = calloc(cap, sizeof(origin_slot));
+        if (!slots) return;
+        for (int i = 0; i < cache->origin_cap; i++) {
+            if (cache->origins[i].node) put_origin(slots, cap, cache->origins[i].node, cache->origins[i].origin);
+        }
+        free(cache->origins);
+        cache->origins = slots;
+        cache->origin_cap = cap;
+    }
+    put_origin(cache->origins, cache->origin_cap, node, origin);
+    cache->origin_count++;
+}
+
+static int probe(style_share_cache *cache, dom_node *node, int reuse) {
+    if (reuse && cache->last.node == node) return 1;
+    share_entry *e = &cache->last;
+    if (cache->disabled || !shareable(node, &e->attrs)) {
+        e->node = NULL;
+        return 0;
+    }
+
+    e->node = node;
+    e->parent_origin = origin_of(cache, node->parent);
+    uint32_t h = fnv_str(2166136261u, node->tag, 1);
+    h = mix(h, class_set_hash(e->attrs.cls));
+    h = mix(h, fnv_str(2166136261u, e->attrs.style, 0));
+    if (!cache->attributes) h = mix(h, node->attr_count);
+    e->key = mix(h, hash_pointer(e->parent_origin));
+    return 1;
+}
+
+static int can_share(style_share_cache *cache, const share_entry *probe, const share_entry *candidate) {
+    if (probe->key != candidate->key || probe->parent_origin != candidate->parent_origin) return 0;
+    dom_node *node = probe->node, *other = candidate->node;
+    if (strcasecmp(node->tag, other->tag) != 0) return 0;
+    if (!same_classes(probe->attrs.cls, candidate->attrs.cls)) return 0;
+    if (!same_string(probe->attrs.style, candidate->attrs.style)) return 0;
+    return same_attributes(cache, node, other);
+}
+
+style_share_cache* style_share_new(int structural, const char **attributes) {
+    style_share_cache *cache = calloc(1, sizeof(style_share_cache));
+    if (!cache) return NULL;
+    cache->disabled = structural;
+    cache->attributes = attributes;
+    return cache;
+}
+
+int style_share_lookup(style_share_cache *cache, dom_node *node) {
+    if (!cache || !node || !probe(cache, node, 0)) return 0;
+
+    for (int i = 0; i < cache->count; i++) {
+        share_entry *e = &cache->entries[i];
+        if (!can_share(cache, &cache->last, e)) continue;
+
+        copy_styles(node, e->node);
+        record_origin(cache, node, origin_of(cache, e->node));
+        share_entry hit = *e;
+        memmove(&cache->entries[1], &cache->entries[0], sizeof(share_entry) * i);
+        cache->entries[0] = hit;
+        cache->hits++;
+        return 1;
+    }
+    cache->misses++;
+    return 0;
+}
+
+void style_share_insert(style_share_cache *cache, dom_node *node) {
+    if (!cache || !node || !probe(cache, node, 1)) return;
+
+    int keep = cache->count < STYLE_SHARE_SLOTS ? cache->count : STYLE_SHARE_SLOTS - 1;
+    memmove(&cache->entries[1], &cache->entries[0], sizeof(share_entry) * keep);
+    cache->entries[0] = cache->last;
+    cache->count = keep + 1;
+}
+
+void style_share_stats(const style_share_cache *cache, long *hits, long *misses) {
+    if (hits) *hits = cache ? cache->hits : 0;
+    if (misses) *misses = cache ? cache->misses : 0;
+}
+
+void style_share_free(style_share_cache *cache) {
+    if (!cache) return;
+    free(cache->origins);
+    free(cache);
+}
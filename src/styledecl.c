@@ -0,0 +1,204 @@
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include "styledecl.h"
+
+struct style_decl_table {
+    style_decls **slots;
+    int cap;
+    int count;
+};
+
+static uint32_t hash_text(const char *s) {
+    uint32_t h = 2166136261u;
+    for (; *s; s++) {
+        h ^= (unsigned char)*s;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static const char* declaration_end(const char *p) {
+    char quote = 0;
+    int depth = 0;
+    for (; *p; p++) {
+        if (quote) {
+            if (*p == '\\' && p[1]) p++;
+            else if (*p == quote) quote = 0;
+        } else if (*p == '"' || *p == '\'') {
+            quote = *p;
+        } else if (*p == '(') {
+            depth++;
+        } else if (*p == ')' && depth > 0) {
+            depth--;
+        } else if (*p == ';' && depth == 0) {
+            break;
+        }
+    }
+    return p;
+}
+
+static void trim(const char **start, const char **end) {
+    while (*start < *end && isspace((unsigned char)**start)) (*start)++;
+    while (*end > *start && isspace((unsigned char)(*end)[-1])) (*end)--;
+}
+
+static int strip_important(const char *start, const char **end) {
+    const char *bang = *end;
+    while (bang > start && bang[-1] != '!') bang--;
+    if (bang == start) return 0;
+    const char *word = bang;
+    const char *word_end = *end;
+    trim(&word, &word_end);
+    if (word_end - word != 9 || strncasecmp(word, "important", 9) != 0) return 0;
+    *end = bang - 1;
+    trim(&start, end);
+    return 1;
+}
+
+static void add_declaration(style_decls *decls, int *cap, const char *name, size_t name_len, const char *value, size_t value_len, int important) {
+    for (int i = 0; i < decls->count; i++) {
+        if (strlen(decls->props[i].name) == name_len && strncasecmp(decls->props[i].name, name, name_len) == 0) {
+            if (decls->important[i] && !important) return;
+            free(decls->props[i].value);
+            decls->props[i].value = strndup(value, value_len);
+            decls->important[i] = important;
+            return;
+        }
+    }
+    if (decls->count == *cap) {
+        *cap = *cap ? *cap * 2 : 4;
+        decls->props = realloc(decls->props, sizeof(css_prop) * *cap);
+        decls->important = realloc(decls->important, *cap);
+    }
+    char *lower = strndup(name, name_len);
+    for (char *c = lower; *c; c++) *c = tolower((unsigned char)*c);
+    decls->props[decls->count].name = lower;
+    decls->props[decls->count].value = strndup(value, value_len);
+    decls->important[decls->count] = important;
+    decls->count++;
+}
+
+static style_decls* parse_declarations(const char *text, uint32_t hash) {
+    style_decls *decls = calloc(1, sizeof(style_decls));
+    decls->refs = 1;
+    decls->hash = hash;
+    decls->source = strdup(text);
+
+    int cap = 0;
+    const char *p = text;
+    while (*p) {
+        const char *end = declaration_end(p);
+        const char *colon = memchr(p, ':', end - p);
+        if (colon) {
+            const char *name = p, *name_end = colon;
+            const char *value = colon + 1, *value_end = end;
+            trim(&name, &name_end);
+            trim(&value, &value_end);
+            int important = strip_important(value, &value_end);
+            if (name_end > name && value_end > value) {
+                add_declaration(decls, &cap, name, name_end - name, value, value_end - value, important);
+            }
+        }
+        p = *end ? end + 1 : end;
+    }
+    if (decls->count < cap) {
+        decls->props = realloc(decls->props, sizeof(css_prop) * (decls->count ? decls->count : 1));
+        decls->important = realloc(decls->important, decls->count ? decls->count : 1);
+    }
+    return decls;
+}
+
+style_decl_table* style_decl_table_new() {
+    style_decl_table *table = calloc(1, sizeof(style_decl_table));
+    table->cap = 64;
+    table->slots = calloc(table->cap, sizeof(style_decls*));
+    return table;
+}
+
+static void table_grow(style_decl_table *table) {
+    int cap = table->cap * 2;
+    style_decls **slots = calloc(cap, sizeof(style_decls*));
+    for (int i = 0; i < table->cap; i++) {
+        style_decls *decls = table->slots[i];
+        if (!decls) continue;
+        int slot = decls->hash & (cap - 1);
+        while (slots[slot]) slot = (slot + 1) & (cap - 1);
+        slots[slot] = decls;
+    }
+    free(table->slots);
+    table->slots = slots;
+    table->cap = cap;
+}
+
+style_decls* style_decls_intern(style_decl_table *table, const char *text) {
+    if (!text) return NULL;
+    uint32_t hash = hash_text(text);
+    if (!table) return parse_declarations(text, hash);
+
+    int slot = hash & (table->cap - 1);
+    for (style_decls *decls; (decls = table->slots[slot]); slot = (slot + 1) & (table->cap - 1)) {
+        if (decls->hash == hash && strcmp(decls->source, text) == 0) return style_decls_retain(decls);
+    }
+
+    style_decls *decls = parse_declarations(text, hash);
+    style_decls_retain(decls);
+    table->slots[slot] = decls;
+    if (++table->count * 2 > table->cap) table_grow(table);
+    return decls;
+}
+
+style_decls* style_decls_retain(style_decls *decls) {
+    if (decls) __atomic_fetch_add(&decls->refs, 1, __ATOMIC_RELAXED);
+    return decls;
+}
+
+void style_decls_release(style_decls *decls) {
+    if (!decls || __atomic_sub_fetch(&decls->refs, 1, __ATOMIC_ACQ_REL) > 0) return;
+    for (int i = 0; i < decls->count; i++) {
+        free(decls->props[i].name);
+        free(decls->props[i].value);
+    }
+    free(decls->props);
+    free(decls->important);
+    free(decls->source);
+    free(decls);
+}
+
+const char* style_decls_get(const style_decls *decls, const char *name) {
+    if (!decls) return NULL;
+    for (int i = 0; i < decls->count; i++) {
+        if (strcasecmp(decls->props[i].name, name) == 0) return decls->props[i].value;
+    }
+    return NULL;
+}
+
+style_decls* style_decls_of(dom_node *node, style_decl_table *table) {
+    if (!node) return NULL;
+    if (!node->inline_style) node->inline_style = style_decls_intern(table, get_attribute(node, "style"));
+    return node->inline_style;
+}
+
+void style_decls_apply(dom_node *node, const style_decls *decls, int important) {
+    if (!node || !decls) return;
+    for (int i = 0; i < decls->count; i++) {
+        if (decls->important[i] == important) set_style(node, decls->props[i].name, decls->props[i].value);
+    }
+}
+
+size_t style_decls_bytes(const style_decls *decls) {
+    if (!decls) return 0;
+    size_t bytes = sizeof(style_decls) + (sizeof(css_prop) + 1) * decls->count + strlen(decls->source) + 1;
+    for (int i = 0; i < decls->count; i++) {
+        bytes += strlen(decls->props[i].name) + strlen(decls->props[i].value) + 2;
+    }
+    return bytes;
+}
+
+void style_decl_table_free(style_decl_table *table) {
+    if (!table) return;
+    for (int i = 0; i < table->cap; i++) style_decls_release(table->slots[i]);
+    free(table->slots);
+    free(table);
+}
@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "trace.h"
+
+#define TRACE_RING_SIZE 65536
+#define FRAME_RING_SIZE 240
+
+typedef struct {
+    const char *name;
+    uint64_t ts;
+    long value;
+    char phase;
+} trace_event;
+
+typedef struct trace_buffer {
+    trace_event *events;
+    size_t count;
+    long tid;
+    struct trace_buffer *next;
+} trace_buffer;
+
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static trace_buffer *buffers = NULL;
+static uint64_t trace_epoch = 0;
+
+static double frame_ring[FRAME_RING_SIZE];
+static int frame_count = 0;
+static int frame_pos = 0;
+
+uint64_t trace_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+#ifdef ENABLE_TRACE
+
+static __thread trace_buffer *local_buffer = NULL;
+
+static trace_buffer* get_buffer(void) {
+    if (local_buffer) return local_buffer;
+
+    trace_buffer *buf = calloc(1, sizeof(trace_buffer));
+    buf->events = malloc(sizeof(trace_event) * TRACE_RING_SIZE);
+    buf->tid = (long)syscall(SYS_gettid);
+
+    pthread_mutex_lock(&trace_lock);
+    if (trace_epoch == 0) trace_epoch = trace_now_ns();
+    buf->next = buffers;
+    buffers = buf;
+    pthread_mutex_unlock(&trace_lock);
+
+    local_buffer = buf;
+    return buf;
+}
+
+static void record(const char *name, char phase, long value) {
+    trace_buffer *buf = get_buffer();
+    trace_event *ev = &buf->events[buf->count % TRACE_RING_SIZE];
+    ev->name = name;
+    ev->ts = trace_now_ns();
+    ev->value = value;
+    ev->phase = phase;
+    buf->count++;
+}
+
+void trace_begin(const char *name) {
+    record(name, 'B', 0);
+}
+
+void trace_end(const char *name) {
+    record(name, 'E', 0);
+}
+
+void trace_counter(const char *name, long value) {
+    record(name, 'C', value);
+}
+
+void trace_scope_end(const char **name) {
+    record(*name, 'E', 0);
+}
+
+#endif
+
+int trace_export(const char *path) {
+    FILE *f = fopen(path, "w");
+    if (!f) return -1;
+
+    fprintf(f, "{\"traceEvents\":[\n");
+    int first = 1;
+
+    pthread_mutex_lock(&trace_lock);
+    for (trace_buffer *buf = buffers; buf; buf = buf->next) {
+        size_t start = buf->count > TRACE_RING_SIZE ? buf->count - TRACE_RING_SIZE : 0;
+        for (size_t i = start; i < buf->count; i++) {
+            trace_event *ev = &buf->events[i % TRACE_RING_SIZE];
+            double ts_us = (double)(ev->ts - trace_epoch) / 1000.0;
+            fprintf(f, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%ld,\"tid\":%ld",
+                    first ? "" : ",\n", ev->name, ev->phase, ts_us, (long)getpid(), buf->tid);
+            if (ev->phase == 'C') fprintf(f, ",\"args\":{\"value\":%ld}", ev->value);
+            fprintf(f, "}");
+            first = 0;
+        }
+    }
+    pthread_mutex_unlock(&trace_lock);
+
+    fprintf(f, "\n]}\n");
+    fclose(f);
+    return 0;
+}
+
+void frame_stats_add(double frame_ms) {
+    frame_ring[frame_pos] = frame_ms;
+    frame_pos = (frame_pos + 1) % FRAME_RING_SIZE;
+    if (frame_count < FRAME_RING_SIZE) frame_count++;
+}
+
+static int compare_double(const void *a, const void *b) {
+    double da = *(const double*)a, db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+int frame_stats_percentiles(double *p50, double *p95, double *p99) {
+    if (frame_count == 0) return 0;
+
+    double sorted[FRAME_RING_SIZE];
+    memcpy(sorted, frame_ring, sizeof(double) * frame_count);
+    qsort(sorted, frame_count, sizeof(double), compare_double);
+
+    *p50 = sorted[(frame_count - 1) * 50 / 100];
+    *p95 = sorted[(frame_count - 1) * 95 / 100];
+    *p99 = sorted[(frame_count - 1) * 99 / 100];
+    return frame_count;
+}
@@ -0,0 +1,230 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include "treepool.h"
+
+typedef struct {
+    pthread_mutex_t lock;
+    dom_node **tasks;
+    int head, tail, cap;
+} task_deque;
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t run_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_wake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pool_idle = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t task_ready = PTHREAD_COND_INITIALIZER;
+static pthread_once_t workers_once = PTHREAD_ONCE_INIT;
+static pthread_t workers[TREE_POOL_MAX_THREADS];
+static task_deque deques[TREE_POOL_MAX_THREADS];
+static int worker_count = 0;
+static int configured_threads = 0;
+static int active_threads = 0;
+static int busy_workers = 0;
+static unsigned generation = 0;
+static int stopping = 0;
+
+static tree_visit_fn job_visit = NULL;
+static void *job_user = NULL;
+static long pending = 0;
+static int parked = 0;
+
+static void push_task(task_deque *d, dom_node *node) {
+    pthread_mutex_lock(&d->lock);
+    if (d->tail == d->cap) {
+        if (d->head > 0) {
+            memmove(d->tasks, d->tasks + d->head, sizeof(dom_node*) * (d->tail - d->head));
+            d->tail -= d->head;
+            d->head = 0;
+        } else {
+            d->cap = d->cap ? d->cap * 2 : 256;
+            d->tasks = realloc(d->tasks, sizeof(dom_node*) * d->cap);
+        }
+    }
+    d->tasks[d->tail++] = node;
+    pthread_mutex_unlock(&d->lock);
+}
+
+static void wake_parked() {
+    if (__atomic_load_n(&parked, __ATOMIC_SEQ_CST) == 0) return;
+    pthread_mutex_lock(&pool_lock);
+    pthread_cond_broadcast(&task_ready);
+    pthread_mutex_unlock(&pool_lock);
+}
+
+static void park(int self) {
+    pthread_mutex_lock(&pool_lock);
+    __atomic_fetch_add(&parked, 1, __ATOMIC_SEQ_CST);
+    int idle = 1;
+    for (int i = 0; i < active_threads && idle; i++) {
+        task_deque *d = &deques[(self + i) % active_threads];
+        pthread_mutex_lock(&d->lock);
+        idle = d->tail == d->head;
+        pthread_mutex_unlock(&d->lock);
+    }
+    if (idle && __atomic_load_n(&pending, __ATOMIC_SEQ_CST) > 0) pthread_cond_wait(&task_ready, &pool_lock);
+    __atomic_fetch_sub(&parked, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&pool_lock);
+}
+
+static dom_node* pop_task(task_deque *d) {
+    dom_node *node = NULL;
+    pthread_mutex_lock(&d->lock);
+    if (d->tail > d->head) node = d->tasks[--d->tail];
+    if (d->tail == d->head) d->head = d->tail = 0;
+    pthread_mutex_unlock(&d->lock);
+    return node;
+}
+
+static dom_node* steal_task(task_deque *d) {
+    dom_node *node = NULL;
+    pthread_mutex_lock(&d->lock);
+    if (d->tail > d->head) node = d->tasks[d->head++];
+    if (d->tail == d->head) d->head = d->tail = 0;
+    pthread_mutex_unlock(&d->lock);
+    return node;
+}
+
+static dom_node* find_task(int self) {
+    dom_node *node = pop_task(&deques[self]);
+    for (int i = 1; !node && i < active_threads; i++) {
+        node = steal_task(&deques[(self + i) % active_threads]);
+    }
+    return node;
+}
+
+static void run_tasks(int self) {
+    task_deque *own = &deques[self];
+    int misses = 0;
+    for (;;) {
+        dom_node *node = find_task(self);
+        if (!node) {
+            if (__atomic_load_n(&pending, __ATOMIC_ACQUIRE) == 0) return;
+            if (++misses < TREE_POOL_SPINS) sched_yield();
+            else park(self);
+            continue;
+        }
+        misses = 0;
+
+        job_visit(node, job_user);
+        if (node->child_count > 0) {
+            __atomic_fetch_add(&pending, node->child_count, __ATOMIC_RELAXED);
+            for (int i = node->child_count - 1; i >= 0; i--) push_task(own, node->children[i]);
+            wake_parked();
+        }
+        if (__atomic_sub_fetch(&pending, 1, __ATOMIC_SEQ_CST) == 0) wake_parked();
+    }
+}
+
+static void* worker_main(void *arg) {
+    int self = (int)(intptr_t)arg;
+    unsigned seen = 0;
+    pthread_mutex_lock(&pool_lock);
+    while (!stopping) {
+        if (generation == seen) {
+            pthread_cond_wait(&pool_wake, &pool_lock);
+            continue;
+        }
+        seen = generation;
+        if (self >= active_threads) continue;
+
+        busy_workers++;
+        pthread_mutex_unlock(&pool_lock);
+        run_tasks(self);
+        pthread_mutex_lock(&pool_lock);
+        if (--busy_workers == 0) pthread_cond_broadcast(&pool_idle);
+    }
+    pthread_mutex_unlock(&pool_lock);
+    return NULL;
+}
+
+int tree_pool_threads() {
+    if (!configured_threads) {
+        const char *val = getenv("BROWSER_STYLE_THREADS");
+        long threads = val ? atol(val) : sysconf(_SC_NPROCESSORS_ONLN);
+        configured_threads = threads < 1 ? 1 : threads > TREE_POOL_MAX_THREADS ? TREE_POOL_MAX_THREADS : (int)threads;
+    }
+    return configured_threads;
+}
+
+void tree_pool_set_threads(int threads) {
+    configured_threads = threads < 1 ? 1 : threads > TREE_POOL_MAX_THREADS ? TREE_POOL_MAX_THREADS : threads;
+}
+
+static void start_workers() {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int wanted = tree_pool_threads() > cores ? tree_pool_threads() : (int)cores;
+    if (wanted > TREE_POOL_MAX_THREADS) wanted = TREE_POOL_MAX_THREADS;
+    for (int i = 0; i < TREE_POOL_MAX_THREADS; i++) pthread_mutex_init(&deques[i].lock, NULL);
+    for (int i = 1; i < wanted; i++) {
+        if (pthread_create(&workers[worker_count], NULL, worker_main, (void*)(intptr_t)(worker_count + 1)) != 0) break;
+        worker_count++;
+    }
+}
+
+static void visit_serial(dom_node *root, tree_visit_fn visit, void *user) {
+    int cap = 256, count = 0;
+    dom_node **stack = malloc(sizeof(dom_node*) * cap);
+    if (!stack) return;
+    stack[count++] = root;
+    while (count > 0) {
+        dom_node *node = stack[--count];
+        visit(node, user);
+        if (count + node->child_count > cap) {
+            while (count + node->child_count > cap) cap *= 2;
+            dom_node **grown = realloc(stack, sizeof(dom_node*) * cap);
+            if (!grown) break;
+            stack = grown;
+        }
+        for (int i = node->child_count - 1; i >= 0; i--) stack[count++] = node->children[i];
+    }
+    free(stack);
+}
+
+void tree_parallel_for_each(dom_node *root, tree_visit_fn visit, void *user) {
+    if (!root || !visit) return;
+    int threads = tree_pool_threads();
+    if (threads > 1) pthread_once(&workers_once, start_workers);
+    if (threads > worker_count + 1) threads = worker_count + 1;
+    if (threads <= 1 || root->child_count == 0) {
+        visit_serial(root, visit, user);
+        return;
+    }
+
+    pthread_mutex_lock(&run_lock);
+    pthread_mutex_lock(&pool_lock);
+    job_visit = visit;
+    job_user = user;
+    active_threads = threads;
+    pending = 1;
+    push_task(&deques[0], root);
+    generation++;
+    pthread_cond_broadcast(&pool_wake);
+    pthread_mutex_unlock(&pool_lock);
+
+    run_tasks(0);
+
+    pthread_mutex_lock(&pool_lock);
+    while (busy_workers > 0) pthread_cond_wait(&pool_idle, &pool_lock);
+    job_visit = NULL;
+    job_user = NULL;
+    pthread_mutex_unlock(&pool_lock);
+    pthread_mutex_unlock(&run_lock);
+}
+
+void tree_pool_shutdown() {
+    pthread_mutex_lock(&pool_lock);
+    stopping = 1;
+    pthread_cond_broadcast(&pool_wake);
+    pthread_mutex_unlock(&pool_lock);
+    for (int i = 0; i < worker_count; i++) pthread_join(workers[i], NULL);
+    worker_count = 0;
+    for (int i = 0; i < TREE_POOL_MAX_THREADS; i++) {
+        free(deques[i].tasks);
+        deques[i].tasks = NULL;
+        deques[i].head = deques[i].tail = deques[i].cap = 0;
+    }
+}
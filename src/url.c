@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include "url.h"
+
+static const char* default_port(const char *scheme) {
+    return strcmp(scheme, "https") == 0 ? "443" : "80";
+}
+
+static void copy_span(char *dst, size_t size, const char *start, size_t len) {
+    if (len >= size) len = size - 1;
+    memcpy(dst, start, len);
+    dst[len] = '\0';
+}
+
+static size_t strip_fragment_len(const char *s) {
+    const char *hash = strchr(s, '#');
+    return hash ? (size_t)(hash - s) : strlen(s);
+}
+
+static void remove_dot_segments(char *path) {
+    char *query = strchr(path, '?');
+    char tail[URL_MAX];
+    tail[0] = '\0';
+    if (query) {
+        strncpy(tail, query, URL_MAX - 1);
+        tail[URL_MAX - 1] = '\0';
+        *query = '\0';
+    }
+
+    char out[URL_MAX];
+    size_t out_len = 0;
+    const char *in = path;
+
+    while (*in) {
+        if (strncmp(in, "../", 3) == 0) { in += 3; continue; }
+        if (strncmp(in, "./", 2) == 0) { in += 2; continue; }
+        if (strncmp(in, "/./", 3) == 0) { in += 2; continue; }
+        if (strcmp(in, "/.") == 0) { in += 1; out[out_len++] = '/'; break; }
+        if (strncmp(in, "/../", 4) == 0 || strcmp(in, "/..") == 0) {
+            int last = in[3] == '\0';
+            in += 3;
+            while (out_len > 0 && out[out_len - 1] != '/') out_len--;
+            if (out_len > 0) out_len--;
+            if (last) { out[out_len++] = '/'; break; }
+            continue;
+        }
+        if (strcmp(in, ".") == 0 || strcmp(in, "..") == 0) break;
+
+        const char *seg = in;
+        if (*seg == '/') seg++;
+        const char *next = strchr(seg, '/');
+        size_t len = next ? (size_t)(next - in) : strlen(in);
+        if (out_len + len >= URL_MAX - 1) len = URL_MAX - 1 - out_len;
+        memcpy(out + out_len, in, len);
+        out_len += len;
+        in += len;
+        if (len == 0) break;
+    }
+    out[out_len] = '\0';
+
+    size_t lead = out[0] != '/';
+    if (out_len > URL_MAX - 1 - lead) out_len = URL_MAX - 1 - lead;
+    path[0] = '/';
+    memcpy(path + lead, out, out_len);
+    path[lead + out_len] = '\0';
+    strncat(path, tail, URL_MAX - 1 - strlen(path));
+}
+
+static int parse_authority(const char *start, const char *end, parsed_url *out) {
+    const char *at = memchr(start, '@', end - start);
+    if (at) start = at + 1;
+
+    const char *port = NULL;
+    if (*start == '[') {
+        const char *close = memchr(start, ']', end - start);
+        if (!close) return -1;
+        copy_span(out->host, sizeof(out->host), start + 1, close - start - 1);
+        if (close + 1 < end && close[1] == ':') port = close + 2;
+    } else {
+        const char *colon = memchr(start, ':', end - start);
+        copy_span(out->host, sizeof(out->host), start, (colon ? colon : end) - start);
+        if (colon) port = colon + 1;
+    }
+
+    for (char *h = out->host; *h; h++) *h = tolower((unsigned char)*h);
+    if (out->host[0] == '\0') return -1;
+
+    if (port && port < end) copy_span(out->port, sizeof(out->port), port, end - port);
+    else strcpy(out->port, default_port(out->scheme));
+    return 0;
+}
+
+static int parse_after_scheme(const char *p, parsed_url *out) {
+    size_t len = strip_fragment_len(p);
+    const char *end = p + len;
+    const char *auth_end = p;
+    while (auth_end < end && *auth_end != '/' && *auth_end != '?') auth_end++;
+
+    if (parse_authority(p, auth_end, out) != 0) return -1;
+
+    if (auth_end == end) {
+        strcpy(out->path, "/");
+    } else if (*auth_end == '?') {
+        out->path[0] = '/';
+        copy_span(out->path + 1, sizeof(out->path) - 1, auth_end, end - auth_end);
+    } else {
+        copy_span(out->path, sizeof(out->path), auth_end, end - auth_end);
+    }
+    remove_dot_segments(out->path);
+    return 0;
+}
+
+static int parse_file_path(const char *p, parsed_url *out) {
+    if (strncasecmp(p, "localhost/", 10) == 0) p += 9;
+    if (*p != '/') return -1;
+    copy_span(out->path, sizeof(out->path), p, strip_fragment_len(p));
+    remove_dot_segments(out->path);
+    return 0;
+}
+
+int url_parse(const char *text, parsed_url *out) {
+    memset(out, 0, sizeof(*out));
+    while (*text == ' ' || *text == '\t') text++;
+
+    const char *sep = strstr(text, "://");
+    if (sep && strpbrk(text, "/?#") < sep) sep = NULL;
+    if (sep) {
+        size_t slen = sep - text;
+        if (slen >= sizeof(out->scheme)) return -1;
+        copy_span(out->scheme, sizeof(out->scheme), text, slen);
+        for (char *s = out->scheme; *s; s++) *s = tolower((unsigned char)*s);
+        text = sep + 3;
+        if (strcmp(out->scheme, "file") == 0) return parse_file_path(text, out);
+        if (strcmp(out->scheme, "http") != 0 && strcmp(out->scheme, "https") != 0) return -1;
+    } else {
+        strcpy(out->scheme, "http");
+        if (strncmp(text, "//", 2) == 0) text += 2;
+    }
+    return parse_after_scheme(text, out);
+}
+
+int url_resolve(const parsed_url *base, const char *ref, parsed_url *out) {
+    while (*ref == ' ' || *ref == '\t') ref++;
+
+    const char *colon = strchr(ref, ':');
+    const char *slash = strpbrk(ref, "/?#");
+    if (colon && (!slash || colon < slash)) {
+        if (strncasecmp(ref, "http://", 7) == 0 || strncasecmp(ref, "https://", 8) == 0) return url_parse(ref, out);
+        if (strncasecmp(ref, "file://", 7) == 0 && url_is_file(base)) return url_parse(ref, out);
+        return -1;
+    }
+
+    memset(out, 0, sizeof(*out));
+    strcpy(out->scheme, base->scheme);
+
+    if (strncmp(ref, "//", 2) == 0) {
+        if (url_is_file(base)) return -1;
+        return parse_after_scheme(ref + 2, out);
+    }
+
+    strcpy(out->host, base->host);
+    strcpy(out->port, base->port);
+    size_t len = strip_fragment_len(ref);
+
+    if (len == 0) {
+        strcpy(out->path, base->path);
+        return 0;
+    }
+
+    if (ref[0] == '/') {
+        copy_span(out->path, sizeof(out->path), ref, len);
+    } else if (ref[0] == '?') {
+        const char *q = strchr(base->path, '?');
+        size_t keep = q ? (size_t)(q - base->path) : strlen(base->path);
+        copy_span(out->path, sizeof(out->path), base->path, keep);
+        size_t used = strlen(out->path);
+        copy_span(out->path + used, sizeof(out->path) - used, ref, len);
+    } else {
+        const char *q = strchr(base->path, '?');
+        size_t dir = q ? (size_t)(q - base->path) : strlen(base->path);
+        while (dir > 0 && base->path[dir - 1] != '/') dir--;
+        copy_span(out->path, sizeof(out->path), base->path, dir);
+        size_t used = strlen(out->path);
+        copy_span(out->path + used, sizeof(out->path) - used, ref, len);
+    }
+    remove_dot_segments(out->path);
+    return 0;
+}
+
+int url_is_file(const parsed_url *u) {
+    return strcmp(u->scheme, "file") == 0;
+}
+
+int url_is_default_port(const parsed_url *u) {
+    return url_is_file(u) || strcmp(u->port, default_port(u->scheme)) == 0;
+}
+
+void url_origin(const parsed_url *u, char *buf, size_t size) {
+    if (url_is_file(u)) {
+        snprintf(buf, size, "file://");
+        return;
+    }
+    int v6 = strchr(u->host, ':') != NULL;
+    if (url_is_default_port(u)) {
+        snprintf(buf, size, v6 ? "%s://[%s]" : "%s://%s", u->scheme, u->host);
+    } else {
+        snprintf(buf, size, v6 ? "%s://[%s]:%s" : "%s://%s:%s", u->scheme, u->host, u->port);
+    }
+}
+
+void url_format(const parsed_url *u, char *buf, size_t size) {
+    url_origin(u, buf, size);
+    size_t used = strlen(buf);
+    if (used < size) snprintf(buf + used, size - used, "%s", u->path);
+}
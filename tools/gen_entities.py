@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+import html.entities
+import sys
+
+SLOTS = 4096
+BUCKETS = 1024
+
+
+def fnv(key, seed):
+    h = (2166136261 ^ seed) & 0xffffffff
+    for b in key:
+        h ^= b
+        h = (h * 16777619) & 0xffffffff
+    return h
+
+
+def c_bytes(data):
+    return ''.join('\\%03o' % b for b in data)
+
+
+def main(out_path):
+    entities = sorted((k.encode(), v.encode()) for k, v in html.entities.html5.items())
+
+    buckets = [[] for _ in range(BUCKETS)]
+    for name, value in entities:
+        buckets[fnv(name, 0) % BUCKETS].append((name, value))
+
+    slots = [None] * SLOTS
+    disp = [0] * BUCKETS
+    for index in sorted(range(BUCKETS), key=lambda i: -len(buckets[i])):
+        group = buckets[index]
+        if not group:
+            continue
+        seed = 1
+        while True:
+            positions = [fnv(name, seed) % SLOTS for name, _ in group]
+            if len(set(positions)) == len(positions) and all(slots[p] is None for p in positions):
+                break
+            seed += 1
+        disp[index] = seed
+        for pos, entry in zip(positions, group):
+            slots[pos] = entry
+
+    names = bytearray()
+    values = bytearray()
+    rows = []
+    for entry in slots:
+        if entry is None:
+            rows.append('    {0, 0, 0, 0}')
+            continue
+        name, value = entry
+        rows.append('    {%d, %d, %d, %d}' % (len(names), len(name), len(values), len(value)))
+        names += name
+        values += value
+
+    with open(out_path, 'w') as f:
+        f.write('/* generated by tools/gen_entities.py from the HTML5 named character reference table; do not edit */\n')
+        f.write('#include <stdint.h>\n#include <string.h>\n#include "entities.h"\n\n')
+        f.write('#define ENTITY_SLOTS %d\n#define ENTITY_BUCKETS %d\n\n' % (SLOTS, BUCKETS))
+        f.write('typedef struct {\n    uint16_t name_off;\n    uint8_t name_len;\n    uint16_t value_off;\n    uint8_t value_len;\n} entity_entry;\n\n')
+        f.write('static const char entity_names[] =\n')
+        for i in range(0, len(names), 64):
+            f.write('    "%s"\n' % names[i:i + 64].decode())
+        f.write('    ;\n\nstatic const char entity_values[] =\n')
+        for i in range(0, len(values), 32):
+            f.write('    "%s"\n' % c_bytes(values[i:i + 32]))
+        f.write('    ;\n\nstatic const uint16_t entity_disp[ENTITY_BUCKETS] = {\n')
+        for i in range(0, BUCKETS, 16):
+            f.write('    %s,\n' % ', '.join(str(d) for d in disp[i:i + 16]))
+        f.write('};\n\nstatic const entity_entry entity_table[ENTITY_SLOTS] = {\n')
+        f.write(',\n'.join(rows))
+        f.write('\n};\n\n')
+        f.write('''static uint32_t entity_hash(const char *name, size_t len, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)name[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+const char* entity_lookup(const char *name, size_t len, size_t *value_len) {
+    if (len == 0 || len > ENTITY_MAX_NAME) return NULL;
+    uint32_t seed = entity_disp[entity_hash(name, len, 0) % ENTITY_BUCKETS];
+    if (seed == 0) return NULL;
+    const entity_entry *e = &entity_table[entity_hash(name, len, seed) % ENTITY_SLOTS];
+    if (e->name_len != len || memcmp(entity_names + e->name_off, name, len) != 0) return NULL;
+    *value_len = e->value_len;
+    return entity_values + e->value_off;
+}
+''')
+
+
+if __name__ == '__main__':
+    main(sys.argv[1] if len(sys.argv) > 1 else 'src/entities.c')